@@ -36,6 +36,7 @@
 #include "key_option.h"
 #include "long_press_event.h"
 #include "mmi_event_observer.h"
+#include "pointer_event_coalescer.h"
 #include "pointer_style.h"
 #include "touchpad_control_display_gain.h"
 #include "shift_info.h"
@@ -317,6 +318,7 @@ private:
     std::thread ehThread_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ { nullptr };
     std::shared_ptr<PointerEvent> lastPointerEvent_ { nullptr };
+    std::shared_ptr<PointerEventCoalescer> pointerCoalescer_ { nullptr };
     std::function<void(int32_t, int32_t)> windowStatecallback_;
     bool knuckleSwitch_ { true };
     UserScreenInfo userScreenInfo_ = {0};
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_EVENT_COALESCER_H
+#define POINTER_EVENT_COALESCER_H
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "nocopyable.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace MMI {
+/**
+ * Per-consumer delivery queue. Pointer events are queued on the IPC thread and delivered by a single
+ * drain task on the consumer's event runner. While that runner is busy, consecutive moves of the same
+ * pointer set collapse into the latest one; the skipped samples are handed to the deliver callback
+ * as history. Any other action, including button changes, is always delivered.
+ */
+class PointerEventCoalescer final : public std::enable_shared_from_this<PointerEventCoalescer> {
+public:
+    using PostTaskFunc = std::function<bool(std::function<void()>)>;
+    struct HistoricalSample {
+        int64_t actionTime { 0 };
+        std::list<PointerEvent::PointerItem> pointers;
+    };
+    // Oldest samples are dropped first once a stalled consumer exceeds this.
+    static constexpr size_t MAX_HISTORICAL_SAMPLES { 64 };
+    // History is ordered oldest first and does not include the delivered event itself.
+    using DeliverFunc = std::function<void(std::shared_ptr<PointerEvent>, const std::vector<HistoricalSample>&)>;
+
+    PointerEventCoalescer(PostTaskFunc postTask, DeliverFunc deliver);
+    ~PointerEventCoalescer() = default;
+    DISALLOW_COPY_AND_MOVE(PointerEventCoalescer);
+
+    // Returns false if a drain task was needed and could not be posted.
+    bool Enqueue(std::shared_ptr<PointerEvent> pointerEvent);
+    size_t GetPendingCount() const;
+    uint64_t GetCoalescedCount() const;
+
+private:
+    struct PendingEvent {
+        std::shared_ptr<PointerEvent> pointerEvent;
+        std::vector<HistoricalSample> history;
+    };
+
+    void Drain();
+    static bool CanCoalesce(const PointerEvent &queued, const PointerEvent &pointerEvent);
+
+    PostTaskFunc postTask_;
+    DeliverFunc deliver_;
+    mutable std::mutex mutex_;
+    std::deque<PendingEvent> queue_;
+    bool drainPending_ { false };
+    uint64_t coalescedCount_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // POINTER_EVENT_COALESCER_H
@@ -370,6 +370,18 @@ int32_t InputManagerImpl::SetWindowInputEventConsumer(std::shared_ptr<IInputEven
         std::lock_guard<std::mutex> guard(resourceMtx_);
         consumer_ = inputEventConsumer;
         eventHandler_ = eventHandler;
+#if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
+        pointerCoalescer_ = std::make_shared<PointerEventCoalescer>(
+            [eventHandler](std::function<void()> task) {
+                return eventHandler->PostTask(task, std::string("MMI::OnPointerEvent"), 0,
+                    AppExecFwk::EventHandler::Priority::VIP);
+            },
+            // IInputEventConsumer has no history parameter, consumers only see the latest sample.
+            [this, inputEventConsumer](std::shared_ptr<PointerEvent> pointerEvent,
+                const std::vector<PointerEventCoalescer::HistoricalSample>&) {
+                this->OnPointerEventTask(inputEventConsumer, pointerEvent);
+            });
+#endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
     }
     if (!MMIEventHdl.InitClient(eventHandler)) {
         MMI_HILOGE("Client init failed");
@@ -622,13 +634,13 @@ void InputManagerImpl::OnPointerEvent(std::shared_ptr<PointerEvent> pointerEvent
     CALL_DEBUG_ENTER;
     CHK_PID_AND_TID();
     CHKPV(pointerEvent);
-    std::shared_ptr<AppExecFwk::EventHandler> eventHandler = nullptr;
+    std::shared_ptr<PointerEventCoalescer> coalescer = nullptr;
     std::shared_ptr<IInputEventConsumer> inputConsumer = nullptr;
     {
         std::lock_guard<std::mutex> guard(resourceMtx_);
-        CHKPV(eventHandler_);
+        CHKPV(pointerCoalescer_);
         CHKPV(consumer_);
-        eventHandler = eventHandler_;
+        coalescer = pointerCoalescer_;
         inputConsumer = consumer_;
         lastPointerEvent_ = std::make_shared<PointerEvent>(*pointerEvent);
     }
@@ -648,10 +660,8 @@ void InputManagerImpl::OnPointerEvent(std::shared_ptr<PointerEvent> pointerEvent
     }
     if (client->IsEventHandlerChanged()) {
         BytraceAdapter::StartPostTaskEvent(pointerEvent);
-        if (!eventHandler->PostTask([this, inputConsumer, pointerEvent] {
-                return this->OnPointerEventTask(inputConsumer, pointerEvent);
-            },
-            std::string("MMI::OnPointerEvent"), 0, AppExecFwk::EventHandler::Priority::VIP)) {
+        // Moves queued behind a busy consumer collapse into the latest one, see PointerEventCoalescer.
+        if (!coalescer->Enqueue(pointerEvent)) {
             MMI_HILOG_DISPATCHE("Post task failed");
             BytraceAdapter::StopPostTaskEvent();
             return;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pointer_event_coalescer.h"
+
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "PointerEventCoalescer"
+
+namespace OHOS {
+namespace MMI {
+PointerEventCoalescer::PointerEventCoalescer(PostTaskFunc postTask, DeliverFunc deliver)
+    : postTask_(std::move(postTask)), deliver_(std::move(deliver)) {}
+
+bool PointerEventCoalescer::Enqueue(std::shared_ptr<PointerEvent> pointerEvent)
+{
+    CHKPF(pointerEvent);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (!queue_.empty() && CanCoalesce(*queue_.back().pointerEvent, *pointerEvent)) {
+            // The skipped event is never marked processed; the ANR tracker only keeps the latest processed id.
+            PendingEvent &pending = queue_.back();
+            if (pending.history.size() >= MAX_HISTORICAL_SAMPLES) {
+                pending.history.erase(pending.history.begin());
+            }
+            pending.history.push_back({ pending.pointerEvent->GetActionTime(),
+                pending.pointerEvent->GetAllPointerItems() });
+            pending.pointerEvent = pointerEvent;
+            ++coalescedCount_;
+        } else {
+            queue_.push_back({ pointerEvent, {} });
+        }
+        if (drainPending_) {
+            return true;
+        }
+        drainPending_ = true;
+    }
+    auto self = shared_from_this();
+    if (!postTask_([self] { self->Drain(); })) {
+        MMI_HILOG_DISPATCHE("Post drain task failed, pending:%{public}zu", GetPendingCount());
+        std::lock_guard<std::mutex> guard(mutex_);
+        drainPending_ = false;
+        return false;
+    }
+    return true;
+}
+
+void PointerEventCoalescer::Drain()
+{
+    std::deque<PendingEvent> events;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        events.swap(queue_);
+        drainPending_ = false;
+    }
+    for (const auto &pending : events) {
+        deliver_(pending.pointerEvent, pending.history);
+    }
+}
+
+size_t PointerEventCoalescer::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return queue_.size();
+}
+
+uint64_t PointerEventCoalescer::GetCoalescedCount() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return coalescedCount_;
+}
+
+bool PointerEventCoalescer::CanCoalesce(const PointerEvent &queued, const PointerEvent &pointerEvent)
+{
+    return (queued.GetPointerAction() == PointerEvent::POINTER_ACTION_MOVE) &&
+        (pointerEvent.GetPointerAction() == PointerEvent::POINTER_ACTION_MOVE) &&
+        (queued.GetSourceType() == pointerEvent.GetSourceType()) &&
+        (queued.GetDeviceId() == pointerEvent.GetDeviceId()) &&
+        (queued.GetTargetWindowId() == pointerEvent.GetTargetWindowId()) &&
+        (queued.GetPressedButtons() == pointerEvent.GetPressedButtons()) &&
+        (queued.GetPointerIds() == pointerEvent.GetPointerIds());
+}
+} // namespace MMI
+} // namespace OHOS
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "pointer_event_coalescer.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t DEVICE_ID { 3 };
+constexpr int32_t WINDOW_ID { 10 };
+constexpr int64_t SAMPLE_INTERVAL { 4000 };
+} // namespace
+
+/**
+ * Stands in for the consumer's AppExecFwk::EventRunner. Posted tasks only run when the test says so,
+ * which is how a busy main thread is simulated.
+ */
+class FakeEventRunner {
+public:
+    bool PostTask(std::function<void()> task)
+    {
+        if (rejectTasks_) {
+            return false;
+        }
+        tasks_.push_back(std::move(task));
+        return true;
+    }
+
+    void RunAll()
+    {
+        while (!tasks_.empty()) {
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            task();
+        }
+    }
+
+    size_t GetTaskCount() const
+    {
+        return tasks_.size();
+    }
+
+    void SetRejectTasks(bool reject)
+    {
+        rejectTasks_ = reject;
+    }
+
+private:
+    std::deque<std::function<void()>> tasks_;
+    bool rejectTasks_ { false };
+};
+
+class PointerEventCoalescerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    void SetUp() override
+    {
+        delivered_.clear();
+        histories_.clear();
+        coalescer_ = std::make_shared<PointerEventCoalescer>(
+            [this](std::function<void()> task) { return runner_.PostTask(std::move(task)); },
+            [this](std::shared_ptr<PointerEvent> pointerEvent,
+                const std::vector<PointerEventCoalescer::HistoricalSample> &history) {
+                delivered_.push_back(pointerEvent);
+                histories_.push_back(history);
+            });
+    }
+
+    static std::shared_ptr<PointerEvent> MakeEvent(int32_t action, int64_t time, int32_t fingers = 1)
+    {
+        auto pointerEvent = PointerEvent::Create();
+        pointerEvent->SetPointerAction(action);
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+        pointerEvent->SetDeviceId(DEVICE_ID);
+        pointerEvent->SetTargetWindowId(WINDOW_ID);
+        pointerEvent->SetActionTime(time);
+        pointerEvent->SetPointerId(0);
+        for (int32_t id = 0; id < fingers; ++id) {
+            PointerEvent::PointerItem item;
+            item.SetPointerId(id);
+            item.SetDisplayX(static_cast<int32_t>(time / SAMPLE_INTERVAL));
+            item.SetDisplayY(id);
+            pointerEvent->AddPointerItem(item);
+        }
+        return pointerEvent;
+    }
+
+protected:
+    FakeEventRunner runner_;
+    std::shared_ptr<PointerEventCoalescer> coalescer_ { nullptr };
+    std::vector<std::shared_ptr<PointerEvent>> delivered_;
+    std::vector<std::vector<PointerEventCoalescer::HistoricalSample>> histories_;
+};
+
+/**
+ * @tc.name: PointerEventCoalescerTest_Enqueue_001
+ * @tc.desc: Moves queued behind a stalled runner collapse into the latest one with history, down and up are kept
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventCoalescerTest, PointerEventCoalescerTest_Enqueue_001, TestSize.Level1)
+{
+    constexpr int32_t moves = 10;
+    EXPECT_TRUE(coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_DOWN, 0)));
+    for (int32_t i = 1; i <= moves; ++i) {
+        EXPECT_TRUE(coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, i * SAMPLE_INTERVAL)));
+    }
+    EXPECT_TRUE(coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_UP, (moves + 1) * SAMPLE_INTERVAL)));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    EXPECT_EQ(coalescer_->GetPendingCount(), 3U);
+    EXPECT_EQ(coalescer_->GetCoalescedCount(), static_cast<uint64_t>(moves - 1));
+
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 3U);
+    EXPECT_EQ(delivered_[0]->GetPointerAction(), PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(delivered_[1]->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(delivered_[1]->GetActionTime(), moves * SAMPLE_INTERVAL);
+    EXPECT_EQ(delivered_[2]->GetPointerAction(), PointerEvent::POINTER_ACTION_UP);
+
+    const auto &history = histories_[1];
+    ASSERT_EQ(history.size(), static_cast<size_t>(moves - 1));
+    for (size_t i = 0; i < history.size(); ++i) {
+        EXPECT_EQ(history[i].actionTime, static_cast<int64_t>(i + 1) * SAMPLE_INTERVAL);
+        ASSERT_EQ(history[i].pointers.size(), 1U);
+        EXPECT_EQ(history[i].pointers.front().GetDisplayX(), static_cast<int32_t>(i + 1));
+    }
+    EXPECT_EQ(coalescer_->GetPendingCount(), 0U);
+    EXPECT_EQ(runner_.GetTaskCount(), 0U);
+}
+
+/**
+ * @tc.name: PointerEventCoalescerTest_Enqueue_002
+ * @tc.desc: Button changes, pointer set changes and cancel are never coalesced
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventCoalescerTest, PointerEventCoalescerTest_Enqueue_002, TestSize.Level1)
+{
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, SAMPLE_INTERVAL));
+    auto pressed = MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 2 * SAMPLE_INTERVAL);
+    pressed->SetButtonPressed(PointerEvent::MOUSE_BUTTON_LEFT);
+    coalescer_->Enqueue(pressed);
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_BUTTON_DOWN, 3 * SAMPLE_INTERVAL));
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 4 * SAMPLE_INTERVAL, 2));
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 5 * SAMPLE_INTERVAL, 1));
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_CANCEL, 6 * SAMPLE_INTERVAL));
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_CANCEL, 7 * SAMPLE_INTERVAL));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    EXPECT_EQ(coalescer_->GetCoalescedCount(), 0U);
+
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 7U);
+    for (size_t i = 0; i < delivered_.size(); ++i) {
+        EXPECT_EQ(delivered_[i]->GetActionTime(), static_cast<int64_t>(i + 1) * SAMPLE_INTERVAL);
+        EXPECT_TRUE(histories_[i].empty());
+    }
+}
+
+/**
+ * @tc.name: PointerEventCoalescerTest_Enqueue_003
+ * @tc.desc: At most one drain task is pending, delivered events are never coalesced again
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventCoalescerTest, PointerEventCoalescerTest_Enqueue_003, TestSize.Level1)
+{
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, SAMPLE_INTERVAL));
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 2 * SAMPLE_INTERVAL));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 1U);
+
+    // The runner is free again, so the next move is delivered on its own with a fresh drain task.
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 3 * SAMPLE_INTERVAL));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, 4 * SAMPLE_INTERVAL));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 2U);
+    EXPECT_EQ(delivered_[1]->GetActionTime(), 4 * SAMPLE_INTERVAL);
+    ASSERT_EQ(histories_[1].size(), 1U);
+    EXPECT_EQ(histories_[1].front().actionTime, 3 * SAMPLE_INTERVAL);
+}
+
+/**
+ * @tc.name: PointerEventCoalescerTest_Enqueue_004
+ * @tc.desc: A failed post keeps the events queued and the next successful post delivers them
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventCoalescerTest, PointerEventCoalescerTest_Enqueue_004, TestSize.Level1)
+{
+    runner_.SetRejectTasks(true);
+    EXPECT_FALSE(coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_DOWN, 0)));
+    EXPECT_EQ(coalescer_->GetPendingCount(), 1U);
+    runner_.SetRejectTasks(false);
+    EXPECT_TRUE(coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_UP, SAMPLE_INTERVAL)));
+    EXPECT_EQ(runner_.GetTaskCount(), 1U);
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 2U);
+    EXPECT_EQ(delivered_[0]->GetPointerAction(), PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(delivered_[1]->GetPointerAction(), PointerEvent::POINTER_ACTION_UP);
+}
+
+/**
+ * @tc.name: PointerEventCoalescerTest_Enqueue_005
+ * @tc.desc: History of a long stall is bounded and keeps the newest samples
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventCoalescerTest, PointerEventCoalescerTest_Enqueue_005, TestSize.Level1)
+{
+    constexpr int32_t moves = 200;
+    for (int32_t i = 1; i <= moves; ++i) {
+        coalescer_->Enqueue(MakeEvent(PointerEvent::POINTER_ACTION_MOVE, i * SAMPLE_INTERVAL));
+    }
+    runner_.RunAll();
+    ASSERT_EQ(delivered_.size(), 1U);
+    const auto &history = histories_[0];
+    ASSERT_EQ(history.size(), PointerEventCoalescer::MAX_HISTORICAL_SAMPLES);
+    EXPECT_EQ(history.back().actionTime, (moves - 1) * SAMPLE_INTERVAL);
+    EXPECT_EQ(history.front().actionTime,
+        static_cast<int64_t>(moves - PointerEventCoalescer::MAX_HISTORICAL_SAMPLES) * SAMPLE_INTERVAL);
+}
+} // namespace MMI
+} // namespace OHOS
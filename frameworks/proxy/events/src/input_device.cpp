@@ -153,6 +153,11 @@ std::vector<InputDevice::AxisInfo> InputDevice::GetAxisInfo()
     return axis_;
 }
 
+std::vector<InputDevice::AxisInfo> InputDevice::GetAxisInfo() const
+{
+    return axis_;
+}
+
 void InputDevice::SetAxisInfo(std::vector<AxisInfo> axis)
 {
     axis_ = axis;
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RING_CHANNEL_H
+#define RING_CHANNEL_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+/**
+ * Bounded multi-producer single-consumer channel with the same Sender/Receiver API as Channel.
+ *
+ * Senders claim a slot of a fixed ring with a CAS on the enqueue position and publish the event through the
+ * per-slot sequence number, so sending never takes a lock unless the receiver is asleep. Events are received
+ * in the order their slots were claimed, which keeps the per-sender FIFO order that Channel guarantees.
+ * Peek, Pop, Receive and ReceiveBatch must only be called from a single thread.
+ */
+template <typename Event>
+class RingChannel {
+    static_assert(std::is_enum_v<Event> || std::is_integral_v<Event> ||
+        (std::is_class_v<Event> && std::is_default_constructible_v<Event> && std::is_copy_constructible_v<Event>));
+
+public:
+    enum ChannelError {
+        NO_ERROR = 0,
+        QUEUE_IS_FULL = -1,
+        NO_CHANNEL = -2,
+        INACTIVE_CHANNEL = -3,
+    };
+
+    class Sender final {
+        friend class RingChannel<Event>;
+
+    public:
+        Sender() = default;
+        ~Sender() = default;
+
+        Sender(const Sender &other) : channel_(other.channel_) { }
+
+        Sender(Sender &&other) : channel_(other.channel_)
+        {
+            other.channel_ = nullptr;
+        }
+
+        Sender &operator=(const Sender &other)
+        {
+            channel_ = other.channel_;
+            return *this;
+        }
+
+        Sender &operator=(Sender &&other)
+        {
+            channel_ = other.channel_;
+            other.channel_ = nullptr;
+            return *this;
+        }
+
+        int32_t Send(const Event &event)
+        {
+            if (channel_ == nullptr) {
+                return ChannelError::NO_CHANNEL;
+            }
+            return channel_->Send(event);
+        }
+
+    private:
+        Sender(std::shared_ptr<RingChannel<Event>> channel) : channel_(channel) { }
+
+        std::shared_ptr<RingChannel<Event>> channel_ { nullptr };
+    };
+
+    class Receiver final {
+        friend class RingChannel<Event>;
+
+    public:
+        Receiver() = default;
+        ~Receiver() = default;
+
+        Receiver(const Receiver &other) : channel_(other.channel_) { }
+
+        Receiver(Receiver &&other) : channel_(other.channel_)
+        {
+            other.channel_ = nullptr;
+        }
+
+        Receiver &operator=(const Receiver &other)
+        {
+            channel_ = other.channel_;
+            return *this;
+        }
+
+        Receiver &operator=(Receiver &&other)
+        {
+            channel_ = other.channel_;
+            other.channel_ = nullptr;
+            return *this;
+        }
+
+        void Enable()
+        {
+            if (channel_ != nullptr) {
+                channel_->Enable();
+            }
+        }
+
+        void Disable()
+        {
+            if (channel_ != nullptr) {
+                channel_->Disable();
+            }
+        }
+
+        Event Peek()
+        {
+            return (channel_ != nullptr ? channel_->Peek() : Event());
+        }
+
+        void Pop()
+        {
+            if (channel_ != nullptr) {
+                channel_->Pop();
+            }
+        }
+
+        Event Receive()
+        {
+            return (channel_ != nullptr ? channel_->Receive() : Event());
+        }
+
+        // Waits for at least one event, then drains up to maxEvents into events. Returns the number received.
+        size_t ReceiveBatch(std::vector<Event> &events, size_t maxEvents)
+        {
+            return (channel_ != nullptr ? channel_->ReceiveBatch(events, maxEvents) : 0);
+        }
+
+        // Number of events rejected with QUEUE_IS_FULL since the channel was opened.
+        size_t GetOverflowCount() const
+        {
+            return (channel_ != nullptr ? channel_->overflows_.load(std::memory_order_relaxed) : 0);
+        }
+
+    private:
+        Receiver(std::shared_ptr<RingChannel<Event>> channel) : channel_(channel) { }
+
+        std::shared_ptr<RingChannel<Event>> channel_ { nullptr };
+    };
+
+    RingChannel();
+    ~RingChannel() = default;
+
+    static std::pair<Sender, Receiver> OpenChannel();
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence { 0 };
+        Event event {};
+    };
+
+    void Enable();
+    void Disable();
+    int32_t Send(const Event &event);
+    Event Peek();
+    void Pop();
+    Event Receive();
+    size_t ReceiveBatch(std::vector<Event> &events, size_t maxEvents);
+    bool TryPop(Event &event);
+    Slot &WaitForFront();
+    void Notify();
+
+    static inline constexpr size_t QUEUE_CAPACITY { 1024 };
+    static inline constexpr size_t CACHE_LINE_SIZE { 64 };
+    static_assert((QUEUE_CAPACITY & (QUEUE_CAPACITY - 1)) == 0);
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos_ { 0 };
+    alignas(CACHE_LINE_SIZE) size_t dequeuePos_ { 0 };
+    std::atomic<bool> isActive_ { false };
+    std::atomic<bool> sleeping_ { false };
+    std::atomic<size_t> overflows_ { 0 };
+    std::mutex lock_;
+    std::condition_variable empty_;
+    std::array<Slot, QUEUE_CAPACITY> slots_;
+};
+
+template <typename Event>
+RingChannel<Event>::RingChannel()
+{
+    for (size_t index = 0; index < QUEUE_CAPACITY; ++index) {
+        slots_[index].sequence.store(index, std::memory_order_relaxed);
+    }
+}
+
+template <typename Event>
+std::pair<typename RingChannel<Event>::Sender, typename RingChannel<Event>::Receiver>
+RingChannel<Event>::OpenChannel()
+{
+    std::shared_ptr<RingChannel<Event>> channel = std::make_shared<RingChannel<Event>>();
+    return std::make_pair(RingChannel<Event>::Sender(channel), RingChannel<Event>::Receiver(channel));
+}
+
+template <typename Event>
+void RingChannel<Event>::Enable()
+{
+    isActive_.store(true);
+}
+
+template <typename Event>
+void RingChannel<Event>::Disable()
+{
+    isActive_.store(false);
+    Event event {};
+    while (TryPop(event)) {}
+}
+
+template <typename Event>
+int32_t RingChannel<Event>::Send(const Event &event)
+{
+    if (!isActive_.load(std::memory_order_relaxed)) {
+        return ChannelError::INACTIVE_CHANNEL;
+    }
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    for (;;) {
+        slot = &slots_[pos & (QUEUE_CAPACITY - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < pos) {
+            overflows_.fetch_add(1, std::memory_order_relaxed);
+            return ChannelError::QUEUE_IS_FULL;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->event = event;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    Notify();
+    return ChannelError::NO_ERROR;
+}
+
+template <typename Event>
+void RingChannel<Event>::Notify()
+{
+    // Pairs with the fence in WaitForFront(): either the receiver sees the published slot, or we see it asleep.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed)) {
+        std::unique_lock<std::mutex> lock(lock_);
+        empty_.notify_all();
+    }
+}
+
+template <typename Event>
+typename RingChannel<Event>::Slot &RingChannel<Event>::WaitForFront()
+{
+    Slot &slot = slots_[dequeuePos_ & (QUEUE_CAPACITY - 1)];
+    auto isReady = [this, &slot] {
+        return (slot.sequence.load(std::memory_order_acquire) == dequeuePos_ + 1);
+    };
+    if (isReady()) {
+        return slot;
+    }
+    std::unique_lock<std::mutex> lock(lock_);
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    empty_.wait(lock, isReady);
+    sleeping_.store(false, std::memory_order_relaxed);
+    return slot;
+}
+
+template <typename Event>
+bool RingChannel<Event>::TryPop(Event &event)
+{
+    Slot &slot = slots_[dequeuePos_ & (QUEUE_CAPACITY - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) {
+        return false;
+    }
+    event = std::move(slot.event);
+    slot.sequence.store(dequeuePos_ + QUEUE_CAPACITY, std::memory_order_release);
+    ++dequeuePos_;
+    return true;
+}
+
+template <typename Event>
+Event RingChannel<Event>::Peek()
+{
+    return WaitForFront().event;
+}
+
+template <typename Event>
+void RingChannel<Event>::Pop()
+{
+    Slot &slot = WaitForFront();
+    slot.event = Event();
+    slot.sequence.store(dequeuePos_ + QUEUE_CAPACITY, std::memory_order_release);
+    ++dequeuePos_;
+}
+
+template <typename Event>
+Event RingChannel<Event>::Receive()
+{
+    WaitForFront();
+    Event event {};
+    TryPop(event);
+    return event;
+}
+
+template <typename Event>
+size_t RingChannel<Event>::ReceiveBatch(std::vector<Event> &events, size_t maxEvents)
+{
+    events.clear();
+    if (maxEvents == 0) {
+        return 0;
+    }
+    WaitForFront();
+    Event event {};
+    while ((events.size() < maxEvents) && TryPop(event)) {
+        events.push_back(std::move(event));
+    }
+    return events.size();
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // RING_CHANNEL_H
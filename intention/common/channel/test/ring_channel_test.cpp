@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define private public
+#define protected public
+
+#include <chrono>
+#include <cinttypes>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "channel.h"
+#include "fi_log.h"
+#include "ring_channel.h"
+
+#undef LOG_TAG
+#define LOG_TAG "RingChannelTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace {
+constexpr size_t N_PRODUCERS { 4 };
+constexpr size_t N_EVENTS_PER_PRODUCER { 100000 };
+constexpr size_t N_LATENCY_SAMPLES { 10000 };
+constexpr size_t BATCH_SIZE { 32 };
+constexpr uint64_t PRODUCER_SHIFT { 32 };
+constexpr uint64_t SEQUENCE_MASK { (1ULL << PRODUCER_SHIFT) - 1 };
+
+int64_t NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SendAll(RingChannel<uint64_t>::Sender sender, uint64_t producer)
+{
+    for (uint64_t seq = 0; seq < N_EVENTS_PER_PRODUCER; ++seq) {
+        uint64_t value = (producer << PRODUCER_SHIFT) | seq;
+        while (sender.Send(value) == RingChannel<uint64_t>::QUEUE_IS_FULL) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Returns nanoseconds taken to pass N_PRODUCERS * N_EVENTS_PER_PRODUCER events through the channel.
+template <typename ChannelType>
+int64_t MeasureThroughput()
+{
+    auto [sender, receiver] = ChannelType::OpenChannel();
+    receiver.Enable();
+    int64_t start = NowNs();
+    std::vector<std::thread> producers;
+    for (uint64_t producer = 0; producer < N_PRODUCERS; ++producer) {
+        producers.emplace_back([sender = sender, producer]() mutable {
+            for (uint64_t seq = 0; seq < N_EVENTS_PER_PRODUCER; ++seq) {
+                while (sender.Send((producer << PRODUCER_SHIFT) | seq) == ChannelType::QUEUE_IS_FULL) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t received = 0; received < N_PRODUCERS * N_EVENTS_PER_PRODUCER; ++received) {
+        receiver.Receive();
+    }
+    int64_t elapsed = NowNs() - start;
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    return elapsed;
+}
+
+// Returns the mean nanoseconds from Send() to Receive() of a paced sender.
+template <typename ChannelType>
+int64_t MeasureLatency()
+{
+    auto [sender, receiver] = ChannelType::OpenChannel();
+    receiver.Enable();
+    std::thread producer([sender = sender]() mutable {
+        for (size_t index = 0; index < N_LATENCY_SAMPLES; ++index) {
+            sender.Send(static_cast<uint64_t>(NowNs()));
+            std::this_thread::yield();
+        }
+    });
+    int64_t total = 0;
+    for (size_t index = 0; index < N_LATENCY_SAMPLES; ++index) {
+        uint64_t sent = receiver.Receive();
+        total += NowNs() - static_cast<int64_t>(sent);
+    }
+    producer.join();
+    return total / static_cast<int64_t>(N_LATENCY_SAMPLES);
+}
+} // namespace
+using namespace testing::ext;
+
+class RingChannelTest : public testing::Test {
+public:
+    static void SetUpTestCase() { }
+    static void TearDownTestCase() { }
+    void SetUp() { }
+    void TearDown() { }
+};
+
+/**
+ * @tc.name: RingChannelTest001
+ * @tc.desc: Events of concurrent senders are all received, each sender's events in the order they were sent.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RingChannelTest, RingChannelTest001, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = RingChannel<uint64_t>::OpenChannel();
+    receiver.Enable();
+    std::vector<std::thread> producers;
+    for (uint64_t producer = 0; producer < N_PRODUCERS; ++producer) {
+        producers.emplace_back(SendAll, sender, producer);
+    }
+    std::vector<uint64_t> expected(N_PRODUCERS, 0);
+    std::vector<uint64_t> events;
+    size_t received = 0;
+    while (received < N_PRODUCERS * N_EVENTS_PER_PRODUCER) {
+        received += receiver.ReceiveBatch(events, BATCH_SIZE);
+        ASSERT_FALSE(events.empty());
+        ASSERT_LE(events.size(), BATCH_SIZE);
+        for (uint64_t value : events) {
+            uint64_t producer = value >> PRODUCER_SHIFT;
+            ASSERT_LT(producer, N_PRODUCERS);
+            ASSERT_EQ(value & SEQUENCE_MASK, expected[producer]);
+            ++expected[producer];
+        }
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (uint64_t count : expected) {
+        EXPECT_EQ(count, N_EVENTS_PER_PRODUCER);
+    }
+}
+
+/**
+ * @tc.name: RingChannelTest002
+ * @tc.desc: Sending to a full channel fails with QUEUE_IS_FULL and is counted as overflow.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RingChannelTest, RingChannelTest002, TestSize.Level0)
+{
+    CALL_TEST_DEBUG;
+    auto [sender, receiver] = RingChannel<size_t>::OpenChannel();
+    EXPECT_EQ(sender.Send(0), RingChannel<size_t>::INACTIVE_CHANNEL);
+    receiver.Enable();
+
+    for (size_t index = 0; index < RingChannel<size_t>::QUEUE_CAPACITY; ++index) {
+        EXPECT_EQ(sender.Send(index), RingChannel<size_t>::NO_ERROR);
+    }
+    EXPECT_EQ(sender.Send(0), RingChannel<size_t>::QUEUE_IS_FULL);
+    EXPECT_EQ(receiver.GetOverflowCount(), 1U);
+    EXPECT_EQ(receiver.Peek(), 0U);
+    receiver.Pop();
+    EXPECT_EQ(sender.Send(RingChannel<size_t>::QUEUE_CAPACITY), RingChannel<size_t>::NO_ERROR);
+    for (size_t expected = 1; expected <= RingChannel<size_t>::QUEUE_CAPACITY; ++expected) {
+        EXPECT_EQ(receiver.Receive(), expected);
+    }
+    receiver.Disable();
+    EXPECT_EQ(sender.Send(0), RingChannel<size_t>::INACTIVE_CHANNEL);
+}
+
+/**
+ * @tc.name: RingChannelTest003
+ * @tc.desc: Compare throughput and latency of RingChannel against Channel.
+ * @tc.type: PERF
+ */
+HWTEST_F(RingChannelTest, RingChannelTest003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    int64_t channelTime = MeasureThroughput<Channel<uint64_t>>();
+    int64_t ringTime = MeasureThroughput<RingChannel<uint64_t>>();
+    int64_t channelLatency = MeasureLatency<Channel<uint64_t>>();
+    int64_t ringLatency = MeasureLatency<RingChannel<uint64_t>>();
+    FI_HILOGI("%{public}zu events from %{public}zu senders, Channel:%{public}" PRId64 " ns, RingChannel:%{public}"
+        PRId64 " ns; mean latency, Channel:%{public}" PRId64 " ns, RingChannel:%{public}" PRId64 " ns",
+        N_PRODUCERS * N_EVENTS_PER_PRODUCER, N_PRODUCERS, channelTime, ringTime, channelLatency, ringLatency);
+    EXPECT_GT(ringTime, 0);
+    EXPECT_GT(ringLatency, 0);
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
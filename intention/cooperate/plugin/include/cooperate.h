@@ -66,7 +66,7 @@ private:
     std::mutex lock_;
     bool workerStarted_ { false };
     std::thread worker_;
-    Channel<CooperateEvent>::Receiver receiver_;
+    RingChannel<CooperateEvent>::Receiver receiver_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
@@ -47,13 +47,13 @@ public:
     ~Context() = default;
     DISALLOW_COPY_AND_MOVE(Context);
 
-    void AttachSender(Channel<CooperateEvent>::Sender sender);
+    void AttachSender(RingChannel<CooperateEvent>::Sender sender);
     void AddObserver(std::shared_ptr<ICooperateObserver> observer);
     void RemoveObserver(std::shared_ptr<ICooperateObserver> observer);
     void Enable();
     void Disable();
 
-    Channel<CooperateEvent>::Sender Sender() const;
+    RingChannel<CooperateEvent>::Sender Sender() const;
     std::shared_ptr<AppExecFwk::EventHandler> EventHandler() const;
     std::string Local() const;
     std::string Peer() const;
@@ -113,7 +113,7 @@ private:
     void SetCursorPosition(const Coordinate &cursorPos);
 
     IContext *env_ { nullptr };
-    Channel<CooperateEvent>::Sender sender_;
+    RingChannel<CooperateEvent>::Sender sender_;
     std::string remoteNetworkId_;
     int32_t startDeviceId_ { -1 };
     uint32_t flag_ {};
@@ -129,7 +129,7 @@ private:
 #endif // ENABLE_PERFORMANCE_CHECK
 };
 
-inline Channel<CooperateEvent>::Sender Context::Sender() const
+inline RingChannel<CooperateEvent>::Sender Context::Sender() const
 {
     return sender_;
 }
@@ -167,6 +167,10 @@ struct InputPointerEvent {
 using DSoftbusSessionOpened = DDMBoardOnlineEvent;
 using DSoftbusSessionClosed = DDMBoardOnlineEvent;
 
+// Features this end can decode, exchanged at the end of the start and come back packets. A peer whose packets
+// lack the field is taken to support none of them.
+constexpr uint32_t PEER_CAPABILITY_POINTER_STREAM { 0x1 };
+
 struct DSoftbusStartCooperate {
     std::string networkId;
     std::string originNetworkId;
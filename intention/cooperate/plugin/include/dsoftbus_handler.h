@@ -18,7 +18,7 @@
 
 #include "nocopyable.h"
 
-#include "channel.h"
+#include "ring_channel.h"
 #include "cooperate_events.h"
 #include "i_context.h"
 
@@ -66,7 +66,7 @@ public:
     ~DSoftbusHandler();
     DISALLOW_COPY_AND_MOVE(DSoftbusHandler);
 
-    void AttachSender(Channel<CooperateEvent>::Sender sender);
+    void AttachSender(RingChannel<CooperateEvent>::Sender sender);
     int32_t OpenSession(const std::string &networkId);
     void CloseSession(const std::string &networkId);
     void CloseAllSessions();
@@ -76,6 +76,8 @@ public:
     int32_t ComeBack(const std::string &networkId, const DSoftbusComeBack &event);
     int32_t RelayCooperate(const std::string &networkId, const DSoftbusRelayCooperate &event);
     int32_t RelayCooperateFinish(const std::string &networkId, const DSoftbusRelayCooperateFinished &event);
+    // Capabilities the peer advertised in its last start or come back packet, zero if none was received yet.
+    uint32_t GetPeerCapabilities(const std::string &networkId);
     static std::string GetLocalNetworkId();
 
 private:
@@ -98,12 +100,15 @@ private:
     void OnRemoteInputDevice(const std::string &networKId, NetPacket &packet);
     void OnRemoteHotPlug(const std::string &networKId, NetPacket &packet);
     int32_t DeserializeDevice(std::shared_ptr<IDevice> device, NetPacket &packet);
+    void ReadPeerCapabilities(const std::string &networkId, NetPacket &packet);
+    void RemovePeerCapabilities(const std::string &networkId);
 
     IContext *env_ { nullptr };
     std::mutex lock_;
-    Channel<CooperateEvent>::Sender sender_;
+    RingChannel<CooperateEvent>::Sender sender_;
     std::shared_ptr<DSoftbusObserver> observer_;
     std::map<int32_t, std::function<void(const std::string &networkId, NetPacket &packet)>> handles_;
+    std::map<std::string, uint32_t> peerCapabilities_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
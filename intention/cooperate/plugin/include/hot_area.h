@@ -18,6 +18,7 @@
 
 #include <set>
 
+#include "display_manager_lite.h"
 #include "nocopyable.h"
 #include "pointer_event.h"
 
@@ -31,6 +32,25 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
 class HotArea final {
+    class DisplayListener final : public Rosen::DisplayManagerLite::IDisplayListener {
+    public:
+        DisplayListener(HotArea &parent) : parent_(parent) { }
+        ~DisplayListener() = default;
+
+        void OnCreate(Rosen::DisplayId displayId) override { }
+        void OnDestroy(Rosen::DisplayId displayId) override
+        {
+            parent_.OnDisplayChanged(static_cast<int32_t>(displayId));
+        }
+        void OnChange(Rosen::DisplayId displayId) override
+        {
+            parent_.OnDisplayChanged(static_cast<int32_t>(displayId));
+        }
+
+    private:
+        HotArea &parent_;
+    };
+
 public:
     struct HotAreaInfo {
         int32_t pid { -1 };
@@ -45,35 +65,66 @@ public:
     };
 
     HotArea(IContext *env) : env_(env) { }
-    ~HotArea() = default;
+    ~HotArea();
     DISALLOW_COPY_AND_MOVE(HotArea);
 
     void AddListener(const RegisterHotareaListenerEvent &event);
     void RemoveListener(const UnregisterHotareaListenerEvent &event);
 
     void EnableCooperate(const EnableCooperateEvent &event);
+    // Listeners are notified only when the area or edge state changes.
     int32_t ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnClientDied(const ClientDiedEvent &event);
 
 private:
+    struct Bands {
+        int32_t leftMax { 0 };
+        int32_t rightMin { 0 };
+        int32_t topMax { 0 };
+        int32_t bottomMin { 0 };
+        int32_t xMarginMin { 0 };
+        int32_t xMarginMax { 0 };
+        int32_t yMarginMin { 0 };
+        int32_t yMarginMax { 0 };
+    };
+
+    void UpdateDisplayGeometry(int32_t displayId, int32_t width, int32_t height);
+    bool NeedLoadDisplayGeometry(int32_t displayId);
+    // Queries the display manager without holding lock_.
+    void LoadDisplayGeometry(int32_t displayId);
+    // Called on the display manager's thread, the geometry is reloaded with the next pointer event.
+    void OnDisplayChanged(int32_t displayId);
     void CheckInHotArea();
     void CheckPointerToEdge(HotAreaType type);
+    bool ShouldNotify();
     void NotifyMessage();
+    void NotifyNewListeners();
     void OnHotAreaMessage(HotAreaType msg, bool isEdge);
     void NotifyHotAreaMessage(int32_t pid, MessageId msgId, HotAreaType msg, bool isEdge);
 
 private:
     IContext *env_ { nullptr };
-    int32_t width_ { 720 };
-    int32_t height_ { 1280 };
+    sptr<DisplayListener> displayListener_ { nullptr };
+    bool geometryLoaded_ { false };
+    // Bumped on every display change, so a load that raced with a change does not count as current.
+    uint64_t geometryGeneration_ { 0 };
+    int32_t displayId_ { -1 };
+    int32_t width_ { -1 };
+    int32_t height_ { -1 };
+    Bands bands_ {};
     int32_t displayX_ { 0 };
     int32_t displayY_ { 0 };
     int32_t deltaX_ { 0 };
     int32_t deltaY_ { 0 };
     bool isEdge_ { false };
     HotAreaType type_ { HotAreaType::AREA_NONE };
+    bool notified_ { false };
+    HotAreaType notifiedType_ { HotAreaType::AREA_NONE };
+    bool notifiedEdge_ { false };
     std::mutex lock_;
     std::set<HotAreaInfo> callbacks_;
+    // Listeners added since the last notification, sent the current state with the next event.
+    std::set<int32_t> newListeners_;
 };
 } // namespace Cooperate
 } // namespace DeviceStatus
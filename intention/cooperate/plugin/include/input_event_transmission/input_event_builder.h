@@ -76,6 +76,8 @@ public:
 private:
     bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet);
     void OnPointerEvent(Msdp::NetPacket &packet);
+    void OnPointerStream(Msdp::NetPacket &packet);
+    void InjectPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnKeyEvent(Msdp::NetPacket &packet);
     bool UpdatePointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     bool IsActive(std::shared_ptr<MMI::PointerEvent> pointerEvent);
@@ -16,11 +16,16 @@
 #ifndef INPUT_EVENT_INTERCEPTOR_H
 #define INPUT_EVENT_INTERCEPTOR_H
 
+#include <atomic>
+#include <list>
+#include <mutex>
+
 #include "nocopyable.h"
 
-#include "channel.h"
+#include "ring_channel.h"
 #include "cooperate_events.h"
 #include "i_context.h"
+#include "input_event_transmission/pointer_stream.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -42,11 +47,25 @@ private:
     void OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent);
     void ReportPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void StreamPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void RestartPointerStream(std::list<NetPacket> &tail);
+    bool DrainPointerStream(std::list<NetPacket> &packets);
+    void SendStreamPackets(std::unique_lock<std::mutex> &guard, std::list<NetPacket> &packets);
+    void ArmFlushTimer(int32_t frameWindow);
+    void CancelFlushTimer();
+    void OnFlushTimer();
 
     IContext *env_ { nullptr };
     int32_t interceptorId_ { -1 };
     std::string remoteNetworkId_;
-    Channel<CooperateEvent>::Sender sender_;
+    RingChannel<CooperateEvent>::Sender sender_;
+    std::mutex streamLock_;
+    // Taken before streamLock_ is released, so that packets drained on different threads go out in order.
+    std::mutex sendLock_;
+    std::atomic<bool> streamMode_ { false };
+    bool flushTimerArmed_ { false };
+    std::atomic<int32_t> flushTimerId_ { -1 };
+    PointerStreamEncoder pointerStream_;
     static std::set<int32_t> filterKeys_;
     static std::set<int32_t> filterPointers_;
 };
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_STREAM_H
+#define POINTER_STREAM_H
+
+#include <functional>
+#include <set>
+#include <vector>
+
+#include "nocopyable.h"
+#include "net_packet.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+/**
+ * Coalesces mouse moves sent to the remote device into frames. The last pointer event sent in full is the
+ * baseline, later moves of the same device, pointer and pressed buttons are packed as varint deltas against
+ * it. A frame travels in a DSOFTBUS_INPUT_POINTER_EVENT packet and starts with POINTER_STREAM_MAGIC in place
+ * of the event type, so it can not be mistaken for a marshalled pointer event. Frames are only sent to peers
+ * that advertised PEER_CAPABILITY_POINTER_STREAM, older peers would drop them.
+ */
+class PointerStreamEncoder final {
+public:
+    static constexpr int32_t DEFAULT_FRAME_WINDOW_MS { 8 };
+    static constexpr size_t MAX_FRAME_SAMPLES { 64 };
+
+    PointerStreamEncoder() = default;
+    ~PointerStreamEncoder() = default;
+    DISALLOW_COPY_AND_MOVE(PointerStreamEncoder);
+
+    void SetFrameWindow(int32_t frameWindowMs);
+    int32_t GetFrameWindow() const;
+    // Records an event sent in full, moves that follow it are encoded against it.
+    void SetBaseline(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void Reset();
+
+    bool IsCoalescable(std::shared_ptr<MMI::PointerEvent> pointerEvent) const;
+    // Whether the event can join the pending frame, otherwise the frame must be flushed first.
+    bool Fits(std::shared_ptr<MMI::PointerEvent> pointerEvent) const;
+    void Append(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    bool HasPendingFrame() const;
+    bool IsFrameDue(int64_t actionTime) const;
+    int32_t Flush(NetPacket &packet);
+
+private:
+    struct Sample {
+        int32_t id;
+        int64_t actionTime;
+        int32_t rawDx;
+        int32_t rawDy;
+        int32_t displayX;
+        int32_t displayY;
+    };
+
+    int32_t frameWindowMs_ { DEFAULT_FRAME_WINDOW_MS };
+    bool hasBaseline_ { false };
+    int32_t deviceId_ { -1 };
+    int32_t pointerId_ { -1 };
+    std::set<int32_t> pressedButtons_;
+    int32_t lastId_ { 0 };
+    int32_t lastDisplayX_ { 0 };
+    int32_t lastDisplayY_ { 0 };
+    int32_t frameAction_ { MMI::PointerEvent::POINTER_ACTION_UNKNOWN };
+    std::vector<Sample> samples_;
+};
+
+class PointerStreamDecoder final {
+public:
+    PointerStreamDecoder() = delete;
+    DISALLOW_COPY_AND_MOVE(PointerStreamDecoder);
+
+    static bool IsStreamFrame(NetPacket &packet);
+    // Replays each move of the frame on pointerEvent, which must hold the baseline, calling onSample after each.
+    static int32_t Decode(NetPacket &packet, std::shared_ptr<MMI::PointerEvent> pointerEvent,
+        std::function<void()> onSample);
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // POINTER_STREAM_H
@@ -41,13 +41,13 @@ public:
 private:
     class AppStateObserver final : public AppExecFwk::ApplicationStateObserverStub {
     public:
-        AppStateObserver(Channel<CooperateEvent>::Sender sender, int32_t clientPid);
+        AppStateObserver(RingChannel<CooperateEvent>::Sender sender, int32_t clientPid);
         ~AppStateObserver() = default;
         void OnProcessDied(const AppExecFwk::ProcessData &processData) override;
         void UpdateClientPid(int32_t clientPid);
 
     private:
-        Channel<CooperateEvent>::Sender sender_;
+        RingChannel<CooperateEvent>::Sender sender_;
         int32_t clientPid_;
     };
 
@@ -85,7 +85,8 @@ private:
     void OnRemoteInputDevice(Context &context, const CooperateEvent &event);
     void Transfer(Context &context, const CooperateEvent &event);
     sptr<AppExecFwk::IAppMgr> GetAppMgr();
-    int32_t RegisterApplicationStateObserver(Channel<CooperateEvent>::Sender sender, const EnableCooperateEvent &event);
+    int32_t RegisterApplicationStateObserver(RingChannel<CooperateEvent>::Sender sender,
+        const EnableCooperateEvent &event);
     std::string GetPackageName(Security::AccessToken::AccessTokenID tokenId);
     void UnregisterApplicationStateObserver();
     void UpdateApplicationStateObserver(int32_t clientPid);
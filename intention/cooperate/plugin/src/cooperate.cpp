@@ -29,10 +29,13 @@ namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
+namespace {
+constexpr size_t MAX_EVENTS_PER_WAKEUP { 32 };
+} // namespace
 
 Cooperate::Cooperate(IContext *env) : env_(env), context_(env), sm_(env)
 {
-    auto [sender, receiver] = Channel<CooperateEvent>::OpenChannel();
+    auto [sender, receiver] = RingChannel<CooperateEvent>::OpenChannel();
     receiver_ = receiver;
     receiver_.Enable();
     context_.AttachSender(sender);
@@ -51,7 +54,7 @@ void Cooperate::AddObserver(std::shared_ptr<ICooperateObserver> observer)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::ADD_OBSERVER, AddObserverEvent { .observer = observer }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -61,7 +64,7 @@ void Cooperate::RemoveObserver(std::shared_ptr<ICooperateObserver> observer)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::REMOVE_OBSERVER, RemoveObserverEvent { .observer = observer }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -71,7 +74,7 @@ int32_t Cooperate::RegisterListener(int32_t pid)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::REGISTER_LISTENER, RegisterListenerEvent { .pid = pid }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -82,7 +85,7 @@ int32_t Cooperate::UnregisterListener(int32_t pid)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::UNREGISTER_LISTENER, UnregisterListenerEvent { .pid = pid }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -93,7 +96,7 @@ int32_t Cooperate::RegisterHotAreaListener(int32_t pid)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::REGISTER_HOTAREA_LISTENER, RegisterHotareaListenerEvent { .pid = pid }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -104,7 +107,7 @@ int32_t Cooperate::UnregisterHotAreaListener(int32_t pid)
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(
         CooperateEvent(CooperateEventType::UNREGISTER_HOTAREA_LISTENER, UnregisterHotareaListenerEvent { .pid = pid }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -119,7 +122,7 @@ int32_t Cooperate::Enable(int32_t tokenId, int32_t pid, int32_t userData)
             .pid = pid,
             .userData = userData,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -133,7 +136,7 @@ int32_t Cooperate::Disable(int32_t pid, int32_t userData)
             .pid = pid,
             .userData = userData,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -157,7 +160,7 @@ int32_t Cooperate::Start(int32_t pid, int32_t userData, const std::string &remot
     };
     auto errCode = event.errCode->get_future();
     auto ret = context_.Sender().Send(CooperateEvent(CooperateEventType::START, event));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return errCode.get();
@@ -172,7 +175,7 @@ int32_t Cooperate::Stop(int32_t pid, int32_t userData, bool isUnchained)
             .userData = userData,
             .isUnchained = isUnchained,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -187,7 +190,7 @@ int32_t Cooperate::GetCooperateState(int32_t pid, int32_t userData, const std::s
             .userData = userData,
             .networkId = networkId,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -201,7 +204,7 @@ int32_t Cooperate::RegisterEventListener(int32_t pid, const std::string &network
             .pid = pid,
             .networkId = networkId,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -215,7 +218,7 @@ int32_t Cooperate::UnregisterEventListener(int32_t pid, const std::string &netwo
             .pid = pid,
             .networkId = networkId,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -235,7 +238,7 @@ int32_t Cooperate::Update(uint32_t mask, uint32_t flag)
             .mask = mask,
             .flag = flag,
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     return RET_OK;
@@ -245,7 +248,7 @@ void Cooperate::Dump(int32_t fd)
 {
     CALL_DEBUG_ENTER;
     auto ret = context_.Sender().Send(CooperateEvent(CooperateEventType::DUMP, DumpEvent { .fd = fd }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -256,21 +259,30 @@ void Cooperate::Loop()
     bool running = true;
     SetThreadName("OS_Cooperate");
     LoadMotionDrag();
+    std::vector<CooperateEvent> events;
+    events.reserve(MAX_EVENTS_PER_WAKEUP);
+    size_t overflows = 0;
 
     while (running) {
-        CooperateEvent event = receiver_.Receive();
-        switch (event.type) {
-            case CooperateEventType::NOOP: {
-                break;
-            }
-            case CooperateEventType::QUIT: {
-                FI_HILOGI("Skip out of loop");
-                running = false;
-                break;
-            }
-            default: {
-                sm_.OnEvent(context_, event);
-                break;
+        receiver_.ReceiveBatch(events, MAX_EVENTS_PER_WAKEUP);
+        if (size_t total = receiver_.GetOverflowCount(); total != overflows) {
+            FI_HILOGW("Cooperate channel is full, %{public}zu events dropped", total - overflows);
+            overflows = total;
+        }
+        for (auto iter = events.cbegin(); running && (iter != events.cend()); ++iter) {
+            switch (iter->type) {
+                case CooperateEventType::NOOP: {
+                    break;
+                }
+                case CooperateEventType::QUIT: {
+                    FI_HILOGI("Skip out of loop");
+                    running = false;
+                    break;
+                }
+                default: {
+                    sm_.OnEvent(context_, *iter);
+                    break;
+                }
             }
         }
     }
@@ -294,7 +306,7 @@ void Cooperate::StopWorker()
     std::lock_guard guard(lock_);
     if (workerStarted_) {
         auto ret = context_.Sender().Send(CooperateEvent(CooperateEventType::QUIT));
-        if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
             FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
         }
         if (worker_.joinable()) {
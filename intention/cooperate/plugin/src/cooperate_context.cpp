@@ -38,7 +38,7 @@ constexpr double PERCENT { 100.0 };
 
 class BoardObserver final : public IBoardObserver {
 public:
-    explicit BoardObserver(Channel<CooperateEvent>::Sender sender) : sender_(sender) { }
+    explicit BoardObserver(RingChannel<CooperateEvent>::Sender sender) : sender_(sender) { }
     ~BoardObserver() = default;
     DISALLOW_COPY_AND_MOVE(BoardObserver);
 
@@ -47,7 +47,7 @@ public:
         FI_HILOGD("\'%{public}s\' is online", Utility::Anonymize(networkId).c_str());
         auto ret = sender_.Send(
             CooperateEvent(CooperateEventType::DDM_BOARD_ONLINE, DDMBoardOnlineEvent { .networkId = networkId }));
-        if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
             FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
         }
     }
@@ -57,25 +57,25 @@ public:
         FI_HILOGD("\'%{public}s\' is offline", Utility::Anonymize(networkId).c_str());
         auto ret = sender_.Send(
             CooperateEvent(CooperateEventType::DDM_BOARD_OFFLINE, DDMBoardOfflineEvent { .networkId = networkId }));
-        if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
             FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
         }
     }
 
 private:
-    Channel<CooperateEvent>::Sender sender_;
+    RingChannel<CooperateEvent>::Sender sender_;
 };
 
 class HotplugObserver final : public IDeviceObserver {
 public:
-    explicit HotplugObserver(Channel<CooperateEvent>::Sender sender) : sender_(sender) { }
+    explicit HotplugObserver(RingChannel<CooperateEvent>::Sender sender) : sender_(sender) { }
     ~HotplugObserver() = default;
 
     void OnDeviceAdded(std::shared_ptr<IDevice> dev) override;
     void OnDeviceRemoved(std::shared_ptr<IDevice> dev) override;
 
 private:
-    Channel<CooperateEvent>::Sender sender_;
+    RingChannel<CooperateEvent>::Sender sender_;
 };
 
 void HotplugObserver::OnDeviceAdded(std::shared_ptr<IDevice> dev)
@@ -87,7 +87,7 @@ void HotplugObserver::OnDeviceAdded(std::shared_ptr<IDevice> dev)
             .type = InputHotplugType::PLUG,
             .isKeyboard = dev->IsKeyboard(),
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -101,7 +101,7 @@ void HotplugObserver::OnDeviceRemoved(std::shared_ptr<IDevice> dev)
             .type = InputHotplugType::UNPLUG,
             .isKeyboard = dev->IsKeyboard(),
         }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -112,7 +112,7 @@ Context::Context(IContext *env)
 {
 }
 
-void Context::AttachSender(Channel<CooperateEvent>::Sender sender)
+void Context::AttachSender(RingChannel<CooperateEvent>::Sender sender)
 {
     sender_ = sender;
     dsoftbus_.AttachSender(sender);
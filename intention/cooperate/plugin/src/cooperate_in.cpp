@@ -399,7 +399,7 @@ void CooperateIn::RelayConfirmation::OnRemoteStart(Context &context, const Coope
     FI_HILOGI("[remote start] Notification from %{public}s", Utility::Anonymize(notice.networkId).c_str());
     if (parent_.process_.IsPeer(notice.networkId)) {
         auto ret = context.Sender().Send(event);
-        if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
             FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
         }
         OnReset(context, event);
@@ -408,7 +408,7 @@ void CooperateIn::RelayConfirmation::OnRemoteStart(Context &context, const Coope
     parent_.env_->GetTimerManager().AddTimer(
         DEFAULT_COOLING_TIME, REPEAT_ONCE, [sender = context.Sender(), event]() mutable {
             auto ret = sender.Send(event);
-            if (ret != Channel<CooperateEvent>::NO_ERROR) {
+            if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
                 FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
             }
         });
@@ -423,7 +423,7 @@ void CooperateIn::RelayConfirmation::OnRemoteStop(Context &context, const Cooper
     }
     FI_HILOGI("[remote stop] Notification from %{public}s", Utility::Anonymize(notice.networkId).c_str());
     auto ret = context.Sender().Send(event);
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
     OnReset(context, event);
@@ -553,7 +553,7 @@ void CooperateIn::RelayConfirmation::OnProgress(Context &context, const Cooperat
                     .networkId = remoteNetworkId,
                     .normal = false,
                 }));
-            if (ret != Channel<CooperateEvent>::NO_ERROR) {
+            if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
                 FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
             }
         });
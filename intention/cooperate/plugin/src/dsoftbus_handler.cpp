@@ -31,6 +31,7 @@ namespace DeviceStatus {
 namespace Cooperate {
 constexpr int32_t MAX_INPUT_DEV_NUM { 100 };
 constexpr int32_t INVALID_DEVICE_ID { -1 };
+constexpr uint32_t LOCAL_CAPABILITIES { PEER_CAPABILITY_POINTER_STREAM };
 
 DSoftbusHandler::DSoftbusHandler(IContext *env)
     : env_(env)
@@ -84,7 +85,7 @@ DSoftbusHandler::~DSoftbusHandler()
     env_->GetDSoftbus().RemoveObserver(observer_);
 }
 
-void DSoftbusHandler::AttachSender(Channel<CooperateEvent>::Sender sender)
+void DSoftbusHandler::AttachSender(RingChannel<CooperateEvent>::Sender sender)
 {
     CALL_DEBUG_ENTER;
     std::lock_guard guard(lock_);
@@ -119,7 +120,7 @@ int32_t DSoftbusHandler::StartCooperate(const std::string &networkId, const DSof
     CALL_INFO_TRACE;
     NetPacket packet(MessageId::DSOFTBUS_START_COOPERATE);
     packet << event.originNetworkId << event.cursorPos.x
-        << event.cursorPos.y << event.success << event.extra.priv;
+        << event.cursorPos.y << event.success << event.extra.priv << LOCAL_CAPABILITIES;
     if (packet.ChkRWError()) {
         FI_HILOGE("Failed to write data packet");
         return RET_ERR;
@@ -146,7 +147,8 @@ int32_t DSoftbusHandler::ComeBack(const std::string &networkId, const DSoftbusCo
 {
     CALL_INFO_TRACE;
     NetPacket packet(MessageId::DSOFTBUS_COME_BACK);
-    packet << event.originNetworkId << event.cursorPos.x << event.cursorPos.y << event.extra.priv;
+    packet << event.originNetworkId << event.cursorPos.x << event.cursorPos.y << event.extra.priv
+        << LOCAL_CAPABILITIES;
     if (packet.ChkRWError()) {
         FI_HILOGE("Failed to write data packet");
         return RET_ERR;
@@ -190,6 +192,13 @@ int32_t DSoftbusHandler::RelayCooperateFinish(const std::string &networkId, cons
     return ret;
 }
 
+uint32_t DSoftbusHandler::GetPeerCapabilities(const std::string &networkId)
+{
+    std::lock_guard guard(lock_);
+    auto iter = peerCapabilities_.find(networkId);
+    return (iter != peerCapabilities_.end()) ? iter->second : 0;
+}
+
 std::string DSoftbusHandler::GetLocalNetworkId()
 {
     return IDSoftbusAdapter::GetLocalNetworkId();
@@ -208,6 +217,7 @@ void DSoftbusHandler::OnBind(const std::string &networkId)
 void DSoftbusHandler::OnShutdown(const std::string &networkId)
 {
     FI_HILOGI("Connection with \'%{public}s\' shutdown", Utility::Anonymize(networkId).c_str());
+    RemovePeerCapabilities(networkId);
     SendEvent(CooperateEvent(
         CooperateEventType::DSOFTBUS_SESSION_CLOSED,
         DSoftbusSessionClosed {
@@ -243,14 +253,33 @@ void DSoftbusHandler::SendEvent(const CooperateEvent &event)
 {
     std::lock_guard guard(lock_);
     auto ret = sender_.Send(event);
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
 
+void DSoftbusHandler::ReadPeerCapabilities(const std::string &networkId, NetPacket &packet)
+{
+    uint32_t capabilities { 0 };
+    packet >> capabilities;
+    if (packet.ChkRWError()) {
+        capabilities = 0;
+    }
+    FI_HILOGI("Peer \'%{public}s\' capabilities:%{public}u", Utility::Anonymize(networkId).c_str(), capabilities);
+    std::lock_guard guard(lock_);
+    peerCapabilities_[networkId] = capabilities;
+}
+
+void DSoftbusHandler::RemovePeerCapabilities(const std::string &networkId)
+{
+    std::lock_guard guard(lock_);
+    peerCapabilities_.erase(networkId);
+}
+
 void DSoftbusHandler::OnCommunicationFailure(const std::string &networkId)
 {
     env_->GetDSoftbus().CloseSession(networkId);
+    RemovePeerCapabilities(networkId);
     FI_HILOGI("Notify communication failure with peer(%{public}s)", Utility::Anonymize(networkId).c_str());
     SendEvent(CooperateEvent(
         CooperateEventType::DSOFTBUS_SESSION_CLOSED,
@@ -275,6 +304,7 @@ void DSoftbusHandler::OnStartCooperate(const std::string &networkId, NetPacket &
     if (packet.ChkRWError()) {
         event.extra.priv = 0;
     }
+    ReadPeerCapabilities(networkId, packet);
     SendEvent(CooperateEvent(
         CooperateEventType::DSOFTBUS_START_COOPERATE,
         event));
@@ -308,6 +338,7 @@ void DSoftbusHandler::OnComeBack(const std::string &networkId, NetPacket &packet
     if (packet.ChkRWError()) {
         event.extra.priv = 0;
     }
+    ReadPeerCapabilities(networkId, packet);
     SendEvent(CooperateEvent(
         CooperateEventType::DSOFTBUS_COME_BACK,
         event));
@@ -41,6 +41,7 @@ void HotArea::AddListener(const RegisterHotareaListenerEvent &event)
         callbacks_.erase(iter);
         callbacks_.emplace(info);
     }
+    newListeners_.insert(event.pid);
 }
 
 void HotArea::RemoveListener(const UnregisterHotareaListenerEvent &event)
@@ -48,50 +49,133 @@ void HotArea::RemoveListener(const UnregisterHotareaListenerEvent &event)
     CALL_DEBUG_ENTER;
     std::lock_guard guard(lock_);
     callbacks_.erase(HotAreaInfo { .pid = event.pid });
+    newListeners_.erase(event.pid);
+}
+
+HotArea::~HotArea()
+{
+    if (displayListener_ != nullptr) {
+        Rosen::DisplayManagerLite::GetInstance().UnregisterDisplayListener(displayListener_);
+    }
 }
 
 void HotArea::EnableCooperate(const EnableCooperateEvent &event)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard guard(lock_);
+    if (displayListener_ == nullptr) {
+        displayListener_ = sptr<DisplayListener>::MakeSptr(*this);
+        if (Rosen::DisplayManagerLite::GetInstance().RegisterDisplayListener(displayListener_) !=
+            Rosen::DMError::DM_OK) {
+            FI_HILOGE("Failed to register display listener");
+            displayListener_ = nullptr;
+        }
+    }
     auto display = Rosen::DisplayManagerLite::GetInstance().GetDefaultDisplay();
     CHKPV(display);
-    width_ = display->GetWidth();
-    height_ = display->GetHeight();
+    std::lock_guard guard(lock_);
+    UpdateDisplayGeometry(static_cast<int32_t>(display->GetId()), display->GetWidth(), display->GetHeight());
 }
 
 int32_t HotArea::ProcessData(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard guard(lock_);
     CHKPR(pointerEvent, RET_ERR);
     MMI::PointerEvent::PointerItem pointerItem;
     if (!pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem)) {
         FI_HILOGE("Corrupted pointer event");
         return RET_ERR;
     }
+    if (NeedLoadDisplayGeometry(pointerEvent->GetTargetDisplayId())) {
+        LoadDisplayGeometry(pointerEvent->GetTargetDisplayId());
+    }
+    std::lock_guard guard(lock_);
     displayX_ = pointerItem.GetDisplayX();
     displayY_ = pointerItem.GetDisplayY();
     deltaX_ = pointerItem.GetRawDx();
     deltaY_ = pointerItem.GetRawDy();
     CheckInHotArea();
     CheckPointerToEdge(type_);
-    NotifyMessage();
+    if (ShouldNotify()) {
+        NotifyMessage();
+    } else if (!newListeners_.empty()) {
+        NotifyNewListeners();
+    }
     return RET_OK;
 }
 
+bool HotArea::NeedLoadDisplayGeometry(int32_t displayId)
+{
+    std::lock_guard guard(lock_);
+    return (!geometryLoaded_ || (displayId != displayId_));
+}
+
+void HotArea::LoadDisplayGeometry(int32_t displayId)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard guard(lock_);
+        generation = geometryGeneration_;
+    }
+    auto display = (displayId >= 0 ?
+        Rosen::DisplayManagerLite::GetInstance().GetDisplayById(static_cast<Rosen::DisplayId>(displayId)) :
+        Rosen::DisplayManagerLite::GetInstance().GetDefaultDisplay());
+    std::lock_guard guard(lock_);
+    if (display == nullptr) {
+        FI_HILOGE("No display information for display %{public}d", displayId);
+        displayId_ = displayId;
+    } else {
+        UpdateDisplayGeometry(displayId, display->GetWidth(), display->GetHeight());
+    }
+    geometryLoaded_ = (generation == geometryGeneration_);
+}
+
+void HotArea::OnDisplayChanged(int32_t displayId)
+{
+    std::lock_guard guard(lock_);
+    ++geometryGeneration_;
+    // A negative id stands for the default display, whichever id it has.
+    if ((displayId == displayId_) || (displayId_ < 0)) {
+        geometryLoaded_ = false;
+    }
+}
+
+void HotArea::UpdateDisplayGeometry(int32_t displayId, int32_t width, int32_t height)
+{
+    geometryLoaded_ = true;
+    displayId_ = displayId;
+    if ((width == width_) && (height == height_)) {
+        return;
+    }
+    FI_HILOGI("Display geometry:%{public}dx%{public}d", width, height);
+    width_ = width;
+    height_ = height;
+    bands_ = Bands {
+        .leftMax = HOT_AREA_WIDTH,
+        .rightMin = width - HOT_AREA_WIDTH,
+        .topMax = HOT_AREA_WIDTH,
+        .bottomMin = height - HOT_AREA_WIDTH,
+        .xMarginMin = HOT_AREA_MARGIN,
+        .xMarginMax = width - HOT_AREA_MARGIN,
+        .yMarginMin = HOT_AREA_MARGIN,
+        .yMarginMax = height - HOT_AREA_MARGIN,
+    };
+    notified_ = false;
+}
+
 void HotArea::CheckInHotArea()
 {
     CALL_DEBUG_ENTER;
-    if (displayX_ <= HOT_AREA_WIDTH && displayY_ >= HOT_AREA_MARGIN && displayY_ <= (height_ - HOT_AREA_MARGIN)) {
+    bool inYMargin = ((displayY_ >= bands_.yMarginMin) && (displayY_ <= bands_.yMarginMax));
+    bool inXMargin = ((displayX_ >= bands_.xMarginMin) && (displayX_ <= bands_.xMarginMax));
+    if (width_ < 0) {
+        type_ = HotAreaType::AREA_NONE;
+    } else if ((displayX_ <= bands_.leftMax) && inYMargin) {
         type_ = HotAreaType::AREA_LEFT;
-    } else if (displayX_ >= (width_ - HOT_AREA_WIDTH) && displayY_ >= HOT_AREA_MARGIN &&
-        displayY_ <= (height_ - HOT_AREA_MARGIN)) {
+    } else if ((displayX_ >= bands_.rightMin) && inYMargin) {
         type_ = HotAreaType::AREA_RIGHT;
-    } else if (displayY_ <= HOT_AREA_WIDTH && displayX_ >= HOT_AREA_MARGIN && displayX_ <= (width_ - HOT_AREA_MARGIN)) {
+    } else if ((displayY_ <= bands_.topMax) && inXMargin) {
         type_ = HotAreaType::AREA_TOP;
-    } else if (displayY_ >= (height_ - HOT_AREA_WIDTH) && displayX_ >= HOT_AREA_MARGIN &&
-        displayX_ <= (width_ - HOT_AREA_MARGIN)) {
+    } else if ((displayY_ >= bands_.bottomMin) && inXMargin) {
         type_ = HotAreaType::AREA_BOTTOM;
     } else {
         type_ = HotAreaType::AREA_NONE;
@@ -114,12 +198,39 @@ void HotArea::CheckPointerToEdge(HotAreaType type)
     }
 }
 
+bool HotArea::ShouldNotify()
+{
+    if (callbacks_.empty()) {
+        return false;
+    }
+    if (notified_ && (type_ == notifiedType_) && (isEdge_ == notifiedEdge_)) {
+        return false;
+    }
+    notified_ = true;
+    notifiedType_ = type_;
+    notifiedEdge_ = isEdge_;
+    return true;
+}
+
 void HotArea::NotifyMessage()
 {
     CALL_DEBUG_ENTER;
+    newListeners_.clear();
     OnHotAreaMessage(type_, isEdge_);
 }
 
+void HotArea::NotifyNewListeners()
+{
+    CALL_DEBUG_ENTER;
+    for (int32_t pid : newListeners_) {
+        auto iter = callbacks_.find(HotAreaInfo { .pid = pid });
+        if (iter != callbacks_.end()) {
+            NotifyHotAreaMessage(iter->pid, iter->msgId, type_, isEdge_);
+        }
+    }
+    newListeners_.clear();
+}
+
 void HotArea::OnHotAreaMessage(HotAreaType msg, bool isEdge)
 {
     CALL_DEBUG_ENTER;
@@ -131,7 +242,9 @@ void HotArea::OnHotAreaMessage(HotAreaType msg, bool isEdge)
 void HotArea::OnClientDied(const ClientDiedEvent &event)
 {
     FI_HILOGI("Remove client died listener, pid:%{public}d", event.pid);
+    std::lock_guard guard(lock_);
     callbacks_.erase(HotAreaInfo { .pid = event.pid });
+    newListeners_.erase(event.pid);
 }
 
 void HotArea::NotifyHotAreaMessage(int32_t pid, MessageId msgId, HotAreaType msg, bool isEdge)
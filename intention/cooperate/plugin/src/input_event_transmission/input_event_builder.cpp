@@ -20,6 +20,7 @@
 #include "cooperate_context.h"
 #include "devicestatus_define.h"
 #include "input_event_transmission/input_event_serialization.h"
+#include "input_event_transmission/pointer_stream.h"
 #include "utility.h"
 
 #undef LOG_TAG
@@ -125,6 +126,10 @@ bool InputEventBuilder::OnPacket(const std::string &networkId, Msdp::NetPacket &
 void InputEventBuilder::OnPointerEvent(Msdp::NetPacket &packet)
 {
     CHKPV(pointerEvent_);
+    if (PointerStreamDecoder::IsStreamFrame(packet)) {
+        OnPointerStream(packet);
+        return;
+    }
     pointerEvent_->Reset();
     int32_t ret = InputEventSerialization::Unmarshalling(packet, pointerEvent_);
     if (ret != RET_OK) {
@@ -142,6 +147,31 @@ void InputEventBuilder::OnPointerEvent(Msdp::NetPacket &packet)
     }
 }
 
+void InputEventBuilder::OnPointerStream(Msdp::NetPacket &packet)
+{
+    // Moves of the frame are replayed on the last pointer event received in full.
+    int32_t ret = PointerStreamDecoder::Decode(packet, pointerEvent_, [this]() {
+        InjectPointerEvent(pointerEvent_);
+    });
+    if (ret != RET_OK) {
+        FI_HILOGE("Failed to decode pointer stream");
+        return;
+    }
+    FI_HILOGD("PointerStream(No:%{public}d,Action:%{public}s)", pointerEvent_->GetId(),
+        pointerEvent_->DumpPointerAction());
+}
+
+void InputEventBuilder::InjectPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    if (!UpdatePointerEvent(pointerEvent)) {
+        return;
+    }
+    TagRemoteEvent(pointerEvent);
+    if (IsActive(pointerEvent)) {
+        env_->GetInput().SimulateInputEvent(pointerEvent);
+    }
+}
+
 void InputEventBuilder::OnKeyEvent(Msdp::NetPacket &packet)
 {
     CHKPV(keyEvent_);
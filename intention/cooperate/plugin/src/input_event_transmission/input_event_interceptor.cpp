@@ -58,6 +58,14 @@ void InputEventInterceptor::Enable(Context &context)
     FI_HILOGI("Cursor transite out at (%{private}d, %{private}d)", cursorPos.x, cursorPos.y);
     remoteNetworkId_ = context.Peer();
     sender_ = context.Sender();
+    {
+        std::lock_guard guard(streamLock_);
+        // Peers that did not advertise the stream in the handshake get one packet per event.
+        streamMode_ = ((context.CooperateFlag() & COOPERATE_FLAG_POINTER_STREAM) == COOPERATE_FLAG_POINTER_STREAM) &&
+            ((context.dsoftbus_.GetPeerCapabilities(remoteNetworkId_) & PEER_CAPABILITY_POINTER_STREAM) ==
+            PEER_CAPABILITY_POINTER_STREAM);
+        pointerStream_.Reset();
+    }
     interceptorId_ = env_->GetInput().AddInterceptor(
         [this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
             this->OnPointerEvent(pointerEvent);
@@ -77,10 +85,16 @@ void InputEventInterceptor::Disable()
         env_->GetInput().RemoveInterceptor(interceptorId_);
         interceptorId_ = -1;
     }
+    std::list<NetPacket> tail;
+    RestartPointerStream(tail);
+    CancelFlushTimer();
 }
 
 void InputEventInterceptor::Update(Context &context)
 {
+    std::list<NetPacket> tail;
+    RestartPointerStream(tail);
+    std::lock_guard guard(streamLock_);
     remoteNetworkId_ = context.Peer();
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
@@ -99,6 +113,10 @@ void InputEventInterceptor::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> po
         FI_HILOGI("Reset to origin action:%{public}d", static_cast<int32_t>(originAction));
         pointerEvent->SetPointerAction(originAction);
     }
+    if (streamMode_) {
+        StreamPointerEvent(pointerEvent);
+        return;
+    }
     NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
 
     int32_t ret = InputEventSerialization::Marshalling(pointerEvent, packet);
@@ -111,6 +129,111 @@ void InputEventInterceptor::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> po
     env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
 }
 
+void InputEventInterceptor::StreamPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    std::list<NetPacket> packets;
+    int32_t frameWindow = -1;
+    std::unique_lock guard(streamLock_);
+    if (pointerStream_.IsCoalescable(pointerEvent)) {
+        if (!pointerStream_.Fits(pointerEvent)) {
+            DrainPointerStream(packets);
+        }
+        pointerStream_.Append(pointerEvent);
+        if (pointerStream_.IsFrameDue(pointerEvent->GetActionTime())) {
+            DrainPointerStream(packets);
+        } else if (!flushTimerArmed_) {
+            flushTimerArmed_ = true;
+            frameWindow = pointerStream_.GetFrameWindow();
+        }
+    } else {
+        // Anything but a plain move is sent right away, after the moves that preceded it.
+        DrainPointerStream(packets);
+        NetPacket &packet = packets.emplace_back(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+        if (InputEventSerialization::Marshalling(pointerEvent, packet) != RET_OK) {
+            FI_HILOGE("Failed to serialize pointer event");
+            packets.pop_back();
+        } else {
+            FI_HILOGI("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)", pointerEvent->GetId(),
+                pointerEvent->DumpSourceType(), pointerEvent->DumpPointerAction());
+            pointerStream_.SetBaseline(pointerEvent);
+        }
+    }
+    SendStreamPackets(guard, packets);
+    if (frameWindow >= 0) {
+        ArmFlushTimer(frameWindow);
+    }
+}
+
+void InputEventInterceptor::RestartPointerStream(std::list<NetPacket> &tail)
+{
+    std::list<NetPacket> packets;
+    std::unique_lock guard(streamLock_);
+    DrainPointerStream(packets);
+    pointerStream_.Reset();
+    packets.splice(packets.end(), tail);
+    SendStreamPackets(guard, packets);
+}
+
+bool InputEventInterceptor::DrainPointerStream(std::list<NetPacket> &packets)
+{
+    if (!pointerStream_.HasPendingFrame()) {
+        return false;
+    }
+    NetPacket &packet = packets.emplace_back(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    if (pointerStream_.Flush(packet) != RET_OK) {
+        FI_HILOGE("Failed to serialize pointer stream");
+        packets.pop_back();
+        return false;
+    }
+    return true;
+}
+
+void InputEventInterceptor::SendStreamPackets(std::unique_lock<std::mutex> &guard, std::list<NetPacket> &packets)
+{
+    std::string peer = remoteNetworkId_;
+    std::lock_guard sendGuard(sendLock_);
+    guard.unlock();
+    for (auto &packet : packets) {
+        env_->GetDSoftbus().SendPacket(peer, packet);
+    }
+}
+
+void InputEventInterceptor::ArmFlushTimer(int32_t frameWindow)
+{
+    // Called without streamLock_: the timer manager syncs with the thread that runs OnFlushTimer.
+    int32_t timerId = env_->GetTimerManager().AddTimer(frameWindow, REPEAT_ONCE, [this]() {
+        OnFlushTimer();
+    });
+    if (timerId < 0) {
+        FI_HILOGE("Failed to add pointer stream timer");
+        std::lock_guard guard(streamLock_);
+        flushTimerArmed_ = false;
+        return;
+    }
+    flushTimerId_ = timerId;
+}
+
+void InputEventInterceptor::CancelFlushTimer()
+{
+    int32_t timerId = flushTimerId_.exchange(-1);
+    if (timerId >= 0) {
+        env_->GetTimerManager().RemoveTimer(timerId);
+    }
+    std::lock_guard guard(streamLock_);
+    flushTimerArmed_ = false;
+}
+
+void InputEventInterceptor::OnFlushTimer()
+{
+    // The timer is left running when a frame is drained before it fires, it then flushes the next frame early.
+    std::list<NetPacket> packets;
+    std::unique_lock guard(streamLock_);
+    flushTimerArmed_ = false;
+    flushTimerId_ = -1;
+    DrainPointerStream(packets);
+    SendStreamPackets(guard, packets);
+}
+
 void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
@@ -119,16 +242,25 @@ void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
         env_->GetInput().SimulateInputEvent(keyEvent);
         return;
     }
-    NetPacket packet(MessageId::DSOFTBUS_INPUT_KEY_EVENT);
+    std::list<NetPacket> packets;
+    NetPacket &packet = packets.emplace_back(MessageId::DSOFTBUS_INPUT_KEY_EVENT);
 
     int32_t ret = InputEventSerialization::KeyEventToNetPacket(keyEvent, packet);
     if (ret != RET_OK) {
         FI_HILOGE("Failed to serialize key event");
+        packets.clear();
+    } else {
+        FI_HILOGD("KeyEvent(No:%{public}d,Key:%{private}d,Action:%{public}d)", keyEvent->GetId(),
+            keyEvent->GetKeyCode(), keyEvent->GetKeyAction());
+    }
+    if (streamMode_) {
+        // The remote side resets its pointer state on key events, so the next move is sent in full.
+        RestartPointerStream(packets);
         return;
     }
-    FI_HILOGD("KeyEvent(No:%{public}d,Key:%{private}d,Action:%{public}d)", keyEvent->GetId(), keyEvent->GetKeyCode(),
-        keyEvent->GetKeyAction());
-    env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
+    if (!packets.empty()) {
+        env_->GetDSoftbus().SendPacket(remoteNetworkId_, packets.front());
+    }
 }
 
 void InputEventInterceptor::ReportPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
@@ -149,7 +281,7 @@ void InputEventInterceptor::ReportPointerEvent(std::shared_ptr<MMI::PointerEvent
                                     .y = pointerItem.GetDisplayY(),
                                     }
     }));
-    if (ret != Channel<CooperateEvent>::NO_ERROR) {
+    if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
         FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
     }
 }
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_transmission/pointer_stream.h"
+
+#include <algorithm>
+
+#include "securec.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PointerStream"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr int32_t POINTER_STREAM_MAGIC { 0x50535446 };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr uint32_t VARINT_PAYLOAD_BITS { 7 };
+constexpr uint8_t VARINT_PAYLOAD_MASK { 0x7F };
+constexpr uint8_t VARINT_CONTINUE { 0x80 };
+constexpr size_t MAX_VARINT_SIZE { 10 };
+// Id and time deltas plus four coordinate deltas per sample.
+constexpr size_t MAX_SAMPLE_SIZE { 6 * MAX_VARINT_SIZE };
+constexpr uint32_t MAX_FRAME_SIZE { MAX_VARINT_SIZE + PointerStreamEncoder::MAX_FRAME_SAMPLES * MAX_SAMPLE_SIZE };
+
+uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void WriteVarint(std::vector<uint8_t> &buf, uint64_t value)
+{
+    while (value > VARINT_PAYLOAD_MASK) {
+        buf.push_back(static_cast<uint8_t>(value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUE);
+        value >>= VARINT_PAYLOAD_BITS;
+    }
+    buf.push_back(static_cast<uint8_t>(value));
+}
+
+bool ReadVarint(const uint8_t *&pos, const uint8_t *end, uint64_t &value)
+{
+    value = 0;
+    for (uint32_t shift = 0; (pos < end) && (shift < MAX_VARINT_SIZE * VARINT_PAYLOAD_BITS);
+        shift += VARINT_PAYLOAD_BITS) {
+        uint8_t byte = *pos++;
+        value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << shift;
+        if ((byte & VARINT_CONTINUE) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadSigned(const uint8_t *&pos, const uint8_t *end, int64_t &value)
+{
+    uint64_t raw = 0;
+    if (!ReadVarint(pos, end, raw)) {
+        return false;
+    }
+    value = ZigZagDecode(raw);
+    return true;
+}
+
+bool IsMoveAction(int32_t pointerAction)
+{
+    return ((pointerAction == MMI::PointerEvent::POINTER_ACTION_MOVE) ||
+        (pointerAction == MMI::PointerEvent::POINTER_ACTION_PULL_MOVE));
+}
+} // namespace
+
+void PointerStreamEncoder::SetFrameWindow(int32_t frameWindowMs)
+{
+    frameWindowMs_ = std::max(frameWindowMs, 0);
+}
+
+int32_t PointerStreamEncoder::GetFrameWindow() const
+{
+    return frameWindowMs_;
+}
+
+void PointerStreamEncoder::SetBaseline(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    CHKPV(pointerEvent);
+    MMI::PointerEvent::PointerItem item;
+    if ((pointerEvent->GetSourceType() != MMI::PointerEvent::SOURCE_TYPE_MOUSE) ||
+        !pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), item)) {
+        Reset();
+        return;
+    }
+    hasBaseline_ = true;
+    deviceId_ = pointerEvent->GetDeviceId();
+    pointerId_ = pointerEvent->GetPointerId();
+    pressedButtons_ = pointerEvent->GetPressedButtons();
+    lastId_ = pointerEvent->GetId();
+    lastDisplayX_ = item.GetDisplayX();
+    lastDisplayY_ = item.GetDisplayY();
+}
+
+void PointerStreamEncoder::Reset()
+{
+    hasBaseline_ = false;
+    pressedButtons_.clear();
+    samples_.clear();
+}
+
+bool PointerStreamEncoder::IsCoalescable(std::shared_ptr<MMI::PointerEvent> pointerEvent) const
+{
+    CHKPF(pointerEvent);
+    if (!hasBaseline_ || (frameWindowMs_ == 0) ||
+        (pointerEvent->GetSourceType() != MMI::PointerEvent::SOURCE_TYPE_MOUSE) ||
+        !IsMoveAction(pointerEvent->GetPointerAction()) ||
+        (pointerEvent->GetDeviceId() != deviceId_) || (pointerEvent->GetPointerId() != pointerId_) ||
+        (pointerEvent->GetAxes() != 0) || (pointerEvent->GetPressedButtons() != pressedButtons_)) {
+        return false;
+    }
+    MMI::PointerEvent::PointerItem item;
+    return pointerEvent->GetPointerItem(pointerId_, item);
+}
+
+bool PointerStreamEncoder::Fits(std::shared_ptr<MMI::PointerEvent> pointerEvent) const
+{
+    CHKPF(pointerEvent);
+    return (samples_.empty() ||
+        ((samples_.size() < MAX_FRAME_SAMPLES) && (pointerEvent->GetPointerAction() == frameAction_)));
+}
+
+void PointerStreamEncoder::Append(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    CHKPV(pointerEvent);
+    MMI::PointerEvent::PointerItem item;
+    if (!pointerEvent->GetPointerItem(pointerId_, item)) {
+        FI_HILOGE("Corrupted pointer event");
+        return;
+    }
+    if (samples_.empty()) {
+        frameAction_ = pointerEvent->GetPointerAction();
+    }
+    samples_.push_back(Sample {
+        .id = pointerEvent->GetId(),
+        .actionTime = pointerEvent->GetActionTime(),
+        .rawDx = item.GetRawDx(),
+        .rawDy = item.GetRawDy(),
+        .displayX = item.GetDisplayX(),
+        .displayY = item.GetDisplayY(),
+    });
+}
+
+bool PointerStreamEncoder::HasPendingFrame() const
+{
+    return !samples_.empty();
+}
+
+bool PointerStreamEncoder::IsFrameDue(int64_t actionTime) const
+{
+    return (!samples_.empty() &&
+        ((samples_.size() >= MAX_FRAME_SAMPLES) ||
+        (actionTime - samples_.front().actionTime >= frameWindowMs_ * US_PER_MS)));
+}
+
+int32_t PointerStreamEncoder::Flush(NetPacket &packet)
+{
+    if (samples_.empty()) {
+        return RET_OK;
+    }
+    std::vector<uint8_t> buf;
+    buf.reserve(MAX_VARINT_SIZE + samples_.size() * MAX_SAMPLE_SIZE);
+    WriteVarint(buf, samples_.size());
+    int64_t baseTime = samples_.front().actionTime;
+    int64_t lastTime = baseTime;
+    for (const auto &sample : samples_) {
+        WriteVarint(buf, ZigZagEncode(static_cast<int64_t>(sample.id) - lastId_));
+        WriteVarint(buf, ZigZagEncode(sample.actionTime - lastTime));
+        WriteVarint(buf, ZigZagEncode(sample.rawDx));
+        WriteVarint(buf, ZigZagEncode(sample.rawDy));
+        WriteVarint(buf, ZigZagEncode(static_cast<int64_t>(sample.displayX) - lastDisplayX_));
+        WriteVarint(buf, ZigZagEncode(static_cast<int64_t>(sample.displayY) - lastDisplayY_));
+        lastId_ = sample.id;
+        lastTime = sample.actionTime;
+        lastDisplayX_ = sample.displayX;
+        lastDisplayY_ = sample.displayY;
+    }
+    samples_.clear();
+    packet << POINTER_STREAM_MAGIC << frameAction_ << baseTime << static_cast<uint32_t>(buf.size());
+    packet.Write(reinterpret_cast<const char *>(buf.data()), buf.size());
+    if (packet.ChkRWError()) {
+        FI_HILOGE("Failed to write pointer stream frame");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+bool PointerStreamDecoder::IsStreamFrame(NetPacket &packet)
+{
+    int32_t magic = 0;
+    if (packet.UnreadSize() < static_cast<int32_t>(sizeof(magic))) {
+        return false;
+    }
+    if (memcpy_s(&magic, sizeof(magic), packet.ReadBuf(), sizeof(magic)) != EOK) {
+        return false;
+    }
+    return (magic == POINTER_STREAM_MAGIC);
+}
+
+int32_t PointerStreamDecoder::Decode(NetPacket &packet, std::shared_ptr<MMI::PointerEvent> pointerEvent,
+    std::function<void()> onSample)
+{
+    CHKPR(pointerEvent, RET_ERR);
+    int32_t magic = 0;
+    int32_t pointerAction = MMI::PointerEvent::POINTER_ACTION_UNKNOWN;
+    int64_t lastTime = 0;
+    uint32_t size = 0;
+    packet >> magic >> pointerAction >> lastTime >> size;
+    if (packet.ChkRWError() || (magic != POINTER_STREAM_MAGIC) || (size > MAX_FRAME_SIZE) ||
+        !IsMoveAction(pointerAction)) {
+        FI_HILOGE("Corrupted pointer stream frame");
+        return RET_ERR;
+    }
+    std::vector<uint8_t> buf(size);
+    if (!packet.Read(reinterpret_cast<char *>(buf.data()), size)) {
+        FI_HILOGE("Truncated pointer stream frame");
+        return RET_ERR;
+    }
+    int32_t pointerId = pointerEvent->GetPointerId();
+    MMI::PointerEvent::PointerItem item;
+    if (!pointerEvent->GetPointerItem(pointerId, item)) {
+        FI_HILOGE("No baseline for pointer stream");
+        return RET_ERR;
+    }
+    const uint8_t *pos = buf.data();
+    const uint8_t *end = pos + buf.size();
+    uint64_t count = 0;
+    if (!ReadVarint(pos, end, count) || (count > PointerStreamEncoder::MAX_FRAME_SAMPLES)) {
+        FI_HILOGE("Corrupted pointer stream frame");
+        return RET_ERR;
+    }
+    int64_t values[] = { 0, 0, 0, 0, 0, 0 };
+    for (uint64_t index = 0; index < count; ++index) {
+        for (auto &value : values) {
+            if (!ReadSigned(pos, end, value)) {
+                FI_HILOGE("Truncated pointer stream sample");
+                return RET_ERR;
+            }
+        }
+        auto [dId, dTime, rawDx, rawDy, dx, dy] = values;
+        lastTime += dTime;
+        item.SetRawDx(static_cast<int32_t>(rawDx));
+        item.SetRawDy(static_cast<int32_t>(rawDy));
+        item.SetDisplayX(item.GetDisplayX() + static_cast<int32_t>(dx));
+        item.SetDisplayY(item.GetDisplayY() + static_cast<int32_t>(dy));
+        pointerEvent->UpdatePointerItem(pointerId, item);
+        pointerEvent->SetId(pointerEvent->GetId() + static_cast<int32_t>(dId));
+        pointerEvent->SetPointerAction(pointerAction);
+        pointerEvent->SetActionTime(lastTime);
+        pointerEvent->SetSensorInputTime(static_cast<uint64_t>(lastTime));
+        if (onSample != nullptr) {
+            onSample();
+        }
+    }
+    return RET_OK;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -38,7 +38,7 @@ namespace Msdp {
 namespace DeviceStatus {
 namespace Cooperate {
 
-StateMachine::AppStateObserver::AppStateObserver(Channel<CooperateEvent>::Sender sender, int32_t clientPid)
+StateMachine::AppStateObserver::AppStateObserver(RingChannel<CooperateEvent>::Sender sender, int32_t clientPid)
     : sender_(sender), clientPid_(clientPid) {}
 
 void StateMachine::AppStateObserver::OnProcessDied(const AppExecFwk::ProcessData &processData)
@@ -50,7 +50,7 @@ void StateMachine::AppStateObserver::OnProcessDied(const AppExecFwk::ProcessData
             ClientDiedEvent {
                 .pid = clientPid_,
             }));
-        if (ret != Channel<CooperateEvent>::NO_ERROR) {
+        if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
             FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
         }
         FI_HILOGI("Report to handler");
@@ -481,7 +481,7 @@ sptr<AppExecFwk::IAppMgr> StateMachine::GetAppMgr()
     return iface_cast<AppExecFwk::IAppMgr>(appMgrObj);
 }
 
-int32_t StateMachine::RegisterApplicationStateObserver(Channel<CooperateEvent>::Sender sender,
+int32_t StateMachine::RegisterApplicationStateObserver(RingChannel<CooperateEvent>::Sender sender,
     const EnableCooperateEvent &event)
 {
     CALL_INFO_TRACE;
@@ -611,7 +611,7 @@ void StateMachine::AddMonitor(Context &context)
                         .y = pointerItem.GetDisplayY(),
                     }
                 }));
-            if (ret != Channel<CooperateEvent>::NO_ERROR) {
+            if (ret != RingChannel<CooperateEvent>::NO_ERROR) {
                 FI_HILOGE("Failed to send event via channel, error:%{public}d", ret);
             }
         });
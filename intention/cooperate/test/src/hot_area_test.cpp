@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "devicestatus_define.h"
+#include "hot_area.h"
+#include "socket_session.h"
+#include "test_context.h"
+
+#undef LOG_TAG
+#define LOG_TAG "HotAreaTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+using namespace testing::ext;
+namespace {
+constexpr int32_t DISPLAY_ID { 0 };
+constexpr int32_t DISPLAY_WIDTH { 1000 };
+constexpr int32_t DISPLAY_HEIGHT { 2000 };
+constexpr int32_t CLIENT_PID { 100 };
+constexpr int32_t STEP { 50 };
+constexpr int32_t HOT_AREA_WIDTH { 100 };
+constexpr int32_t N_PUSHES { 5 };
+constexpr int64_t EVENT_INTERVAL_US { 1000 };
+constexpr size_t RECV_BUF_SIZE { 4096 };
+
+std::shared_ptr<MMI::PointerEvent> CreateMouseEvent(int32_t x, int32_t y, int32_t dx, int32_t dy, int64_t actionTime)
+{
+    auto pointerEvent = MMI::PointerEvent::Create();
+    CHKPP(pointerEvent);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    pointerEvent->SetTargetDisplayId(DISPLAY_ID);
+    pointerEvent->SetActionTime(actionTime);
+    pointerEvent->SetPointerId(0);
+    MMI::PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(x);
+    item.SetDisplayY(y);
+    item.SetRawDx(dx);
+    item.SetRawDy(dy);
+    pointerEvent->AddPointerItem(item);
+    return pointerEvent;
+}
+} // namespace
+
+class HotAreaTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        int32_t sockFds[2] { -1, -1 };
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockFds), 0);
+        clientFd_ = sockFds[1];
+        auto session = std::make_shared<SocketSession>("HotAreaTest", 0, TokenType::TOKEN_NATIVE, sockFds[0],
+            getuid(), CLIENT_PID);
+        ASSERT_TRUE(env_.socketSessionMgr_.AddSession(session));
+        hotArea_ = std::make_unique<HotArea>(&env_);
+        hotArea_->UpdateDisplayGeometry(DISPLAY_ID, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        hotArea_->AddListener(RegisterHotareaListenerEvent { .pid = CLIENT_PID });
+    }
+
+    void TearDown()
+    {
+        hotArea_.reset();
+        if (clientFd_ >= 0) {
+            ::close(clientFd_);
+            clientFd_ = -1;
+        }
+    }
+
+    // Moves the pointer to (x, y) with the given motion and counts hot area state transitions.
+    void MoveTo(int32_t x, int32_t y, int32_t dx, int32_t dy)
+    {
+        actionTime_ += EVENT_INTERVAL_US;
+        auto pointerEvent = CreateMouseEvent(x, y, dx, dy, actionTime_);
+        ASSERT_NE(pointerEvent, nullptr);
+        ASSERT_EQ(hotArea_->ProcessData(pointerEvent), RET_OK);
+        ++nEvents_;
+        if (!hasState_ || (hotArea_->type_ != type_) || (hotArea_->isEdge_ != isEdge_)) {
+            hasState_ = true;
+            type_ = hotArea_->type_;
+            isEdge_ = hotArea_->isEdge_;
+            ++nTransitions_;
+        }
+    }
+
+    // Sweeps from the center of the display to (edgeX, edgeY), pushes against it and comes back.
+    void Sweep(int32_t edgeX, int32_t edgeY)
+    {
+        int32_t centerX = DISPLAY_WIDTH / 2;
+        int32_t centerY = DISPLAY_HEIGHT / 2;
+        int32_t nSteps = std::max(std::abs(edgeX - centerX), std::abs(edgeY - centerY)) / STEP;
+        int32_t dx = (edgeX - centerX) / nSteps;
+        int32_t dy = (edgeY - centerY) / nSteps;
+        for (int32_t step = 1; step <= nSteps; ++step) {
+            MoveTo(centerX + dx * step, centerY + dy * step, dx, dy);
+        }
+        for (int32_t push = 0; push < N_PUSHES; ++push) {
+            MoveTo(edgeX, edgeY, dx, dy);
+        }
+        for (int32_t step = nSteps - 1; step >= 0; --step) {
+            MoveTo(centerX + dx * step, centerY + dy * step, -dx, -dy);
+        }
+    }
+
+    size_t ReceivedBytes()
+    {
+        return ReceivedBytes(clientFd_);
+    }
+
+    static size_t ReceivedBytes(int32_t fd)
+    {
+        char buf[RECV_BUF_SIZE];
+        size_t total = 0;
+        for (ssize_t nBytes = ::recv(fd, buf, sizeof(buf), 0); nBytes > 0;
+            nBytes = ::recv(fd, buf, sizeof(buf), 0)) {
+            total += static_cast<size_t>(nBytes);
+        }
+        return total;
+    }
+
+    TestContext env_;
+    std::unique_ptr<HotArea> hotArea_;
+    int32_t clientFd_ { -1 };
+    int64_t actionTime_ { 0 };
+    size_t nEvents_ { 0 };
+    size_t nTransitions_ { 0 };
+    bool hasState_ { false };
+    HotAreaType type_ { HotAreaType::AREA_NONE };
+    bool isEdge_ { false };
+};
+
+/**
+ * @tc.name: HotAreaTest_Sweep_001
+ * @tc.desc: Replay a mouse sweep across all four edges, listeners are only notified on state transitions
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(HotAreaTest, HotAreaTest_Sweep_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MoveTo(DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2, 0, 0);
+    size_t packetSize = ReceivedBytes();
+    ASSERT_GT(packetSize, 0U);
+
+    Sweep(0, DISPLAY_HEIGHT / 2);
+    Sweep(DISPLAY_WIDTH - 1, DISPLAY_HEIGHT / 2);
+    Sweep(DISPLAY_WIDTH / 2, 0);
+    Sweep(DISPLAY_WIDTH / 2, DISPLAY_HEIGHT - 1);
+    size_t nMessages = 1 + ReceivedBytes() / packetSize;
+    FI_HILOGI("%{public}zu pointer events, %{public}zu hot area messages", nEvents_, nMessages);
+    // Entering the band, reaching the edge, leaving the edge and leaving the band, on each of the four edges.
+    constexpr size_t nExpected { 1 + 4 * 4 };
+    EXPECT_EQ(nTransitions_, nExpected);
+    EXPECT_EQ(nMessages, nExpected);
+    EXPECT_LT(nMessages, nEvents_);
+}
+
+/**
+ * @tc.name: HotAreaTest_AddListener_001
+ * @tc.desc: A listener added while the state holds gets the current state once, existing listeners get nothing
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(HotAreaTest, HotAreaTest_AddListener_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    MoveTo(0, DISPLAY_HEIGHT / 2, -STEP, 0);
+    size_t packetSize = ReceivedBytes();
+    ASSERT_GT(packetSize, 0U);
+
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockFds), 0);
+    constexpr int32_t newPid { CLIENT_PID + 1 };
+    auto session = std::make_shared<SocketSession>("HotAreaTest", 0, TokenType::TOKEN_NATIVE, sockFds[0],
+        getuid(), newPid);
+    ASSERT_TRUE(env_.socketSessionMgr_.AddSession(session));
+    hotArea_->AddListener(RegisterHotareaListenerEvent { .pid = newPid });
+    for (int32_t push = 0; push < N_PUSHES; ++push) {
+        MoveTo(0, DISPLAY_HEIGHT / 2, -STEP, 0);
+    }
+    EXPECT_EQ(ReceivedBytes(), 0U);
+    EXPECT_EQ(ReceivedBytes(sockFds[1]), packetSize);
+    ::close(sockFds[1]);
+}
+
+/**
+ * @tc.name: HotAreaTest_DisplayChanged_001
+ * @tc.desc: A change of the current display marks the band geometry for reload, other displays do not
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(HotAreaTest, HotAreaTest_DisplayChanged_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EXPECT_FALSE(hotArea_->NeedLoadDisplayGeometry(DISPLAY_ID));
+    hotArea_->OnDisplayChanged(DISPLAY_ID + 1);
+    EXPECT_FALSE(hotArea_->NeedLoadDisplayGeometry(DISPLAY_ID));
+    hotArea_->OnDisplayChanged(DISPLAY_ID);
+    EXPECT_TRUE(hotArea_->NeedLoadDisplayGeometry(DISPLAY_ID));
+    hotArea_->UpdateDisplayGeometry(DISPLAY_ID, DISPLAY_HEIGHT, DISPLAY_WIDTH);
+    EXPECT_FALSE(hotArea_->NeedLoadDisplayGeometry(DISPLAY_ID));
+    EXPECT_EQ(hotArea_->bands_.rightMin, DISPLAY_HEIGHT - HOT_AREA_WIDTH);
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
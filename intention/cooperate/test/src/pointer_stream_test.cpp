@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "devicestatus_define.h"
+#include "fi_log.h"
+#include "input_event_transmission/input_event_builder.h"
+#include "input_event_transmission/input_event_interceptor.h"
+#include "input_event_transmission/pointer_stream.h"
+#include "test_context.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PointerStreamTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+using namespace testing::ext;
+namespace {
+const std::string PEER_NETWORK_ID { "pointer_stream_peer" };
+constexpr int32_t MOUSE_DEVICE_ID { 1 };
+constexpr int32_t REPORT_RATE { 1000 };
+constexpr int64_t REPORT_INTERVAL_US { 1000 };
+constexpr int64_t START_TIME_US { 1000000 };
+constexpr int32_t STEP_X { 3 };
+constexpr int32_t STEP_Y { -1 };
+
+struct ReceivedEvent {
+    int32_t pointerAction;
+    int32_t rawDx;
+    int32_t rawDy;
+};
+
+class LoopbackDSoftbus final : public IDSoftbusAdapter {
+public:
+    int32_t Enable() override
+    {
+        return RET_OK;
+    }
+
+    void Disable() override {}
+
+    void AddObserver(std::shared_ptr<IDSoftbusObserver> observer) override
+    {
+        observers_.push_back(observer);
+    }
+
+    void RemoveObserver(std::shared_ptr<IDSoftbusObserver> observer) override {}
+
+    int32_t OpenSession(const std::string &networkId) override
+    {
+        return RET_OK;
+    }
+
+    void CloseSession(const std::string &networkId) override {}
+    void CloseAllSessions() override {}
+
+    int32_t SendPacket(const std::string &networkId, NetPacket &packet) override
+    {
+        std::lock_guard guard(lock_);
+        ++packets_;
+        bytes_ += packet.Size();
+        for (const auto &observer : observers_) {
+            observer->OnPacket(networkId, packet);
+        }
+        return RET_OK;
+    }
+
+    int32_t SendParcel(const std::string &networkId, Parcel &parcel) override
+    {
+        return RET_OK;
+    }
+
+    int32_t BroadcastPacket(NetPacket &packet) override
+    {
+        return RET_OK;
+    }
+
+    std::mutex lock_;
+    size_t packets_ { 0 };
+    size_t bytes_ { 0 };
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers_;
+};
+
+class CaptureInputAdapter final : public MockInputAdapter {
+public:
+    using MockInputAdapter::SimulateInputEvent;
+
+    void SimulateInputEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent) override
+    {
+        MMI::PointerEvent::PointerItem item;
+        pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), item);
+        events_.push_back(ReceivedEvent {
+            .pointerAction = pointerEvent->GetPointerAction(),
+            .rawDx = item.GetRawDx(),
+            .rawDy = item.GetRawDy(),
+        });
+    }
+
+    std::vector<ReceivedEvent> events_;
+};
+
+std::shared_ptr<MMI::PointerEvent> CreateMouseEvent(int32_t id, int32_t pointerAction, int32_t displayX,
+    bool leftPressed = false)
+{
+    auto pointerEvent = MMI::PointerEvent::Create();
+    CHKPP(pointerEvent);
+    pointerEvent->SetId(id);
+    pointerEvent->SetDeviceId(MOUSE_DEVICE_ID);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(pointerAction);
+    pointerEvent->SetActionTime(START_TIME_US + id * REPORT_INTERVAL_US);
+    pointerEvent->SetPointerId(0);
+    if (pointerAction == MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN) {
+        pointerEvent->SetButtonId(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+    }
+    if (leftPressed) {
+        pointerEvent->SetButtonPressed(MMI::PointerEvent::MOUSE_BUTTON_LEFT);
+    }
+    MMI::PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(displayX);
+    item.SetRawDx(STEP_X);
+    item.SetRawDy(STEP_Y);
+    pointerEvent->AddPointerItem(item);
+    return pointerEvent;
+}
+} // namespace
+
+class PointerStreamTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        auto dsoftbus = std::make_unique<LoopbackDSoftbus>();
+        dsoftbus_ = dsoftbus.get();
+        env_.dsoftbus_ = std::move(dsoftbus);
+        auto input = std::make_unique<CaptureInputAdapter>();
+        input_ = input.get();
+        env_.input_ = std::move(input);
+        builder_ = std::make_unique<InputEventBuilder>(&env_);
+        builder_->remoteNetworkId_ = PEER_NETWORK_ID;
+        env_.GetDSoftbus().AddObserver(builder_->observer_);
+        interceptor_ = std::make_unique<InputEventInterceptor>(&env_);
+        interceptor_->remoteNetworkId_ = PEER_NETWORK_ID;
+    }
+
+    void TearDown()
+    {
+        interceptor_.reset();
+        builder_.reset();
+    }
+
+    // Sends count mouse moves, reported at 1000 Hz, through the interceptor.
+    void SendMoves(int32_t firstId, int32_t count, bool leftPressed = false)
+    {
+        for (int32_t id = firstId; id < firstId + count; ++id) {
+            auto pointerEvent = CreateMouseEvent(id, MMI::PointerEvent::POINTER_ACTION_MOVE, id * STEP_X, leftPressed);
+            ASSERT_NE(pointerEvent, nullptr);
+            interceptor_->OnPointerEvent(pointerEvent);
+        }
+    }
+
+    TestContext env_;
+    LoopbackDSoftbus *dsoftbus_ { nullptr };
+    CaptureInputAdapter *input_ { nullptr };
+    std::unique_ptr<InputEventBuilder> builder_;
+    std::unique_ptr<InputEventInterceptor> interceptor_;
+};
+
+/**
+ * @tc.name: PointerStreamTest_Loopback_001
+ * @tc.desc: Verify streamed moves are replayed in order with their motion and buttons are not delayed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerStreamTest, PointerStreamTest_Loopback_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    interceptor_->streamMode_ = true;
+    interceptor_->pointerStream_.SetFrameWindow(PointerStreamEncoder::DEFAULT_FRAME_WINDOW_MS);
+    constexpr int32_t nMoves { 20 };
+    SendMoves(0, nMoves);
+    auto buttonDown = CreateMouseEvent(nMoves, MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN, nMoves * STEP_X, true);
+    ASSERT_NE(buttonDown, nullptr);
+    interceptor_->OnPointerEvent(buttonDown);
+    size_t received = input_->events_.size();
+    ASSERT_EQ(received, static_cast<size_t>(nMoves + 1));
+    EXPECT_EQ(input_->events_.back().pointerAction, MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+
+    SendMoves(nMoves + 1, nMoves, true);
+    interceptor_->Disable();
+    ASSERT_EQ(input_->events_.size(), received + nMoves);
+    for (const auto &event : input_->events_) {
+        if (event.pointerAction == MMI::PointerEvent::POINTER_ACTION_MOVE) {
+            EXPECT_EQ(event.rawDx, STEP_X);
+            EXPECT_EQ(event.rawDy, STEP_Y);
+        }
+    }
+    EXPECT_LT(dsoftbus_->packets_, static_cast<size_t>(nMoves));
+}
+
+/**
+ * @tc.name: PointerStreamTest_Bandwidth_001
+ * @tc.desc: Measure bytes and packets per second for 1000 Hz mouse input with and without the stream mode
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(PointerStreamTest, PointerStreamTest_Bandwidth_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    SendMoves(0, REPORT_RATE);
+    size_t packets = dsoftbus_->packets_;
+    size_t bytes = dsoftbus_->bytes_;
+    EXPECT_EQ(input_->events_.size(), static_cast<size_t>(REPORT_RATE));
+
+    dsoftbus_->packets_ = 0;
+    dsoftbus_->bytes_ = 0;
+    input_->events_.clear();
+    interceptor_->streamMode_ = true;
+    SendMoves(REPORT_RATE, REPORT_RATE);
+    interceptor_->Disable();
+    EXPECT_EQ(input_->events_.size(), static_cast<size_t>(REPORT_RATE));
+    FI_HILOGI("1000 Hz mouse input, per second: %{public}zu packets %{public}zu bytes, stream mode with "
+        "%{public}d ms frames: %{public}zu packets %{public}zu bytes", packets, bytes,
+        interceptor_->pointerStream_.GetFrameWindow(), dsoftbus_->packets_, dsoftbus_->bytes_);
+    EXPECT_LT(dsoftbus_->packets_ * PointerStreamEncoder::DEFAULT_FRAME_WINDOW_MS, packets * 2);
+    EXPECT_LT(dsoftbus_->bytes_, bytes);
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
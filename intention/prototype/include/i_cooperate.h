@@ -30,6 +30,7 @@ using NormalizedCoordinate = Coordinate;
 
 constexpr uint32_t COOPERATE_FLAG_HIDE_CURSOR { 0x1 };
 constexpr uint32_t COOPERATE_FLAG_FREEZE_CURSOR { 0x2 };
+constexpr uint32_t COOPERATE_FLAG_POINTER_STREAM { 0x4 };
 
 struct StartCooperateData {
     uint32_t flag;
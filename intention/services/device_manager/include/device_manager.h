@@ -63,6 +63,9 @@ private:
 
         void AddDevice(const std::string &devNode) override;
         void RemoveDevice(const std::string &devNode) override;
+        std::shared_ptr<IDevice> ProbeDevice(const std::string &devNode) override;
+        void AddProbedDevice(const std::string &devNode, std::shared_ptr<IDevice> dev) override;
+        bool HasDevice(const std::string &devNode) override;
 
     private:
         DeviceManager &devMgr_;
@@ -73,7 +76,7 @@ private:
     int32_t OnEnable();
     int32_t OnDisable();
     int32_t OnEpollDispatch(uint32_t events);
-    int32_t ParseDeviceId(const std::string &devNode);
+    static int32_t ParseDeviceId(const std::string &devNode);
     void OnDeviceRemoved(std::shared_ptr<IDevice> dev);
     void OnDeviceAdded(std::shared_ptr<IDevice> dev);
     int32_t OnAddDeviceObserver(std::weak_ptr<IDeviceObserver> observer);
@@ -82,6 +85,8 @@ private:
     int32_t RunGetDevice(std::packaged_task<std::shared_ptr<IDevice>(int32_t)> &task, int32_t id) const;
     std::shared_ptr<IDevice> OnGetDevice(int32_t id) const;
     std::shared_ptr<IDevice> AddDevice(const std::string &devNode);
+    static std::shared_ptr<IDevice> ProbeDevice(const std::string &devNode);
+    std::shared_ptr<IDevice> AddProbedDevice(std::shared_ptr<IDevice> dev);
     std::shared_ptr<IDevice> RemoveDevice(const std::string &devNode);
     std::shared_ptr<IDevice> FindDevice(const std::string &devPath);
 
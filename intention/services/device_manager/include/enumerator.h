@@ -16,7 +16,10 @@
 #ifndef ENUMERATOR_H
 #define ENUMERATOR_H
 
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "nocopyable.h"
 
@@ -36,7 +39,9 @@ public:
 
 private:
     void ScanAndAddDevices();
-    void AddDevice(const std::string &devNode) const;
+    std::vector<std::string> CollectDeviceNodes(const std::string &inputPath) const;
+    void RemoveKnownDevices(std::vector<std::string> &devNodes) const;
+    std::vector<std::shared_ptr<IDevice>> ProbeDevices(const std::vector<std::string> &devNodes) const;
 
 private:
     IDeviceMgr *devMgr_ { nullptr };
@@ -16,6 +16,11 @@
 #ifndef I_DEVICE_MGR_H
 #define I_DEVICE_MGR_H
 
+#include <memory>
+#include <string>
+
+#include "i_device.h"
+
 class IDeviceMgr {
 public:
     IDeviceMgr() = default;
@@ -23,6 +28,25 @@ public:
 
     virtual void AddDevice(const std::string &devNode) = 0;
     virtual void RemoveDevice(const std::string &devNode) = 0;
+
+    // Opens and queries devNode without touching the state of the manager, may be called concurrently.
+    virtual std::shared_ptr<OHOS::Msdp::DeviceStatus::IDevice> ProbeDevice([[maybe_unused]] const std::string &devNode)
+    {
+        return nullptr;
+    }
+
+    // Adds a device returned by ProbeDevice(). Managers that do not probe add devNode by itself.
+    virtual void AddProbedDevice(const std::string &devNode,
+        [[maybe_unused]] std::shared_ptr<OHOS::Msdp::DeviceStatus::IDevice> dev)
+    {
+        AddDevice(devNode);
+    }
+
+    // Whether devNode was added already, so that scanning does not probe it again.
+    virtual bool HasDevice([[maybe_unused]] const std::string &devNode)
+    {
+        return false;
+    }
 };
 
 #endif // I_DEVICE_MGR_H
\ No newline at end of file
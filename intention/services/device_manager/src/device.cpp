@@ -17,13 +17,16 @@
 
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <regex>
 #include <sstream>
+#include <unordered_map>
 
 #include <openssl/sha.h>
 #include <securec.h>
@@ -55,6 +58,63 @@ const struct Range KEY_BLOCKS[] {
     { KEY_OK, BTN_DPAD_UP },
     { KEY_ALS_TOGGLE, BTN_TRIGGER_HAPPY }
 };
+
+// Parsed config files by path. Devices of the same vendor, product, version and name share a config file,
+// and devices are probed concurrently at startup, so parse each file once. An entry is reused only while
+// the modification time and size of the file are unchanged, so that updated config files are parsed again.
+class DeviceConfigCache final {
+public:
+    struct Config {
+        int32_t ret { RET_ERR };
+        IDevice::KeyboardType keyboardType { IDevice::KEYBOARD_TYPE_NONE };
+        int64_t mtime { -1 };
+        int64_t size { -1 };
+    };
+
+    static DeviceConfigCache& GetInstance()
+    {
+        static DeviceConfigCache instance;
+        return instance;
+    }
+
+    // config carries the current mtime and size of filePath, see Stat().
+    bool Find(const std::string &filePath, Config &config)
+    {
+        std::lock_guard guard(lock_);
+        auto iter = configs_.find(filePath);
+        if (iter == configs_.end()) {
+            return false;
+        }
+        if ((iter->second.mtime != config.mtime) || (iter->second.size != config.size)) {
+            configs_.erase(iter);
+            return false;
+        }
+        config = iter->second;
+        return true;
+    }
+
+    static void Stat(const std::string &filePath, Config &config)
+    {
+        struct stat statbuf;
+        if (stat(filePath.c_str(), &statbuf) != 0) {
+            config.mtime = -1;
+            config.size = -1;
+            return;
+        }
+        config.mtime = static_cast<int64_t>(statbuf.st_mtime);
+        config.size = static_cast<int64_t>(statbuf.st_size);
+    }
+
+    void Insert(const std::string &filePath, const Config &config)
+    {
+        std::lock_guard guard(lock_);
+        configs_.insert_or_assign(filePath, config);
+    }
+
+private:
+    std::mutex lock_;
+    std::unordered_map<std::string, Config> configs_;
+};
 } // namespace
 
 Device::Device(int32_t deviceId)
@@ -470,7 +530,17 @@ void Device::JudgeKeyboardType()
 void Device::LoadDeviceConfig()
 {
     CALL_DEBUG_ENTER;
-    if (ReadTomlFile(MakeConfigFileName()) != RET_OK) {
+    const std::string configFile = MakeConfigFileName();
+    DeviceConfigCache::Config config;
+    DeviceConfigCache::Stat(configFile, config);
+    if (DeviceConfigCache::GetInstance().Find(configFile, config)) {
+        keyboardType_ = config.keyboardType;
+    } else {
+        config.ret = ReadTomlFile(configFile);
+        config.keyboardType = keyboardType_;
+        DeviceConfigCache::GetInstance().Insert(configFile, config);
+    }
+    if (config.ret != RET_OK) {
         FI_HILOGE("ReadTomlFile failed");
         keyboardType_ = IDevice::KEYBOARD_TYPE_NONE;
     }
@@ -57,6 +57,22 @@ void DeviceManager::HotplugHandler::RemoveDevice(const std::string &devNode)
     devMgr_.RemoveDevice(devNode);
 }
 
+std::shared_ptr<IDevice> DeviceManager::HotplugHandler::ProbeDevice(const std::string &devNode)
+{
+    return DeviceManager::ProbeDevice(devNode);
+}
+
+void DeviceManager::HotplugHandler::AddProbedDevice([[maybe_unused]] const std::string &devNode,
+    std::shared_ptr<IDevice> dev)
+{
+    devMgr_.AddProbedDevice(dev);
+}
+
+bool DeviceManager::HotplugHandler::HasDevice(const std::string &devNode)
+{
+    return (devMgr_.FindDevice(DEV_INPUT_PATH + devNode) != nullptr);
+}
+
 DeviceManager::DeviceManager()
     : hotplug_(*this)
 {}
@@ -172,6 +188,18 @@ int32_t DeviceManager::ParseDeviceId(const std::string &devNode)
 std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode)
 {
     CALL_INFO_TRACE;
+    const std::string devPath { DEV_INPUT_PATH + devNode };
+    std::shared_ptr<IDevice> dev = FindDevice(devPath);
+    if (dev != nullptr) {
+        FI_HILOGD("Already exists:%{private}s", devPath.c_str());
+        return dev;
+    }
+    return AddProbedDevice(ProbeDevice(devNode));
+}
+
+std::shared_ptr<IDevice> DeviceManager::ProbeDevice(const std::string &devNode)
+{
+    CALL_DEBUG_ENTER;
     const std::string SYS_INPUT_PATH { "/sys/class/input/" };
     const std::string devPath { DEV_INPUT_PATH + devNode };
     struct stat statbuf;
@@ -191,12 +219,6 @@ std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode)
         return nullptr;
     }
 
-    std::shared_ptr<IDevice> dev = FindDevice(devPath);
-    if (dev != nullptr) {
-        FI_HILOGD("Already exists:%{private}s", devPath.c_str());
-        return dev;
-    }
-
     const std::string lSysPath { SYS_INPUT_PATH + devNode };
     char rpath[PATH_MAX];
     if (realpath(lSysPath.c_str(), rpath) == nullptr) {
@@ -204,13 +226,25 @@ std::shared_ptr<IDevice> DeviceManager::AddDevice(const std::string &devNode)
         return nullptr;
     }
 
-    dev = std::make_shared<Device>(deviceId);
+    auto dev = std::make_shared<Device>(deviceId);
     dev->SetDevPath(devPath);
     dev->SetSysPath(std::string(rpath));
     if (dev->Open() != RET_OK) {
         FI_HILOGE("Unable to open \'%{private}s\'", devPath.c_str());
         return nullptr;
     }
+    return dev;
+}
+
+std::shared_ptr<IDevice> DeviceManager::AddProbedDevice(std::shared_ptr<IDevice> dev)
+{
+    if (dev == nullptr) {
+        return nullptr;
+    }
+    if (std::shared_ptr<IDevice> existing = FindDevice(dev->GetDevPath()); existing != nullptr) {
+        FI_HILOGD("Already exists:%{private}s", dev->GetDevPath().c_str());
+        return existing;
+    }
     auto ret = devices_.insert_or_assign(dev->GetId(), dev);
     if (ret.second) {
         FI_HILOGD("\'%{public}s\' added", dev->GetName().c_str());
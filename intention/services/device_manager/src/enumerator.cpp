@@ -15,6 +15,10 @@
 
 #include "enumerator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include <dirent.h>
 #include <sys/stat.h>
 
@@ -29,6 +33,9 @@
 namespace OHOS {
 namespace Msdp {
 namespace DeviceStatus {
+namespace {
+constexpr size_t MAX_PROBE_WORKERS { 4 };
+} // namespace
 
 void Enumerator::SetDeviceMgr(IDeviceMgr *devMgr)
 {
@@ -46,13 +53,38 @@ void Enumerator::ScanDevices()
 void Enumerator::ScanAndAddDevices()
 {
     CALL_DEBUG_ENTER;
-    DIR *dir = opendir(DEV_INPUT_PATH.c_str());
-    CHKPV(dir);
+    CHKPV(devMgr_);
+    std::vector<std::string> devNodes = CollectDeviceNodes(DEV_INPUT_PATH);
+    RemoveKnownDevices(devNodes);
+    std::vector<std::shared_ptr<IDevice>> devices = ProbeDevices(devNodes);
+
+    for (size_t index = 0; index < devNodes.size(); ++index) {
+        devMgr_->AddProbedDevice(devNodes[index], devices[index]);
+    }
+}
+
+void Enumerator::RemoveKnownDevices(std::vector<std::string> &devNodes) const
+{
+    CHKPV(devMgr_);
+    devNodes.erase(std::remove_if(devNodes.begin(), devNodes.end(),
+        [this](const std::string &devNode) {
+            return devMgr_->HasDevice(devNode);
+        }), devNodes.end());
+}
+
+std::vector<std::string> Enumerator::CollectDeviceNodes(const std::string &inputPath) const
+{
+    std::vector<std::string> devNodes;
+    DIR *dir = opendir(inputPath.c_str());
+    if (dir == nullptr) {
+        FI_HILOGE("Failed to open %{private}s", inputPath.c_str());
+        return devNodes;
+    }
     struct dirent *dent;
 
     while ((dent = readdir(dir)) != nullptr) {
         const std::string devNode { dent->d_name };
-        const std::string devPath { DEV_INPUT_PATH + devNode };
+        const std::string devPath { inputPath + devNode };
         struct stat statbuf;
 
         if (stat(devPath.c_str(), &statbuf) != 0) {
@@ -61,17 +93,37 @@ void Enumerator::ScanAndAddDevices()
         if (!S_ISCHR(statbuf.st_mode)) {
             continue;
         }
-        AddDevice(devNode);
+        devNodes.push_back(devNode);
     }
 
     closedir(dir);
+    std::sort(devNodes.begin(), devNodes.end());
+    return devNodes;
 }
 
-void Enumerator::AddDevice(const std::string &devNode) const
+std::vector<std::shared_ptr<IDevice>> Enumerator::ProbeDevices(const std::vector<std::string> &devNodes) const
 {
-    CALL_DEBUG_ENTER;
-    CHKPV(devMgr_);
-    devMgr_->AddDevice(devNode);
+    std::vector<std::shared_ptr<IDevice>> devices(devNodes.size());
+    if (devMgr_ == nullptr) {
+        FI_HILOGE("No device manager");
+        return devices;
+    }
+    std::atomic<size_t> next { 0 };
+    auto probe = [this, &devNodes, &devices, &next] {
+        for (size_t index = next++; index < devNodes.size(); index = next++) {
+            devices[index] = devMgr_->ProbeDevice(devNodes[index]);
+        }
+    };
+    size_t nWorkers = std::min<size_t>({ MAX_PROBE_WORKERS, std::thread::hardware_concurrency(), devNodes.size() });
+    std::vector<std::thread> workers;
+    for (size_t index = 1; index < nWorkers; ++index) {
+        workers.emplace_back(probe);
+    }
+    probe();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return devices;
 }
 } // namespace DeviceStatus
 } // namespace Msdp
@@ -13,17 +13,31 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+#include "device.h"
 #include "device_manager.h"
 #include "enumerator.h"
 #include <gtest/gtest.h>
 
 #include "devicestatus_define.h"
 #include "devicestatus_errors.h"
+#include "napi_constants.h"
+#include "securec.h"
 
 #undef LOG_TAG
 #define LOG_TAG "EnumeratorTest"
@@ -34,7 +48,47 @@ namespace DeviceStatus {
 using namespace testing::ext;
 namespace {
 constexpr int32_t TIME_WAIT_FOR_OP_MS { 20 };
-const std::string TEST_DEV_NODE {"TestDeviceNode"};
+constexpr size_t N_UINPUT_DEVICES { 8 };
+constexpr int32_t N_COLD_STARTS { 5 };
+const std::string FAKE_INPUT_PATH { "/data/test/enumerator_test_input/" };
+const std::string SYS_VIRTUAL_INPUT_PATH { "/sys/devices/virtual/input/" };
+
+// Creates a uinput keyboard and returns its fd, the name of its event node is stored in devNode.
+int32_t CreateUinputDevice(size_t index, std::string &devNode)
+{
+    int32_t fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    uinput_setup setup {};
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor = 0x1234;
+    setup.id.product = 0x5678;
+    if (snprintf_s(setup.name, sizeof(setup.name), sizeof(setup.name) - 1,
+        "enumerator_test_%zu", index) < 0) {
+        close(fd);
+        return -1;
+    }
+    char sysName[UINPUT_MAX_NAME_SIZE] {};
+    if ((ioctl(fd, UI_SET_EVBIT, EV_KEY) < 0) || (ioctl(fd, UI_SET_KEYBIT, KEY_Q) < 0) ||
+        (ioctl(fd, UI_DEV_SETUP, &setup) < 0) || (ioctl(fd, UI_DEV_CREATE) < 0) ||
+        (ioctl(fd, UI_GET_SYSNAME(sizeof(sysName)), sysName) < 0)) {
+        close(fd);
+        return -1;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIME_WAIT_FOR_OP_MS));
+    const std::string sysPath { SYS_VIRTUAL_INPUT_PATH + sysName };
+    DIR *dir = opendir(sysPath.c_str());
+    if (dir != nullptr) {
+        for (struct dirent *dent = readdir(dir); dent != nullptr; dent = readdir(dir)) {
+            if (std::string(dent->d_name).rfind("event", 0) == 0) {
+                devNode = dent->d_name;
+            }
+        }
+        closedir(dir);
+    }
+    return fd;
+}
 } // namespace
 
 class EnumeratorTest : public testing::Test {
@@ -71,9 +125,88 @@ private:
     DeviceManager devMgr_;
 };
 
+// Probes nodes of the fake input tree and records which threads probed them and in which order they were added.
+class ProbingDeviceMgr : public IDeviceMgr {
+public:
+    void AddDevice(const std::string &devNode) override {}
+    void RemoveDevice(const std::string &devNode) override {}
+
+    std::shared_ptr<IDevice> ProbeDevice(const std::string &devNode) override
+    {
+        {
+            std::lock_guard guard(lock_);
+            probeThreads_.insert(std::this_thread::get_id());
+        }
+        auto dev = std::make_shared<Device>(static_cast<int32_t>(devNode.size()));
+        dev->SetDevPath(FAKE_INPUT_PATH + devNode);
+        if (dev->Open() != RET_OK) {
+            return nullptr;
+        }
+        return dev;
+    }
+
+    void AddProbedDevice(const std::string &devNode, std::shared_ptr<IDevice> dev) override
+    {
+        addedNodes_.push_back(devNode);
+        addedDevices_.push_back(dev);
+    }
+
+    bool HasDevice(const std::string &devNode) override
+    {
+        return (knownNodes_.find(devNode) != knownNodes_.cend());
+    }
+
+    std::mutex lock_;
+    std::set<std::string> knownNodes_;
+    std::set<std::thread::id> probeThreads_;
+    std::vector<std::string> addedNodes_;
+    std::vector<std::shared_ptr<IDevice>> addedDevices_;
+};
+
+class FakeInputTreeTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        mkdir(FAKE_INPUT_PATH.c_str(), S_IRWXU);
+        for (size_t index = 0; index < N_UINPUT_DEVICES; ++index) {
+            std::string devNode;
+            int32_t fd = CreateUinputDevice(index, devNode);
+            if (fd < 0) {
+                break;
+            }
+            uinputFds_.push_back(fd);
+            if (!devNode.empty() &&
+                (symlink((DEV_INPUT_PATH + devNode).c_str(), (FAKE_INPUT_PATH + devNode).c_str()) == 0)) {
+                devNodes_.insert(devNode);
+            }
+        }
+        // Not a character device, must be skipped.
+        FILE *file = fopen((FAKE_INPUT_PATH + "README").c_str(), "w");
+        if (file != nullptr) {
+            fclose(file);
+        }
+    }
+
+    void TearDown()
+    {
+        for (const auto &devNode : devNodes_) {
+            unlink((FAKE_INPUT_PATH + devNode).c_str());
+        }
+        unlink((FAKE_INPUT_PATH + "README").c_str());
+        rmdir(FAKE_INPUT_PATH.c_str());
+        for (int32_t fd : uinputFds_) {
+            ioctl(fd, UI_DEV_DESTROY);
+            close(fd);
+        }
+    }
+
+    std::vector<int32_t> uinputFds_;
+    std::set<std::string> devNodes_;
+};
+
 /**
  * @tc.name: EnumeratorTest01
- * @tc.desc: test SetDeviceMgr and AddDevice
+ * @tc.desc: test SetDeviceMgr and ScanDevices
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -83,7 +216,7 @@ HWTEST_F(EnumeratorTest, EnumeratorTest01, TestSize.Level1)
     std::shared_ptr<TestDeviceMgr> testDevMgr = std::make_shared<TestDeviceMgr>();
     IDeviceMgr *deviceMgr = testDevMgr.get();
     ASSERT_NO_FATAL_FAILURE(enumerator.SetDeviceMgr(deviceMgr));
-    ASSERT_NO_FATAL_FAILURE(enumerator.AddDevice(TEST_DEV_NODE));
+    ASSERT_NO_FATAL_FAILURE(enumerator.ScanDevices());
 }
 
 /**
@@ -98,6 +231,103 @@ HWTEST_F(EnumeratorTest, EnumeratorTest02, TestSize.Level1)
     ASSERT_NO_FATAL_FAILURE(enumerator.ScanDevices());
     ASSERT_NO_FATAL_FAILURE(enumerator.ScanAndAddDevices());
 }
+
+/**
+ * @tc.name: EnumeratorTest03
+ * @tc.desc: Probe a fake input tree of uinput devices concurrently, devices are added in the order of their nodes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(FakeInputTreeTest, EnumeratorTest03, TestSize.Level1)
+{
+    if (devNodes_.empty()) {
+        GTEST_SKIP() << "uinput is not available";
+    }
+    Enumerator enumerator;
+    ProbingDeviceMgr devMgr;
+    enumerator.SetDeviceMgr(&devMgr);
+    std::vector<std::string> devNodes = enumerator.CollectDeviceNodes(FAKE_INPUT_PATH);
+    ASSERT_EQ(std::set<std::string>(devNodes.cbegin(), devNodes.cend()), devNodes_);
+    ASSERT_TRUE(std::is_sorted(devNodes.cbegin(), devNodes.cend()));
+
+    std::vector<std::shared_ptr<IDevice>> devices = enumerator.ProbeDevices(devNodes);
+    ASSERT_EQ(devices.size(), devNodes.size());
+    for (size_t index = 0; index < devNodes.size(); ++index) {
+        ASSERT_NE(devices[index], nullptr);
+        EXPECT_EQ(devices[index]->GetDevPath(), FAKE_INPUT_PATH + devNodes[index]);
+        EXPECT_EQ(devices[index]->GetName().rfind("enumerator_test_", 0), 0U);
+    }
+    EXPECT_GE(devMgr.probeThreads_.size(), 1U);
+    EXPECT_LE(devMgr.probeThreads_.size(), devNodes.size());
+
+    for (size_t index = 0; index < devNodes.size(); ++index) {
+        devMgr.AddProbedDevice(devNodes[index], devices[index]);
+    }
+    EXPECT_EQ(devMgr.addedNodes_, devNodes);
+}
+
+/**
+ * @tc.name: EnumeratorTest04
+ * @tc.desc: Nodes known to the device manager are left out before probing
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(FakeInputTreeTest, EnumeratorTest04, TestSize.Level1)
+{
+    if (devNodes_.empty()) {
+        GTEST_SKIP() << "uinput is not available";
+    }
+    Enumerator enumerator;
+    ProbingDeviceMgr devMgr;
+    enumerator.SetDeviceMgr(&devMgr);
+    std::vector<std::string> devNodes = enumerator.CollectDeviceNodes(FAKE_INPUT_PATH);
+    ASSERT_FALSE(devNodes.empty());
+    const std::string knownNode { devNodes.front() };
+    devMgr.knownNodes_.insert(knownNode);
+
+    enumerator.RemoveKnownDevices(devNodes);
+    EXPECT_EQ(devNodes.size(), devNodes_.size() - 1);
+    EXPECT_EQ(std::find(devNodes.cbegin(), devNodes.cend(), knownNode), devNodes.cend());
+    EXPECT_TRUE(std::is_sorted(devNodes.cbegin(), devNodes.cend()));
+    std::vector<std::shared_ptr<IDevice>> devices = enumerator.ProbeDevices(devNodes);
+    EXPECT_EQ(devices.size(), devNodes.size());
+}
+
+/**
+ * @tc.name: EnumeratorTest05
+ * @tc.desc: Cold-start timing of probing the fake input tree serially and with the worker pool
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(FakeInputTreeTest, EnumeratorTest05, TestSize.Level1)
+{
+    if (devNodes_.empty()) {
+        GTEST_SKIP() << "uinput is not available";
+    }
+    Enumerator enumerator;
+    ProbingDeviceMgr devMgr;
+    enumerator.SetDeviceMgr(&devMgr);
+    std::vector<std::string> devNodes = enumerator.CollectDeviceNodes(FAKE_INPUT_PATH);
+    std::chrono::nanoseconds serial { 0 };
+    std::chrono::nanoseconds parallel { 0 };
+
+    for (int32_t round = 0; round < N_COLD_STARTS; ++round) {
+        auto start = std::chrono::steady_clock::now();
+        for (const auto &devNode : devNodes) {
+            devMgr.ProbeDevice(devNode);
+        }
+        serial += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        std::vector<std::shared_ptr<IDevice>> devices = enumerator.ProbeDevices(devNodes);
+        parallel += std::chrono::steady_clock::now() - start;
+        EXPECT_EQ(devices.size(), devNodes.size());
+    }
+    FI_HILOGI("Probing %{public}zu devices, serial:%{public}lld us, parallel:%{public}lld us", devNodes.size(),
+        static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(serial).count() / N_COLD_STARTS),
+        static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(parallel).count() /
+        N_COLD_STARTS));
+}
 } // namespace DeviceStatus
 } // namespace Msdp
 } // namespace OHOS
\ No newline at end of file
@@ -367,10 +367,10 @@ void AccountManager::InitializeScreenLockStatus()
     CHKPV(screenLockPtr);
     auto begin = std::chrono::high_resolution_clock::now();
     DISPLAY_MONITOR->SetScreenLocked(screenLockPtr->IsScreenLocked());
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::IS_SCREEN_LOCKED, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::IS_SCREEN_LOCKED, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
 #endif // OHOS_BUILD_ENABLE_KEYBOARD
 }
@@ -17,6 +17,7 @@
 #define DEVICE_CONFIG_FILE_PARSER_H
 
 #include <map>
+#include <string>
 
 struct libinput_device;
 
@@ -33,12 +34,29 @@ enum class ConfigFileItem {
     POINTER_SPEED,
     POINTER_ENABLE_OUT_SCREEN,
 };
+struct JoystickAxisCalibration {
+    bool isValid { false };
+    double minimum { 0.0 };
+    double maximum { 0.0 };
+};
+
+struct JoystickConfig {
+    // Fractions of the normalized axis range, negative if the device config leaves them unset.
+    double axialDeadzone { -1.0 };
+    double radialDeadzone { -1.0 };
+    double changeThreshold { -1.0 };
+    // Raw range of an axis, by axis name such as "X" or "RZ".
+    std::map<std::string, JoystickAxisCalibration> calibrations;
+};
+
 class DeviceConfigManagement {
 public:
     DeviceConfigManagement() = default;
     ~DeviceConfigManagement() = default;
 public:
     VendorConfig GetVendorConfig(struct libinput_device *device) const;
+    JoystickConfig GetJoystickConfig(struct libinput_device *device) const;
+    JoystickConfig ReadJoystickConfigFile(const std::string &filePath) const;
 
 private:
     std::string CombDeviceFileName(struct libinput_device *device) const;
@@ -15,6 +15,7 @@
 
 #include "device_config_file_parser.h"
 
+#include <cstdlib>
 #include <fstream>
 #include <regex>
 
@@ -33,6 +34,20 @@ namespace OHOS {
 namespace MMI {
 namespace {
 constexpr int32_t COMMENT_SUBSCRIPT { 0 };
+const std::string JOYSTICK_AXIS_MIN_SUFFIX { ".min" };
+const std::string JOYSTICK_AXIS_MAX_SUFFIX { ".max" };
+
+bool ParseDouble(const std::string &str, double &value)
+{
+    char *end = nullptr;
+    value = std::strtod(str.c_str(), &end);
+    return (end != str.c_str()) && (*end == '\0');
+}
+
+bool EndsWith(const std::string &str, const std::string &suffix)
+{
+    return (str.size() > suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
 } // namespace
 
 enum evdev_device_udev_tags {
@@ -143,5 +158,60 @@ VendorConfig DeviceConfigManagement::GetVendorConfig(struct libinput_device *dev
     }
     return vendorConfigTmp;
 }
+
+JoystickConfig DeviceConfigManagement::ReadJoystickConfigFile(const std::string &filePath) const
+{
+    JoystickConfig config;
+    std::ifstream cfgFile(filePath);
+    if (!cfgFile.is_open()) {
+        MMI_HILOGE("Failed to open config file");
+        return config;
+    }
+    std::string tmp;
+    while (std::getline(cfgFile, tmp)) {
+        RemoveSpace(tmp);
+        if (tmp.empty() || tmp.front() == '#') {
+            continue;
+        }
+        size_t pos = tmp.find('=');
+        double value = 0.0;
+        if ((pos == std::string::npos) || !ParseDouble(tmp.substr(pos + 1), value)) {
+            continue;
+        }
+        std::string key = tmp.substr(0, pos);
+        if (key == "axialDeadzone") {
+            config.axialDeadzone = value;
+        } else if (key == "radialDeadzone") {
+            config.radialDeadzone = value;
+        } else if (key == "changeThreshold") {
+            config.changeThreshold = value;
+        } else if (EndsWith(key, JOYSTICK_AXIS_MIN_SUFFIX)) {
+            auto &calibration = config.calibrations[key.substr(0, key.size() - JOYSTICK_AXIS_MIN_SUFFIX.size())];
+            calibration.minimum = value;
+            calibration.isValid = (calibration.maximum > calibration.minimum);
+        } else if (EndsWith(key, JOYSTICK_AXIS_MAX_SUFFIX)) {
+            auto &calibration = config.calibrations[key.substr(0, key.size() - JOYSTICK_AXIS_MAX_SUFFIX.size())];
+            calibration.maximum = value;
+            calibration.isValid = (calibration.maximum > calibration.minimum);
+        } else {
+            MMI_HILOGW("Unknown joystick config item");
+        }
+    }
+    cfgFile.close();
+    return config;
+}
+
+JoystickConfig DeviceConfigManagement::GetJoystickConfig(struct libinput_device *device) const
+{
+    CALL_DEBUG_ENTER;
+    CHKPO(device);
+    std::string filePath = "/vendor/etc/joystick/" + CombDeviceFileName(device) + ".TOML";
+    auto path = FileVerification(filePath, "TOML");
+    if (path.empty()) {
+        MMI_HILOGD("No joystick config for this device");
+        return {};
+    }
+    return ReadJoystickConfigFile(path);
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 
+#include <cstdio>
+#include <fstream>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -22,6 +25,7 @@ namespace OHOS {
 namespace MMI {
 namespace {
 using namespace testing::ext;
+const std::string JOYSTICK_CONFIG_PATH { "/data/local/tmp/device_config_file_parser_test.TOML" };
 } // namespace
 
 class DeviceConfigFileParserTest : public testing::Test {
@@ -85,5 +89,41 @@ HWTEST_F(DeviceConfigFileParserTest, DeviceConfigFileParserTest_GetVendorConfig_
     VendorConfig vendorconfig = configManager.GetVendorConfig(device);
     EXPECT_EQ(vendorconfig.pointerSpeed, -1);
 }
+
+/**
+ * @tc.name: DeviceConfigFileParserTest_ReadJoystickConfigFile_001
+ * @tc.desc: Test the function ReadJoystickConfigFile
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DeviceConfigFileParserTest, DeviceConfigFileParserTest_ReadJoystickConfigFile_001, TestSize.Level1)
+{
+    {
+        std::ofstream file(JOYSTICK_CONFIG_PATH);
+        file << "# Test pad\n"
+            << "axialDeadzone = 0.05\n"
+            << "radialDeadzone = 0.1\n"
+            << "changeThreshold = abc\n"
+            << "X.min = -30000\n"
+            << "X.max = 30000\n"
+            << "Y.max = -1\n";
+    }
+    DeviceConfigManagement configManager;
+    JoystickConfig config = configManager.ReadJoystickConfigFile(JOYSTICK_CONFIG_PATH);
+    std::remove(JOYSTICK_CONFIG_PATH.c_str());
+    EXPECT_DOUBLE_EQ(config.axialDeadzone, 0.05);
+    EXPECT_DOUBLE_EQ(config.radialDeadzone, 0.1);
+    EXPECT_LT(config.changeThreshold, 0.0);
+    ASSERT_EQ(config.calibrations.count("X"), 1U);
+    EXPECT_TRUE(config.calibrations["X"].isValid);
+    EXPECT_DOUBLE_EQ(config.calibrations["X"].minimum, -30000.0);
+    EXPECT_DOUBLE_EQ(config.calibrations["X"].maximum, 30000.0);
+    ASSERT_EQ(config.calibrations.count("Y"), 1U);
+    EXPECT_FALSE(config.calibrations["Y"].isValid);
+
+    config = configManager.ReadJoystickConfigFile(JOYSTICK_CONFIG_PATH);
+    EXPECT_LT(config.axialDeadzone, 0.0);
+    EXPECT_TRUE(config.calibrations.empty());
+}
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
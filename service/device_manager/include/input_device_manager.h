@@ -36,6 +36,9 @@ private:
         std::string dhid;
         std::string sysUid;
         VendorConfig vendorConfig;
+        // Built once per add and rebuilt when virtual capabilities change, shared by all lookups.
+        std::shared_ptr<const InputDevice> descriptor;
+        uint32_t capabilityTags { 0 };
     };
 
 public:
@@ -48,9 +51,11 @@ public:
     int32_t AddVirtualInputDevice(std::shared_ptr<InputDevice> device, int32_t &deviceId);
     int32_t RemoveVirtualInputDevice(int32_t deviceId);
     std::vector<int32_t> GetInputDeviceIds() const;
-    std::shared_ptr<InputDevice> GetInputDevice(int32_t deviceId, bool checked = true) const;
+    std::shared_ptr<const InputDevice> GetInputDevice(int32_t deviceId, bool checked = true) const;
+    bool HasCapability(int32_t deviceId, uint32_t deviceTags, bool checked = true) const;
     int32_t SupportKeys(int32_t deviceId, std::vector<int32_t> &keyCodes, std::vector<bool> &keystroke);
     int32_t FindInputDeviceId(struct libinput_device* inputDevice);
+    struct libinput_device* GetLibinputDevice(int32_t deviceId) const;
     int32_t GetKeyboardBusMode(int32_t deviceId);
     bool GetDeviceConfig(int32_t deviceId, int32_t &KeyboardType);
     int32_t GetDeviceSupportKey(int32_t deviceId, int32_t &keyboardType);
@@ -112,6 +117,9 @@ private:
     void MakeDeviceInfo(struct libinput_device *inputDevice, struct InputDeviceInfo& info);
     bool IsMatchKeys(struct libinput_device* device, const std::vector<int32_t> &keyCodes) const;
     void ScanPointerDevice();
+    std::shared_ptr<const InputDevice> BuildInputDevice(int32_t deviceId, const InputDeviceInfo &deviceInfo) const;
+    void UpdateInputDeviceDescriptor(int32_t deviceId, InputDeviceInfo &deviceInfo);
+    void UpdateTouchableDeviceDescriptors();
     void FillInputDevice(std::shared_ptr<InputDevice> inputDevice, libinput_device *deviceOrigin) const;
     void FillInputDeviceWithVirtualCapability(
         std::shared_ptr<InputDevice> inputDevice, const InputDeviceInfo &deviceInfo) const;
@@ -77,7 +77,7 @@ std::shared_ptr<InputDeviceManager> InputDeviceManager::GetInstance()
     return instance_;
 }
 
-std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
+std::shared_ptr<const InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
 {
     CALL_DEBUG_ENTER;
     if (virtualInputDevices_.find(deviceId) != virtualInputDevices_.end()) {
@@ -96,12 +96,35 @@ std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId
         MMI_HILOGE("The current device has been disabled");
         return nullptr;
     }
+    if (iter->second.descriptor != nullptr) {
+        return iter->second.descriptor;
+    }
+    return BuildInputDevice(iter->first, iter->second);
+}
+
+bool InputDeviceManager::HasCapability(int32_t deviceId, uint32_t deviceTags, bool checked) const
+{
+    auto iter = inputDevice_.find(deviceId);
+    if (iter != inputDevice_.end() && iter->second.descriptor != nullptr) {
+        if (checked && !iter->second.enable) {
+            return false;
+        }
+        // Every capability maps to one tag bit, so this matches InputDevice::HasCapability(deviceTags).
+        return (iter->second.capabilityTags & deviceTags) != 0;
+    }
+    auto inputDevice = GetInputDevice(deviceId, checked);
+    return (inputDevice != nullptr) && inputDevice->HasCapability(deviceTags);
+}
+
+std::shared_ptr<const InputDevice> InputDeviceManager::BuildInputDevice(
+    int32_t deviceId, const InputDeviceInfo &deviceInfo) const
+{
     std::shared_ptr<InputDevice> inputDevice = std::make_shared<InputDevice>();
-    inputDevice->SetId(iter->first);
-    struct libinput_device *inputDeviceOrigin = iter->second.inputDeviceOrigin;
+    inputDevice->SetId(deviceId);
+    struct libinput_device *inputDeviceOrigin = deviceInfo.inputDeviceOrigin;
     FillInputDevice(inputDevice, inputDeviceOrigin);
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
-    FillInputDeviceWithVirtualCapability(inputDevice, iter->second);
+    FillInputDeviceWithVirtualCapability(inputDevice, deviceInfo);
 #endif // OHOS_BUILD_ENABLE_VKEYBOARD
 
     InputDevice::AxisInfo axis;
@@ -127,6 +150,27 @@ std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId
     return inputDevice;
 }
 
+void InputDeviceManager::UpdateInputDeviceDescriptor(int32_t deviceId, InputDeviceInfo &deviceInfo)
+{
+    if (deviceInfo.inputDeviceOrigin == nullptr) {
+        deviceInfo.descriptor = nullptr;
+        deviceInfo.capabilityTags = 0;
+        return;
+    }
+    deviceInfo.descriptor = BuildInputDevice(deviceId, deviceInfo);
+    deviceInfo.capabilityTags = static_cast<uint32_t>(deviceInfo.descriptor->GetCapabilities());
+}
+
+void InputDeviceManager::UpdateTouchableDeviceDescriptors()
+{
+    // Touchscreens borrow keyboard and pointer capabilities from virtual devices.
+    for (auto &[deviceId, deviceInfo] : inputDevice_) {
+        if (deviceInfo.isTouchableDevice) {
+            UpdateInputDeviceDescriptor(deviceId, deviceInfo);
+        }
+    }
+}
+
 void InputDeviceManager::FillInputDevice(std::shared_ptr<InputDevice> inputDevice, libinput_device *deviceOrigin) const
 {
     // LOCV_EXCL_START
@@ -647,6 +691,14 @@ int32_t InputDeviceManager::FindInputDeviceId(struct libinput_device *inputDevic
     // LOCV_EXCL_STOP
 }
 
+struct libinput_device *InputDeviceManager::GetLibinputDevice(int32_t deviceId) const
+{
+    if (auto iter = inputDevice_.find(deviceId); iter != inputDevice_.end()) {
+        return iter->second.inputDeviceOrigin;
+    }
+    return nullptr;
+}
+
 struct libinput_device *InputDeviceManager::GetKeyboardDevice() const
 {
     // LOCV_EXCL_START
@@ -691,7 +743,7 @@ void InputDeviceManager::Dump(int32_t fd, const std::vector<std::string> &args)
     mprintf(fd, "Virtual input devices: count=%zu", virtualInputDevices_.size());
     std::vector<int32_t> deviceIds = GetInputDeviceIds();
     for (auto deviceId : deviceIds) {
-        std::shared_ptr<InputDevice> inputDevice = GetInputDevice(deviceId, false);
+        std::shared_ptr<const InputDevice> inputDevice = GetInputDevice(deviceId, false);
         CHKPV(inputDevice);
         mprintf(fd,
             "deviceId:%d | deviceName:%s | deviceType:%d | bus:%d | version:%d "
@@ -720,7 +772,7 @@ void InputDeviceManager::DumpDeviceList(int32_t fd, const std::vector<std::strin
     std::vector<int32_t> ids = GetInputDeviceIds();
     mprintf(fd, "Total device:%zu, Device list:\t", ids.size());
     for (const auto &item : inputDevice_) {
-        std::shared_ptr<InputDevice> inputDevice = GetInputDevice(item.first, false);
+        std::shared_ptr<const InputDevice> inputDevice = GetInputDevice(item.first, false);
         CHKPV(inputDevice);
         int32_t deviceId = inputDevice->GetId();
         mprintf(fd, "deviceId:%d | deviceName:%s | deviceType:%d | bus:%d | version:%d | product:%d | vendor:%d\t",
@@ -883,6 +935,7 @@ bool InputDeviceManager::CheckDuplicateInputDevice(std::shared_ptr<InputDevice>
 void InputDeviceManager::AddPhysicalInputDeviceInner(int32_t deviceId, const struct InputDeviceInfo& info)
 {
     inputDevice_[deviceId] = info;
+    UpdateInputDeviceDescriptor(deviceId, inputDevice_[deviceId]);
 }
 
 void InputDeviceManager::AddVirtualInputDeviceInner(int32_t deviceId, std::shared_ptr<InputDevice> inputDevice)
@@ -893,6 +946,7 @@ void InputDeviceManager::AddVirtualInputDeviceInner(int32_t deviceId, std::share
         // mark true if vkbd has ever connected before; (does not set to false during disconnection)
         virtualKeyboardEverConnected_ = true;
     }
+    UpdateTouchableDeviceDescriptors();
     // LOCV_EXCL_STOP
 }
 
@@ -927,9 +981,11 @@ int32_t InputDeviceManager::RemoveVirtualInputDeviceInner(int32_t deviceId, stru
     if (MakeVirtualDeviceInfo(iter->second, info) != RET_OK) {
         MMI_HILOGE("MakeVirtualDeviceInfo failed");
         virtualInputDevices_.erase(iter);
+        UpdateTouchableDeviceDescriptors();
         return RET_ERR;
     }
     virtualInputDevices_.erase(iter);
+    UpdateTouchableDeviceDescriptors();
     return RET_OK;
 }
 
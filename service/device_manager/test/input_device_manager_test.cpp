@@ -709,7 +709,7 @@ HWTEST_F(InputDeviceManagerTest, GetInputDevice_Test_001, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     InputDeviceManager inputDevice;
-    std::shared_ptr<InputDevice> inputDeviceManager{nullptr};
+    std::shared_ptr<const InputDevice> inputDeviceManager{nullptr};
     int32_t id = 1;
     bool checked = true;
     inputDeviceManager = inputDevice.GetInputDevice(id, checked);
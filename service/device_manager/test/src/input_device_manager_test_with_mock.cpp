@@ -16,10 +16,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "input_device_manager.h"
+#include "libinput_mock.h"
 
 namespace OHOS {
 namespace MMI {
+namespace {
 using namespace testing::ext;
+constexpr int32_t N_LOOKUPS { 100 };
+char g_deviceName[] = "test_keyboard";
+} // namespace
 
 class InputDeviceManagerTestWithMock : public testing::Test {
 public:
@@ -117,5 +122,81 @@ HWTEST_F(InputDeviceManagerTestWithMock, NotifyDeviceRemoved_001, TestSize.Level
     int32_t deviceId { 1 };
     EXPECT_NO_FATAL_FAILURE(manager.NotifyDeviceRemoved(deviceId));
 }
+
+/**
+ * @tc.name: GetInputDevice_001
+ * @tc.desc: Test the cached descriptor of InputDeviceManager::GetInputDevice across enable and disable
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceManagerTestWithMock, GetInputDevice_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    testing::NiceMock<LibinputInterfaceMock> libinputMock;
+    EXPECT_CALL(libinputMock, DeviceGetName).WillRepeatedly(testing::Return(g_deviceName));
+    libinput_device libDev {};
+    InputDeviceManager manager;
+    manager.sessionLostCallbackInitialized_ = true;
+    int32_t deviceId { 1 };
+    InputDeviceManager::InputDeviceInfo info;
+    info.inputDeviceOrigin = &libDev;
+    info.enable = true;
+    manager.AddPhysicalInputDeviceInner(deviceId, info);
+
+    auto device = manager.GetInputDevice(deviceId);
+    ASSERT_NE(device, nullptr);
+    EXPECT_EQ(device->GetName(), g_deviceName);
+    EXPECT_EQ(manager.GetInputDevice(deviceId), device);
+    uint32_t allTags = CapabilityToTags(InputDeviceCapability::INPUT_DEV_CAP_MAX);
+    EXPECT_EQ(manager.HasCapability(deviceId, allTags), device->HasCapability(allTags));
+
+    EXPECT_EQ(manager.SetInputDeviceEnabled(deviceId, false, 0, 0, nullptr), RET_OK);
+    EXPECT_EQ(manager.GetInputDevice(deviceId), nullptr);
+    EXPECT_FALSE(manager.HasCapability(deviceId, allTags));
+    EXPECT_EQ(manager.GetInputDevice(deviceId, false), device);
+
+    EXPECT_EQ(manager.SetInputDeviceEnabled(deviceId, true, 0, 0, nullptr), RET_OK);
+    EXPECT_EQ(manager.GetInputDevice(deviceId), device);
+    EXPECT_EQ(manager.HasCapability(deviceId, allTags), device->HasCapability(allTags));
+    EXPECT_EQ(manager.GetInputDevice(deviceId + 1), nullptr);
+    EXPECT_FALSE(manager.HasCapability(deviceId + 1, allTags));
+}
+
+/**
+ * @tc.name: GetInputDevice_002
+ * @tc.desc: Test that lookups of a cached descriptor no longer query libinput and that a rebuild does
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputDeviceManagerTestWithMock, GetInputDevice_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    testing::NiceMock<LibinputInterfaceMock> libinputMock;
+    EXPECT_CALL(libinputMock, DeviceGetName).WillRepeatedly(testing::Return(g_deviceName));
+    libinput_device libDev {};
+    InputDeviceManager manager;
+    int32_t deviceId { 1 };
+    InputDeviceManager::InputDeviceInfo info;
+    info.inputDeviceOrigin = &libDev;
+    info.enable = true;
+    manager.AddPhysicalInputDeviceInner(deviceId, info);
+    auto device = manager.GetInputDevice(deviceId);
+    ASSERT_NE(device, nullptr);
+    uint32_t capKeyboard = CapabilityToTags(InputDeviceCapability::INPUT_DEV_CAP_KEYBOARD);
+    testing::Mock::VerifyAndClearExpectations(&libinputMock);
+
+    EXPECT_CALL(libinputMock, DeviceGetName).Times(0);
+    for (int32_t i = 0; i < N_LOOKUPS; ++i) {
+        EXPECT_EQ(manager.GetInputDevice(deviceId), device);
+        EXPECT_EQ(manager.HasCapability(deviceId, capKeyboard), device->HasCapability(capKeyboard));
+    }
+    testing::Mock::VerifyAndClearExpectations(&libinputMock);
+
+    EXPECT_CALL(libinputMock, DeviceGetName).Times(1).WillOnce(testing::Return(g_deviceName));
+    auto rebuilt = manager.BuildInputDevice(deviceId, manager.inputDevice_[deviceId]);
+    ASSERT_NE(rebuilt, nullptr);
+    EXPECT_NE(rebuilt, device);
+    EXPECT_EQ(rebuilt->GetName(), device->GetName());
+}
 } // namespace MMI
 } // namespace OHOS
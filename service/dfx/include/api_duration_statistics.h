@@ -16,10 +16,20 @@
 #ifndef API_DURATION_STATISTICS_H
 #define API_DURATION_STATISTICS_H
 
-#include <shared_mutex>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "latency_histogram.h"
 
 namespace OHOS {
 namespace MMI {
+/**
+ * Durations of calls to other services, kept per API in lock-free log-linear histograms of microseconds so
+ * recording never blocks the calling thread. Values are clamped to [MIN_DURATION_US, MAX_DURATION_US].
+ */
 class ApiDurationStatistics {
 public:
     enum Api : int32_t {
@@ -46,7 +56,8 @@ public:
         REGISTER_APP_DEBUG_LISTENER, // RegisterAppDebugListener
         UNREGISTER_APP_DEBUG_LISTENER, // UnregisterAppDebugListener
         PUBLISH_COMMON_EVENT, // PublishCommonEvent
-        GET_VISIBILITY_WINDOW_INFO // GetVisibilityWindowInfo
+        GET_VISIBILITY_WINDOW_INFO, // GetVisibilityWindowInfo
+        API_COUNT
     };
 
     enum class Threshold : int32_t {
@@ -57,28 +68,36 @@ public:
         MAX_DURATION = GREATER_THAN_10MS + 1
     };
 
-    using DurationBox = std::unordered_map<Threshold, int32_t>;
+    static constexpr int64_t MIN_DURATION_US { 1 };
+    static constexpr int64_t MAX_DURATION_US { 10000000 };
 
     ApiDurationStatistics() = default;
     ~ApiDurationStatistics() = default;
+    DISALLOW_COPY_AND_MOVE(ApiDurationStatistics);
 
-    void RecordDuration(Api api, int32_t durationMS);
+    // Returns true for the call that fills up the current report period.
+    bool RecordDuration(Api api, int64_t durationUS);
+    // Hands out the durations of the current report period and starts the next one.
+    std::vector<LatencyHistogram::Snapshot> TakeSnapshots();
+    // Durations since the statistics were created, both reported and not yet reported.
+    LatencyHistogram::Snapshot GetTotalSnapshot(Api api);
     void ResetApiStatistics();
-    bool IsLimitMatched();
-    std::unordered_map<Api, DurationBox> GetDurationBox();
+    bool IsLimitMatched() const;
     std::string ApiToString(Api api);
-    std::vector<int32_t> GetDurationDistribution(Api api);
+    void Dump(int32_t fd);
+    // Counts of the Threshold ranges, range bounds are rounded to the histogram buckets.
+    static std::vector<int32_t> GetDurationDistribution(const LatencyHistogram::Snapshot &snapshot);
 
 private:
-    Threshold GetCurrentThreshold(int32_t duration);
-private:
-    std::unordered_map<Api, DurationBox> apiDurations_;
+    LatencyHistogram histograms_[API_COUNT];
     std::atomic_int32_t apiCallingCount_ { 0 };
+    // Periods already handed out by TakeSnapshots, only touched when reporting or dumping.
+    std::mutex reportedMtx_;
+    std::vector<LatencyHistogram::Snapshot> reported_;
     static std::unordered_map<Api, std::string> apiNames_;
     static int32_t COUNT_LIMIT_TO_DFX_RADAR;
-    std::shared_mutex mtx_;
 };
 
 } // namespace MMI
 } // namespace OHOS
-#endif // API_DURATION_STATISTICS_H
\ No newline at end of file
+#endif // API_DURATION_STATISTICS_H
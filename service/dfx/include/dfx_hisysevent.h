@@ -166,7 +166,8 @@ public:
     static void ReportTransmitInfrared(int64_t number);
     static void ReportSetCurrentUser(int32_t userId);
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    static void ReportApiCallTimes(ApiDurationStatistics::Api api, int32_t durationMS);
+    static void ReportApiCallTimes(ApiDurationStatistics::Api api, int64_t durationUS);
+    static void DumpApiCallTimes(int32_t fd);
     static void ReportMMiServiceThreadLongTask(const std::string &taskName);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     static void ReportKeyEvent(std::string name);
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVENT_STAGE_TRACER_H
+#define EVENT_STAGE_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "latency_histogram.h"
+
+namespace OHOS {
+namespace MMI {
+enum class EventStage : int32_t {
+    KERNEL = 0, // Timestamp of the evdev event
+    LIBINPUT_READ, // LibinputAdapter::OnEventHandler
+    NORMALIZE, // EventNormalizeHandler::HandleEvent
+    FILTER, // EventFilterHandler
+    INTERCEPT, // EventInterceptorHandler
+    KEY_COMMAND, // KeyCommandHandler
+    SUBSCRIBER, // KeySubscriberHandler
+    MONITOR, // EventMonitorHandler
+    HIT_TEST, // InputWindowsManager::UpdateTargetPointer, UpdateTarget
+    MARSHAL, // InputEventDataTransformation
+    SEND, // UDSServer::SendMsg
+    STAGE_COUNT
+};
+
+/**
+ * Records when an event enters each stage of the handler chain. The stages an event passes are kept in a small
+ * record in a ring indexed by event id; the time spent in a stage is the gap to the next stage the event entered.
+ * When the event has been sent, or its slot is taken by a later event, the record is folded into per-stage
+ * histograms. Events get their id during normalization, so the kernel, read and normalize timestamps are held as
+ * pending and attached to the first event that enters a later stage while the same libinput event is handled.
+ * Tracing is off by default and every stage then costs one relaxed load and a branch.
+ */
+class EventStageTracer final {
+public:
+    static constexpr size_t RECORD_COUNT { 256 };
+    // Histogram of the whole path from the first timestamp to the end of SEND.
+    static constexpr size_t TOTAL_INDEX { static_cast<size_t>(EventStage::STAGE_COUNT) };
+    static constexpr size_t HISTOGRAM_COUNT { TOTAL_INDEX + 1 };
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t histogramCount;
+        uint32_t bucketCount;
+        uint32_t subBucketBits;
+        uint32_t reserved;
+    };
+
+    static bool IsEnabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    static void SetEnabled(bool enabled);
+
+    // Called for every libinput event before it is normalized, kernelTimeUs is 0 if the event carries none.
+    static void MarkRead(uint64_t kernelTimeUs)
+    {
+        if (IsEnabled()) {
+            OnRead(kernelTimeUs);
+        }
+    }
+
+    static void MarkNormalize()
+    {
+        if (IsEnabled()) {
+            OnNormalize();
+        }
+    }
+
+    // Called once the libinput events read in one go have been handled.
+    static void EndRead()
+    {
+        if (IsEnabled()) {
+            OnEndRead();
+        }
+    }
+
+    static void Mark(int32_t eventId, EventStage stage)
+    {
+        if (IsEnabled()) {
+            OnMark(eventId, stage);
+        }
+    }
+
+    // Called after the event has been sent, closes its record.
+    static void Finish(int32_t eventId)
+    {
+        if (IsEnabled()) {
+            OnFinish(eventId);
+        }
+    }
+
+    static const char *GetStageName(size_t index);
+    static LatencyHistogram::Snapshot GetSnapshot(size_t index);
+    static void Reset();
+    static void Dump(int32_t fd, const std::vector<std::string> &args);
+    static bool SaveFile(const std::string &path);
+    static bool LoadFile(const std::string &path, std::vector<LatencyHistogram::Snapshot> &snapshots);
+
+private:
+    struct Record {
+        int32_t eventId { -1 };
+        // Set once folded, an event sent to several windows is only counted for the first one.
+        bool finished { false };
+        uint32_t stampedMask { 0 };
+        int64_t baseNs { 0 };
+        uint32_t offsetNs[static_cast<size_t>(EventStage::STAGE_COUNT)] {};
+    };
+
+    struct Pending {
+        bool valid { false };
+        uint64_t kernelNs { 0 };
+        int64_t readNs { 0 };
+        int64_t normalizeNs { 0 };
+    };
+
+    static int64_t GetTimeNs();
+    static void OnRead(uint64_t kernelTimeUs);
+    static void OnNormalize();
+    static void OnEndRead();
+    static void OnMark(int32_t eventId, EventStage stage);
+    static void OnFinish(int32_t eventId);
+    static Record &OpenRecord(int32_t eventId, int64_t nowNs);
+    static void Stamp(Record &record, EventStage stage, int64_t timeNs);
+    static void Fold(const Record &record, int64_t endNs);
+
+    static std::atomic<bool> enabled_;
+    static std::mutex mutex_;
+    static Pending pending_;
+    static Record records_[RECORD_COUNT];
+    static LatencyHistogram histograms_[HISTOGRAM_COUNT];
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // EVENT_STAGE_TRACER_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+/**
+ * Log-linear histogram of latencies. Values below SUB_BUCKET_COUNT get a bucket each, above that every power of two
+ * is split into SUB_BUCKET_COUNT buckets, so a bucket is never wider than 1/SUB_BUCKET_COUNT of its lower bound.
+ * Values of 2^MAX_VALUE_BITS and more share the last bucket. The unit of the values is up to the caller.
+ * Recording is a few relaxed atomic adds and may run on any number of threads at once.
+ */
+class LatencyHistogram final {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS { 3 };
+    static constexpr uint32_t MAX_VALUE_BITS { 36 };
+    static constexpr uint64_t SUB_BUCKET_COUNT { 1ULL << SUB_BUCKET_BITS };
+    static constexpr size_t BUCKET_COUNT { (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT };
+
+    struct Snapshot {
+        std::array<uint64_t, BUCKET_COUNT> counts {};
+        uint64_t count { 0 };
+        uint64_t sum { 0 };
+        uint64_t max { 0 };
+
+        // Upper bound of the bucket holding the given percentile (0-100), or 0 if nothing was recorded.
+        uint64_t GetPercentile(double percentile) const
+        {
+            if (count == 0) {
+                return 0;
+            }
+            auto rank = static_cast<uint64_t>(percentile * count / PERCENT);
+            rank = (rank < count ? rank : count - 1);
+            uint64_t seen = 0;
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                seen += counts[bucket];
+                if (seen > rank) {
+                    uint64_t upper = GetBucketUpperBound(bucket);
+                    return (upper < max ? upper : max);
+                }
+            }
+            return max;
+        }
+
+        uint64_t GetAverage() const
+        {
+            return (count > 0 ? sum / count : 0);
+        }
+
+        void Merge(const Snapshot &other)
+        {
+            for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+                counts[bucket] += other.counts[bucket];
+            }
+            count += other.count;
+            sum += other.sum;
+            max = (other.max > max ? other.max : max);
+        }
+    };
+
+    LatencyHistogram() = default;
+    ~LatencyHistogram() = default;
+    DISALLOW_COPY_AND_MOVE(LatencyHistogram);
+
+    static constexpr size_t GetBucket(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        if (value >= (1ULL << MAX_VALUE_BITS)) {
+            return BUCKET_COUNT - 1;
+        }
+        uint32_t exponent = HighestBit(value);
+        uint64_t subBucket = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+        return static_cast<size_t>((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket);
+    }
+
+    static constexpr uint64_t GetBucketLowerBound(size_t bucket)
+    {
+        if (bucket < SUB_BUCKET_COUNT) {
+            return bucket;
+        }
+        uint32_t exponent = static_cast<uint32_t>(bucket / SUB_BUCKET_COUNT) + SUB_BUCKET_BITS - 1;
+        uint64_t subBucket = bucket % SUB_BUCKET_COUNT;
+        return (SUB_BUCKET_COUNT + subBucket) << (exponent - SUB_BUCKET_BITS);
+    }
+
+    static constexpr uint64_t GetBucketUpperBound(size_t bucket)
+    {
+        if (bucket < SUB_BUCKET_COUNT) {
+            return bucket;
+        }
+        uint32_t exponent = static_cast<uint32_t>(bucket / SUB_BUCKET_COUNT) + SUB_BUCKET_BITS - 1;
+        return GetBucketLowerBound(bucket) + (1ULL << (exponent - SUB_BUCKET_BITS)) - 1;
+    }
+
+    void Record(uint64_t value)
+    {
+        counts_[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+        uint64_t max = max_.load(std::memory_order_relaxed);
+        while ((value > max) && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    }
+
+    Snapshot GetSnapshot() const
+    {
+        Snapshot snapshot;
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            snapshot.counts[bucket] = counts_[bucket].load(std::memory_order_relaxed);
+        }
+        snapshot.count = count_.load(std::memory_order_relaxed);
+        snapshot.sum = sum_.load(std::memory_order_relaxed);
+        snapshot.max = max_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    // Takes the counts recorded so far and starts over. Values recorded concurrently land in either period.
+    Snapshot TakeSnapshot()
+    {
+        Snapshot snapshot;
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            snapshot.counts[bucket] = counts_[bucket].exchange(0, std::memory_order_relaxed);
+        }
+        snapshot.count = count_.exchange(0, std::memory_order_relaxed);
+        snapshot.sum = sum_.exchange(0, std::memory_order_relaxed);
+        snapshot.max = max_.exchange(0, std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    void Reset()
+    {
+        TakeSnapshot();
+    }
+
+private:
+    static constexpr uint64_t PERCENT { 100 };
+
+    static constexpr uint32_t HighestBit(uint64_t value)
+    {
+        return static_cast<uint32_t>(63 - __builtin_clzll(value));
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<uint64_t> sum_ { 0 };
+    std::atomic<uint64_t> max_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCOPED_TIME_COST_H
+#define SCOPED_TIME_COST_H
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+enum class TimeCostSite : int32_t {
+    LIBINPUT_EVENT = 0, // EventNormalizeHandler::HandleEvent
+    SERVER_MSG, // ServerMsgHandler::OnMsgHandler
+    EPOLL_EVENT_INPUT, // MMIService::OnThread, libinput dispatch
+    EPOLL_EVENT_SOCKET, // MMIService::OnThread, client socket
+    EPOLL_EVENT_ETASK, // MMIService::OnThread, delegate task
+    SITE_COUNT
+};
+
+/**
+ * Per-site time cost counters fed by ScopedTimeCost. Recording only touches a fixed array of atomics, everything
+ * is turned into text in Dump. On arm64 the elapsed time is read from the generic timer counter, which is
+ * monotonic, synchronized between cores and readable from user space; elsewhere CLOCK_MONOTONIC is used.
+ */
+class TimeCostStatistics final {
+public:
+    struct Snapshot {
+        uint64_t count { 0 };
+        uint64_t overtimeCount { 0 };
+        uint64_t totalNs { 0 };
+        uint64_t maxNs { 0 };
+    };
+
+    static uint64_t ReadTicks();
+    static uint64_t TicksToNanos(uint64_t ticks);
+    static void Record(TimeCostSite site, uint64_t ticks, int64_t param);
+    static Snapshot GetSnapshot(TimeCostSite site);
+    static const std::string &GetSiteName(TimeCostSite site);
+    static void Reset();
+    static void Dump(int32_t fd, const std::vector<std::string> &args);
+
+private:
+    struct Counter {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> overtimeCount { 0 };
+        std::atomic<uint64_t> totalTicks { 0 };
+        std::atomic<uint64_t> maxTicks { 0 };
+    };
+
+    static uint64_t GetTickFrequency();
+    static uint64_t NanosToTicks(uint64_t nanos);
+
+    static Counter counters_[static_cast<size_t>(TimeCostSite::SITE_COUNT)];
+};
+
+inline uint64_t TimeCostStatistics::ReadTicks()
+{
+#if defined(__aarch64__)
+    uint64_t ticks = 0;
+    __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    struct timespec ts {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+#endif // __aarch64__
+}
+
+/**
+ * Records the time spent in its scope under a fixed site. Holds no string and allocates nothing; an optional
+ * parameter such as the event type is only logged when the scope runs over the threshold of its site.
+ */
+class ScopedTimeCost final {
+public:
+    explicit ScopedTimeCost(TimeCostSite site, int64_t param = 0)
+        : site_(site), param_(param), beginTicks_(TimeCostStatistics::ReadTicks()) {}
+
+    ~ScopedTimeCost()
+    {
+        TimeCostStatistics::Record(site_, TimeCostStatistics::ReadTicks() - beginTicks_, param_);
+    }
+
+    DISALLOW_COPY_AND_MOVE(ScopedTimeCost);
+
+private:
+    const TimeCostSite site_;
+    const int64_t param_;
+    const uint64_t beginTicks_;
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // SCOPED_TIME_COST_H
@@ -15,6 +15,11 @@
 
 #include "api_duration_statistics.h"
 
+#include <cinttypes>
+
+#include "mmi_log.h"
+#include "util_ex.h"
+
 #undef MMI_LOG_DOMAIN
 #define MMI_LOG_DOMAIN MMI_LOG_SERVER
 #undef MMI_LOG_TAG
@@ -23,9 +28,17 @@
 namespace OHOS {
 namespace MMI {
 namespace {
-    const std::string UNKNOWN_API { "UNKNOWN_API" };
-    using ApiDurationsType = std::unordered_map<ApiDurationStatistics::Api, ApiDurationStatistics::DurationBox>;
-}
+const std::string UNKNOWN_API { "UNKNOWN_API" };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr double US_PER_MS_F { 1000.0 };
+constexpr ApiDurationStatistics::Threshold THRESHOLDS[] {
+    ApiDurationStatistics::Threshold::LESS_THAN_3MS,
+    ApiDurationStatistics::Threshold::LESS_THAN_5MS,
+    ApiDurationStatistics::Threshold::LESS_THAN_10MS,
+};
+constexpr size_t THRESHOLD_COUNT { sizeof(THRESHOLDS) / sizeof(THRESHOLDS[0]) + 1 };
+constexpr double PERCENTILES[] { 50.0, 90.0, 99.0, 99.9 };
+} // namespace
 
 int32_t ApiDurationStatistics::COUNT_LIMIT_TO_DFX_RADAR { 1000 };
 std::unordered_map<ApiDurationStatistics::Api, std::string> ApiDurationStatistics::apiNames_ {
@@ -57,32 +70,64 @@ std::unordered_map<ApiDurationStatistics::Api, std::string> ApiDurationStatistic
     { ApiDurationStatistics::Api::GET_VISIBILITY_WINDOW_INFO, "GET_VISIBILITY_WINDOW_INFO" }
 };
 
-void ApiDurationStatistics::RecordDuration(Api api, int32_t durationMS)
+bool ApiDurationStatistics::RecordDuration(Api api, int64_t durationUS)
 {
-    auto threshold = GetCurrentThreshold(durationMS);
-    {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        apiDurations_[api][threshold] += 1;
+    if ((api < 0) || (api >= API_COUNT)) {
+        MMI_HILOGE("Invalid api:%{public}d", static_cast<int32_t>(api));
+        return false;
+    }
+    if (durationUS < MIN_DURATION_US) {
+        durationUS = MIN_DURATION_US;
+    } else if (durationUS > MAX_DURATION_US) {
+        durationUS = MAX_DURATION_US;
     }
-    ++apiCallingCount_;
+    histograms_[api].Record(static_cast<uint64_t>(durationUS));
+    return (apiCallingCount_.fetch_add(1, std::memory_order_relaxed) + 1 == COUNT_LIMIT_TO_DFX_RADAR);
 }
 
-void ApiDurationStatistics::ResetApiStatistics()
+std::vector<LatencyHistogram::Snapshot> ApiDurationStatistics::TakeSnapshots()
+{
+    std::vector<LatencyHistogram::Snapshot> snapshots(API_COUNT);
+    apiCallingCount_.store(0, std::memory_order_relaxed);
+    for (int32_t api = 0; api < API_COUNT; ++api) {
+        snapshots[api] = histograms_[api].TakeSnapshot();
+    }
+    std::lock_guard<std::mutex> guard(reportedMtx_);
+    if (reported_.empty()) {
+        reported_.resize(API_COUNT);
+    }
+    for (int32_t api = 0; api < API_COUNT; ++api) {
+        reported_[api].Merge(snapshots[api]);
+    }
+    return snapshots;
+}
+
+LatencyHistogram::Snapshot ApiDurationStatistics::GetTotalSnapshot(Api api)
 {
-    apiCallingCount_ = 0;
-    std::unique_lock<std::shared_mutex> lock(mtx_);
-    apiDurations_.clear();
+    if ((api < 0) || (api >= API_COUNT)) {
+        return LatencyHistogram::Snapshot {};
+    }
+    LatencyHistogram::Snapshot snapshot = histograms_[api].GetSnapshot();
+    std::lock_guard<std::mutex> guard(reportedMtx_);
+    if (!reported_.empty()) {
+        snapshot.Merge(reported_[api]);
+    }
+    return snapshot;
 }
 
-bool ApiDurationStatistics::IsLimitMatched()
+void ApiDurationStatistics::ResetApiStatistics()
 {
-    return apiCallingCount_ >= COUNT_LIMIT_TO_DFX_RADAR;
+    apiCallingCount_.store(0, std::memory_order_relaxed);
+    for (auto &histogram : histograms_) {
+        histogram.Reset();
+    }
+    std::lock_guard<std::mutex> guard(reportedMtx_);
+    reported_.clear();
 }
 
-ApiDurationsType ApiDurationStatistics::GetDurationBox()
+bool ApiDurationStatistics::IsLimitMatched() const
 {
-    std::shared_lock<std::shared_mutex> lock(mtx_);
-    return apiDurations_;
+    return apiCallingCount_.load(std::memory_order_relaxed) >= COUNT_LIMIT_TO_DFX_RADAR;
 }
 
 std::string ApiDurationStatistics::ApiToString(Api api)
@@ -93,50 +138,39 @@ std::string ApiDurationStatistics::ApiToString(Api api)
     return UNKNOWN_API;
 }
 
-ApiDurationStatistics::Threshold ApiDurationStatistics::GetCurrentThreshold(int32_t duration)
+std::vector<int32_t> ApiDurationStatistics::GetDurationDistribution(const LatencyHistogram::Snapshot &snapshot)
 {
-    if (duration <= static_cast<int32_t> (Threshold::LESS_THAN_3MS)) {
-        return Threshold::LESS_THAN_3MS;
-    } else if (duration <= static_cast<int32_t> (Threshold::LESS_THAN_5MS)) {
-        return Threshold::LESS_THAN_5MS;
-    } else if (duration <= static_cast<int32_t> (Threshold::LESS_THAN_10MS)) {
-        return Threshold::LESS_THAN_10MS;
-    } else {
-        return Threshold::GREATER_THAN_10MS;
+    std::vector<int32_t> durations(THRESHOLD_COUNT, 0);
+    size_t range = 0;
+    for (size_t bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; ++bucket) {
+        if (snapshot.counts[bucket] == 0) {
+            continue;
+        }
+        // Durations used to be truncated to milliseconds, so "<=3MS" covers everything below 4ms.
+        uint64_t lower = LatencyHistogram::GetBucketLowerBound(bucket);
+        while ((range < THRESHOLD_COUNT - 1) &&
+            (lower >= static_cast<uint64_t>((static_cast<int64_t>(THRESHOLDS[range]) + 1) * US_PER_MS))) {
+            ++range;
+        }
+        durations[range] += static_cast<int32_t>(snapshot.counts[bucket]);
     }
+    return durations;
 }
 
-std::vector<int32_t> ApiDurationStatistics::GetDurationDistribution(Api api)
+void ApiDurationStatistics::Dump(int32_t fd)
 {
-    std::shared_lock<std::shared_mutex> lock(mtx_);
-    if (apiDurations_.find(api)== apiDurations_.end()) {
-        return { 0, 0, 0, 0 };
-    }
-    auto durationBox = apiDurations_[api];
-
-    std::vector<int32_t> durations;
-    if (durationBox.find(Threshold::LESS_THAN_3MS) != durationBox.end()) {
-        durations.push_back(durationBox[Threshold::LESS_THAN_3MS]);
-    } else {
-        durations.push_back(0);
-    }
-    if (durationBox.find(Threshold::LESS_THAN_5MS) != durationBox.end()) {
-        durations.push_back(durationBox[Threshold::LESS_THAN_5MS]);
-    } else {
-        durations.push_back(0);
-    }
-    if (durationBox.find(Threshold::LESS_THAN_10MS) != durationBox.end()) {
-        durations.push_back(durationBox[Threshold::LESS_THAN_10MS]);
-    } else {
-        durations.push_back(0);
+    mprintf(fd, "Api call durations in ms since start:\n");
+    for (int32_t api = 0; api < API_COUNT; ++api) {
+        LatencyHistogram::Snapshot snapshot = GetTotalSnapshot(static_cast<Api>(api));
+        if (snapshot.count == 0) {
+            continue;
+        }
+        mprintf(fd, "  %s: count:%" PRIu64 " | avg:%.3f | p50:%.3f | p90:%.3f | p99:%.3f | p999:%.3f | max:%.3f\n",
+            ApiToString(static_cast<Api>(api)).c_str(), snapshot.count, snapshot.GetAverage() / US_PER_MS_F,
+            snapshot.GetPercentile(PERCENTILES[0]) / US_PER_MS_F, snapshot.GetPercentile(PERCENTILES[1]) / US_PER_MS_F,
+            snapshot.GetPercentile(PERCENTILES[2]) / US_PER_MS_F, snapshot.GetPercentile(PERCENTILES[3]) / US_PER_MS_F,
+            snapshot.max / US_PER_MS_F);
     }
-    if (durationBox.find(Threshold::GREATER_THAN_10MS) != durationBox.end()) {
-        durations.push_back(durationBox[Threshold::GREATER_THAN_10MS]);
-    } else {
-        durations.push_back(0);
-    }
-    return durations;
 }
-
 } // namespace MMI
 } // namespace OHOS
@@ -1083,12 +1083,15 @@ void DfxHisysevent::ReportSetCurrentUser(int32_t userId)
 }
 
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-void DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api api, int32_t durationMS)
+void DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api api, int64_t durationUS)
 {
-    apiDurationStatics_.RecordDuration(api, durationMS);
-    if (!apiDurationStatics_.IsLimitMatched()) {
+    if (!apiDurationStatics_.RecordDuration(api, durationUS)) {
         return;
     }
+    auto snapshots = apiDurationStatics_.TakeSnapshots();
+    auto distribution = [&snapshots](ApiDurationStatistics::Api index) {
+        return ApiDurationStatistics::GetDurationDistribution(snapshots[index]);
+    };
     static std::vector<std::string> apiDurationBox { "<=3MS", "<=5MS", "<=10MS", ">10MS" };
     HiSysEventWrite(
         OHOS::HiviewDFX::HiSysEvent::Domain::MULTI_MODAL_INPUT,
@@ -1096,55 +1099,59 @@ void DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api api, int32_t d
         OHOS::HiviewDFX::HiSysEvent::EventType::STATISTIC,
         "API_DURATION_BOX", apiDurationBox,
         "IS_SCREEN_CAPTURE_WORKING",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::IS_SCREEN_CAPTURE_WORKING),
+            distribution(ApiDurationStatistics::Api::IS_SCREEN_CAPTURE_WORKING),
         "GET_DEFAULT_DISPLAY",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_DEFAULT_DISPLAY),
+            distribution(ApiDurationStatistics::Api::GET_DEFAULT_DISPLAY),
         "GET_SYSTEM_ABILITY_MANAGER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_SYSTEM_ABILITY_MANAGER),
+            distribution(ApiDurationStatistics::Api::GET_SYSTEM_ABILITY_MANAGER),
         "IS_FOLDABLE",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::IS_FOLDABLE),
+            distribution(ApiDurationStatistics::Api::IS_FOLDABLE),
         "IS_SCREEN_LOCKED",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::IS_SCREEN_LOCKED),
+            distribution(ApiDurationStatistics::Api::IS_SCREEN_LOCKED),
         "RS_NOTIFY_TOUCH_EVENT",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT),
+            distribution(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT),
         "RESOURCE_SCHEDULE_REPORT_DATA",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA),
+            distribution(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA),
         "GET_CUR_RENDERER_CHANGE_INFOS",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_CUR_RENDERER_CHANGE_INFOS),
+            distribution(ApiDurationStatistics::Api::GET_CUR_RENDERER_CHANGE_INFOS),
         "GET_PROC_RUNNING_INFOS_BY_UID",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_PROC_RUNNING_INFOS_BY_UID),
+            distribution(ApiDurationStatistics::Api::GET_PROC_RUNNING_INFOS_BY_UID),
         "TELEPHONY_CALL_MGR_INIT",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_INIT),
+            distribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_INIT),
         "TELEPHONY_CALL_MGR_MUTE_RINGER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_MUTE_RINGER),
+            distribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_MUTE_RINGER),
         "TELEPHONY_CALL_MGR_HANG_UP_CALL",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_HANG_UP_CALL),
+            distribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_HANG_UP_CALL),
         "TELEPHONY_CALL_MGR_REJECT_CALL",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_REJECT_CALL),
+            distribution(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_REJECT_CALL),
         "RE_SCREEN_MODE_CHANGE_LISTENER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::RE_SCREEN_MODE_CHANGE_LISTENER),
+            distribution(ApiDurationStatistics::Api::RE_SCREEN_MODE_CHANGE_LISTENER),
         "SET_ON_REMOTE_DIED_CALLBACK",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::SET_ON_REMOTE_DIED_CALLBACK),
+            distribution(ApiDurationStatistics::Api::SET_ON_REMOTE_DIED_CALLBACK),
         "REG_SCREEN_CAPTURE_LISTENER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::REG_SCREEN_CAPTURE_LISTENER),
+            distribution(ApiDurationStatistics::Api::REG_SCREEN_CAPTURE_LISTENER),
         "ABILITY_MGR_START_EXT_ABILITY",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY),
+            distribution(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY),
         "ABILITY_MGR_CLIENT_START_ABILITY",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY),
+            distribution(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY),
         "ABILITY_MGR_CONNECT_ABILITY",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY),
+            distribution(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY),
         "GET_RUNNING_PROCESS_INFO_BY_PID",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_RUNNING_PROCESS_INFO_BY_PID),
+            distribution(ApiDurationStatistics::Api::GET_RUNNING_PROCESS_INFO_BY_PID),
         "REGISTER_APP_DEBUG_LISTENER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER),
+            distribution(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER),
         "UNREGISTER_APP_DEBUG_LISTENER",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::UNREGISTER_APP_DEBUG_LISTENER),
+            distribution(ApiDurationStatistics::Api::UNREGISTER_APP_DEBUG_LISTENER),
         "PUBLISH_COMMON_EVENT",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::PUBLISH_COMMON_EVENT),
+            distribution(ApiDurationStatistics::Api::PUBLISH_COMMON_EVENT),
         "GET_VISIBILITY_WINDOW_INFO",
-            apiDurationStatics_.GetDurationDistribution(ApiDurationStatistics::Api::GET_VISIBILITY_WINDOW_INFO)
+            distribution(ApiDurationStatistics::Api::GET_VISIBILITY_WINDOW_INFO)
         );
-    apiDurationStatics_.ResetApiStatistics();
+}
+
+void DfxHisysevent::DumpApiCallTimes(int32_t fd)
+{
+    apiDurationStatics_.Dump(fd);
 }
 
 void DfxHisysevent::ReportMMiServiceThreadLongTask(const std::string &taskName)
@@ -50,7 +50,7 @@ void DfxHisyseventDevice::ReportDeviceFault(int32_t faultType, std::string fault
 
 void DfxHisyseventDevice::ReportDeviceFault(int32_t deviceId, int32_t faultType, std::string faultMsg)
 {
-    std::shared_ptr<InputDevice> dev = INPUT_DEV_MGR->GetInputDevice(deviceId);
+    std::shared_ptr<const InputDevice> dev = INPUT_DEV_MGR->GetInputDevice(deviceId);
     CHKPV(dev);
     int32_t ret = HiSysEventWrite(DFX_HISYSEVENT_DOMAIN,
         DFX_HISYSEVENT_NAME_DEVICE_FAULT,
@@ -79,7 +79,7 @@ void DfxHisyseventDevice::ReportDeviceFault(int32_t deviceId, int32_t faultType,
 
 void DfxHisyseventDevice::ReportDeviceBehavior(int32_t deviceId, std::string msg)
 {
-    std::shared_ptr<InputDevice> dev = INPUT_DEV_MGR->GetInputDevice(deviceId);
+    std::shared_ptr<const InputDevice> dev = INPUT_DEV_MGR->GetInputDevice(deviceId);
     CHKPV(dev);
     std::string message;
     std::string name;
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_stage_tracer.h"
+
+#include <cinttypes>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+#include "mmi_log.h"
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventStageTracer"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int64_t NS_PER_SEC { 1000000000 };
+constexpr uint64_t NS_PER_US { 1000 };
+constexpr double NS_PER_US_F { 1000.0 };
+constexpr size_t STAGE_COUNT { static_cast<size_t>(EventStage::STAGE_COUNT) };
+constexpr uint32_t FILE_MAGIC { 0x4C54534D }; // "MSTL"
+constexpr uint32_t FILE_VERSION { 1 };
+const char *LATENCY_FILE_NAME = "/data/service/el1/public/multimodalinput/event_stage_latency.dat";
+
+constexpr const char *STAGE_NAMES[EventStageTracer::HISTOGRAM_COUNT] {
+    "kernel",
+    "libinput_read",
+    "normalize",
+    "filter",
+    "intercept",
+    "key_command",
+    "subscriber",
+    "monitor",
+    "hit_test",
+    "marshal",
+    "send",
+    "total",
+};
+
+constexpr double PERCENTILES[] { 50.0, 90.0, 99.0, 99.9 };
+} // namespace
+static_assert(std::is_trivially_copyable_v<LatencyHistogram::Snapshot>, "Snapshots are saved as raw bytes");
+
+std::atomic<bool> EventStageTracer::enabled_ { false };
+std::mutex EventStageTracer::mutex_;
+EventStageTracer::Pending EventStageTracer::pending_;
+EventStageTracer::Record EventStageTracer::records_[RECORD_COUNT];
+LatencyHistogram EventStageTracer::histograms_[HISTOGRAM_COUNT];
+
+void EventStageTracer::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    enabled_.store(enabled, std::memory_order_relaxed);
+    pending_ = Pending {};
+    MMI_HILOGI("Event stage tracing %{public}s", (enabled ? "on" : "off"));
+}
+
+int64_t EventStageTracer::GetTimeNs()
+{
+    struct timespec ts {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * NS_PER_SEC + ts.tv_nsec;
+}
+
+void EventStageTracer::OnRead(uint64_t kernelTimeUs)
+{
+    int64_t nowNs = GetTimeNs();
+    std::lock_guard<std::mutex> guard(mutex_);
+    pending_.valid = true;
+    pending_.readNs = nowNs;
+    pending_.normalizeNs = 0;
+    uint64_t kernelNs = kernelTimeUs * NS_PER_US;
+    // Devices stamping with another clock would only produce nonsense, leave the kernel stage out for them.
+    pending_.kernelNs = ((kernelNs > 0) && (kernelNs <= static_cast<uint64_t>(nowNs)) ? kernelNs : 0);
+}
+
+void EventStageTracer::OnNormalize()
+{
+    int64_t nowNs = GetTimeNs();
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (pending_.valid && (pending_.normalizeNs == 0)) {
+        pending_.normalizeNs = nowNs;
+    }
+}
+
+void EventStageTracer::OnEndRead()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    pending_ = Pending {};
+}
+
+void EventStageTracer::OnMark(int32_t eventId, EventStage stage)
+{
+    if (static_cast<size_t>(stage) >= STAGE_COUNT) {
+        return;
+    }
+    int64_t nowNs = GetTimeNs();
+    std::lock_guard<std::mutex> guard(mutex_);
+    Stamp(OpenRecord(eventId, nowNs), stage, nowNs);
+}
+
+void EventStageTracer::OnFinish(int32_t eventId)
+{
+    int64_t nowNs = GetTimeNs();
+    std::lock_guard<std::mutex> guard(mutex_);
+    Record &record = records_[static_cast<uint32_t>(eventId) % RECORD_COUNT];
+    if ((record.eventId == eventId) && !record.finished) {
+        Fold(record, nowNs);
+        record.finished = true;
+    }
+}
+
+EventStageTracer::Record &EventStageTracer::OpenRecord(int32_t eventId, int64_t nowNs)
+{
+    Record &record = records_[static_cast<uint32_t>(eventId) % RECORD_COUNT];
+    if (record.eventId == eventId) {
+        return record;
+    }
+    if ((record.eventId >= 0) && !record.finished) {
+        Fold(record, 0);
+    }
+    record = Record {};
+    record.eventId = eventId;
+    record.baseNs = nowNs;
+    if (!pending_.valid) {
+        return record;
+    }
+    record.baseNs = (pending_.kernelNs > 0 ? static_cast<int64_t>(pending_.kernelNs) : pending_.readNs);
+    if (pending_.kernelNs > 0) {
+        Stamp(record, EventStage::KERNEL, record.baseNs);
+    }
+    Stamp(record, EventStage::LIBINPUT_READ, pending_.readNs);
+    if (pending_.normalizeNs > 0) {
+        Stamp(record, EventStage::NORMALIZE, pending_.normalizeNs);
+    }
+    // Other events made from the same libinput event must not take over its read and normalize stamps.
+    pending_ = Pending {};
+    return record;
+}
+
+void EventStageTracer::Stamp(Record &record, EventStage stage, int64_t timeNs)
+{
+    uint32_t bit = 1U << static_cast<uint32_t>(stage);
+    if (record.finished || ((record.stampedMask & bit) != 0)) {
+        return;
+    }
+    int64_t offsetNs = timeNs - record.baseNs;
+    if (offsetNs < 0) {
+        offsetNs = 0;
+    } else if (offsetNs > std::numeric_limits<uint32_t>::max()) {
+        offsetNs = std::numeric_limits<uint32_t>::max();
+    }
+    record.stampedMask |= bit;
+    record.offsetNs[static_cast<size_t>(stage)] = static_cast<uint32_t>(offsetNs);
+}
+
+void EventStageTracer::Fold(const Record &record, int64_t endNs)
+{
+    size_t order[STAGE_COUNT] {};
+    size_t stamped = 0;
+    for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+        if ((record.stampedMask & (1U << stage)) == 0) {
+            continue;
+        }
+        size_t pos = stamped++;
+        // Stages are not always entered in enum order, e.g. pointer hit testing happens during normalization.
+        for (; (pos > 0) && (record.offsetNs[order[pos - 1]] > record.offsetNs[stage]); --pos) {
+            order[pos] = order[pos - 1];
+        }
+        order[pos] = stage;
+    }
+    for (size_t i = 1; i < stamped; ++i) {
+        histograms_[order[i - 1]].Record(record.offsetNs[order[i]] - record.offsetNs[order[i - 1]]);
+    }
+    if ((endNs > 0) && (stamped > 0)) {
+        uint64_t endOffsetNs = static_cast<uint64_t>(endNs - record.baseNs);
+        size_t last = order[stamped - 1];
+        histograms_[last].Record(endOffsetNs - record.offsetNs[last]);
+        histograms_[TOTAL_INDEX].Record(endOffsetNs - record.offsetNs[order[0]]);
+    }
+}
+
+const char *EventStageTracer::GetStageName(size_t index)
+{
+    return (index < HISTOGRAM_COUNT ? STAGE_NAMES[index] : "unknown");
+}
+
+LatencyHistogram::Snapshot EventStageTracer::GetSnapshot(size_t index)
+{
+    return (index < HISTOGRAM_COUNT ? histograms_[index].GetSnapshot() : LatencyHistogram::Snapshot {});
+}
+
+void EventStageTracer::Reset()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    pending_ = Pending {};
+    for (auto &record : records_) {
+        record = Record {};
+    }
+    for (auto &histogram : histograms_) {
+        histogram.Reset();
+    }
+}
+
+void EventStageTracer::Dump(int32_t fd, const std::vector<std::string> &args)
+{
+    for (const auto &arg : args) {
+        if (arg == "on") {
+            SetEnabled(true);
+        } else if (arg == "off") {
+            SetEnabled(false);
+        } else if (arg == "clear") {
+            Reset();
+        } else if (arg == "save") {
+            mprintf(fd, "Save to %s %s\n", LATENCY_FILE_NAME, (SaveFile(LATENCY_FILE_NAME) ? "succeeded" : "failed"));
+        }
+    }
+    mprintf(fd, "Event stage latency in us (tracing %s, options: on|off|clear|save):\n", (IsEnabled() ? "on" : "off"));
+    for (size_t index = 0; index < HISTOGRAM_COUNT; ++index) {
+        LatencyHistogram::Snapshot snapshot = histograms_[index].GetSnapshot();
+        mprintf(fd, "  %-13s count:%" PRIu64 " | avg:%.1f | p50:%.1f | p90:%.1f | p99:%.1f | p999:%.1f | max:%.1f\n",
+            STAGE_NAMES[index], snapshot.count, snapshot.GetAverage() / NS_PER_US_F,
+            snapshot.GetPercentile(PERCENTILES[0]) / NS_PER_US_F, snapshot.GetPercentile(PERCENTILES[1]) / NS_PER_US_F,
+            snapshot.GetPercentile(PERCENTILES[2]) / NS_PER_US_F, snapshot.GetPercentile(PERCENTILES[3]) / NS_PER_US_F,
+            snapshot.max / NS_PER_US_F);
+    }
+}
+
+bool EventStageTracer::SaveFile(const std::string &path)
+{
+    std::ofstream ofs(path, std::ios::trunc | std::ios::out | std::ios_base::binary);
+    if (!ofs) {
+        MMI_HILOGE("Open %{public}s failed", path.c_str());
+        return false;
+    }
+    FileHeader header {
+        .magic = FILE_MAGIC,
+        .version = FILE_VERSION,
+        .histogramCount = static_cast<uint32_t>(HISTOGRAM_COUNT),
+        .bucketCount = static_cast<uint32_t>(LatencyHistogram::BUCKET_COUNT),
+        .subBucketBits = LatencyHistogram::SUB_BUCKET_BITS,
+        .reserved = 0,
+    };
+    ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto &histogram : histograms_) {
+        LatencyHistogram::Snapshot snapshot = histogram.GetSnapshot();
+        ofs.write(reinterpret_cast<const char *>(&snapshot), sizeof(snapshot));
+    }
+    ofs.close();
+    if (!ofs) {
+        MMI_HILOGE("Write %{public}s failed", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool EventStageTracer::LoadFile(const std::string &path, std::vector<LatencyHistogram::Snapshot> &snapshots)
+{
+    std::ifstream ifs(path, std::ios::in | std::ios_base::binary);
+    if (!ifs) {
+        MMI_HILOGE("Open %{public}s failed", path.c_str());
+        return false;
+    }
+    FileHeader header {};
+    if (!ifs.read(reinterpret_cast<char *>(&header), sizeof(header)) || (header.magic != FILE_MAGIC) ||
+        (header.version != FILE_VERSION) || (header.histogramCount != HISTOGRAM_COUNT) ||
+        (header.bucketCount != LatencyHistogram::BUCKET_COUNT) ||
+        (header.subBucketBits != LatencyHistogram::SUB_BUCKET_BITS)) {
+        MMI_HILOGE("Unsupported latency file %{public}s", path.c_str());
+        return false;
+    }
+    snapshots.resize(HISTOGRAM_COUNT);
+    for (auto &snapshot : snapshots) {
+        if (!ifs.read(reinterpret_cast<char *>(&snapshot), sizeof(snapshot))) {
+            MMI_HILOGE("Truncated latency file %{public}s", path.c_str());
+            snapshots.clear();
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace MMI
+} // namespace OHOS
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scoped_time_cost.h"
+
+#include <array>
+#include <cinttypes>
+
+#include "mmi_log.h"
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "ScopedTimeCost"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr uint64_t NS_PER_SEC { 1000000000 };
+constexpr uint64_t NS_PER_US { 1000 };
+constexpr size_t SITE_COUNT { static_cast<size_t>(TimeCostSite::SITE_COUNT) };
+
+struct SiteInfo {
+    const char *name;
+    uint64_t thresholdUs;
+};
+
+constexpr SiteInfo SITE_INFOS[SITE_COUNT] {
+    { "HandleLibinputEvent", 1000 },
+    { "ServerMsgHandler::OnMsgHandler", 300 },
+    { "EPOLL_EVENT_INPUT", 1000 },
+    { "MMI:EPOLL_EVENT_SOCKET", 1000 },
+    { "MMI:EPOLL_EVENT_ETASK", 1000 },
+};
+
+size_t GetSiteIndex(TimeCostSite site)
+{
+    auto index = static_cast<size_t>(site);
+    return (index < SITE_COUNT ? index : 0);
+}
+} // namespace
+
+TimeCostStatistics::Counter TimeCostStatistics::counters_[SITE_COUNT];
+
+uint64_t TimeCostStatistics::GetTickFrequency()
+{
+#if defined(__aarch64__)
+    static const uint64_t frequency = [] {
+        uint64_t value = 0;
+        __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(value));
+        return (value > 0 ? value : NS_PER_SEC);
+    }();
+    return frequency;
+#else
+    return NS_PER_SEC;
+#endif // __aarch64__
+}
+
+uint64_t TimeCostStatistics::TicksToNanos(uint64_t ticks)
+{
+    uint64_t frequency = GetTickFrequency();
+    if (frequency == NS_PER_SEC) {
+        return ticks;
+    }
+    return ticks / frequency * NS_PER_SEC + ticks % frequency * NS_PER_SEC / frequency;
+}
+
+uint64_t TimeCostStatistics::NanosToTicks(uint64_t nanos)
+{
+    uint64_t frequency = GetTickFrequency();
+    if (frequency == NS_PER_SEC) {
+        return nanos;
+    }
+    return nanos / NS_PER_SEC * frequency + nanos % NS_PER_SEC * frequency / NS_PER_SEC;
+}
+
+void TimeCostStatistics::Record(TimeCostSite site, uint64_t ticks, int64_t param)
+{
+    static const auto thresholds = [] {
+        std::array<uint64_t, SITE_COUNT> values {};
+        for (size_t i = 0; i < SITE_COUNT; ++i) {
+            values[i] = NanosToTicks(SITE_INFOS[i].thresholdUs * NS_PER_US);
+        }
+        return values;
+    }();
+    size_t index = GetSiteIndex(site);
+    Counter &counter = counters_[index];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+    uint64_t maxTicks = counter.maxTicks.load(std::memory_order_relaxed);
+    while ((ticks > maxTicks) &&
+        !counter.maxTicks.compare_exchange_weak(maxTicks, ticks, std::memory_order_relaxed)) {}
+    if (ticks > thresholds[index]) {
+        counter.overtimeCount.fetch_add(1, std::memory_order_relaxed);
+        MMI_HILOGD("Overtime(%{public}" PRIu64 "(us)>%{public}" PRIu64 "(us)) when Reason:%{public}s,"
+            "param:%{public}" PRId64, TicksToNanos(ticks) / NS_PER_US, SITE_INFOS[index].thresholdUs,
+            SITE_INFOS[index].name, param);
+    }
+}
+
+TimeCostStatistics::Snapshot TimeCostStatistics::GetSnapshot(TimeCostSite site)
+{
+    const Counter &counter = counters_[GetSiteIndex(site)];
+    return Snapshot {
+        .count = counter.count.load(std::memory_order_relaxed),
+        .overtimeCount = counter.overtimeCount.load(std::memory_order_relaxed),
+        .totalNs = TicksToNanos(counter.totalTicks.load(std::memory_order_relaxed)),
+        .maxNs = TicksToNanos(counter.maxTicks.load(std::memory_order_relaxed)),
+    };
+}
+
+const std::string &TimeCostStatistics::GetSiteName(TimeCostSite site)
+{
+    static const auto names = [] {
+        std::array<std::string, SITE_COUNT> values;
+        for (size_t i = 0; i < SITE_COUNT; ++i) {
+            values[i] = SITE_INFOS[i].name;
+        }
+        return values;
+    }();
+    return names[GetSiteIndex(site)];
+}
+
+void TimeCostStatistics::Reset()
+{
+    for (auto &counter : counters_) {
+        counter.count.store(0, std::memory_order_relaxed);
+        counter.overtimeCount.store(0, std::memory_order_relaxed);
+        counter.totalTicks.store(0, std::memory_order_relaxed);
+        counter.maxTicks.store(0, std::memory_order_relaxed);
+    }
+}
+
+void TimeCostStatistics::Dump(int32_t fd, const std::vector<std::string> &args)
+{
+    mprintf(fd, "Time cost (tick frequency %" PRIu64 "Hz):\n", GetTickFrequency());
+    for (size_t i = 0; i < SITE_COUNT; ++i) {
+        Snapshot snapshot = GetSnapshot(static_cast<TimeCostSite>(i));
+        uint64_t averageNs = (snapshot.count > 0 ? snapshot.totalNs / snapshot.count : 0);
+        mprintf(fd, "  %s: count:%" PRIu64 " | avg:%" PRIu64 "ns | max:%" PRIu64 "ns | over %" PRIu64
+            "us:%" PRIu64 "\n", SITE_INFOS[i].name, snapshot.count, averageNs, snapshot.maxNs,
+            SITE_INFOS[i].thresholdUs, snapshot.overtimeCount);
+    }
+}
+} // namespace MMI
+} // namespace OHOS
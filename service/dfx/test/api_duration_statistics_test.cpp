@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "api_duration_statistics.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "ApiDurationStatisticsTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+using Api = ApiDurationStatistics::Api;
+constexpr int32_t N_THREADS { 16 };
+constexpr int32_t N_RECORDS_PER_THREAD { 50000 };
+constexpr int32_t N_RECORDS { 1000000 };
+constexpr int32_t REPORT_LIMIT { 1000 };
+constexpr int64_t DURATION_SPREAD_US { 20000 };
+} // namespace
+
+class ApiDurationStatisticsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: ApiDurationStatisticsTest_Record_001
+ * @tc.desc: Test that durations are kept in microseconds and fall into the reported millisecond ranges
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ApiDurationStatisticsTest, ApiDurationStatisticsTest_Record_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ApiDurationStatistics statistics;
+    for (int64_t durationUS : { 0, 200, 2900, 3900, 4500, 9000, 12000, 20000, 20000000 }) {
+        statistics.RecordDuration(Api::IS_FOLDABLE, durationUS);
+    }
+    auto snapshot = statistics.GetTotalSnapshot(Api::IS_FOLDABLE);
+    EXPECT_EQ(snapshot.count, 9U);
+    EXPECT_EQ(snapshot.max, static_cast<uint64_t>(ApiDurationStatistics::MAX_DURATION_US));
+    EXPECT_EQ(snapshot.counts[LatencyHistogram::GetBucket(ApiDurationStatistics::MIN_DURATION_US)], 1U);
+    EXPECT_LE(snapshot.GetPercentile(20.0), 250U);
+    EXPECT_EQ(ApiDurationStatistics::GetDurationDistribution(snapshot), std::vector<int32_t>({ 4, 1, 1, 3 }));
+    EXPECT_EQ(statistics.GetTotalSnapshot(Api::IS_SCREEN_LOCKED).count, 0U);
+    EXPECT_EQ(statistics.GetTotalSnapshot(Api::API_COUNT).count, 0U);
+    EXPECT_FALSE(statistics.RecordDuration(Api::API_COUNT, 1));
+}
+
+/**
+ * @tc.name: ApiDurationStatisticsTest_Snapshot_001
+ * @tc.desc: Test that the report limit is hit once per period and taking snapshots starts a new period
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ApiDurationStatisticsTest, ApiDurationStatisticsTest_Snapshot_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ApiDurationStatistics statistics;
+    for (int32_t i = 1; i < REPORT_LIMIT; ++i) {
+        EXPECT_FALSE(statistics.RecordDuration(Api::GET_DEFAULT_DISPLAY, i));
+    }
+    EXPECT_FALSE(statistics.IsLimitMatched());
+    EXPECT_TRUE(statistics.RecordDuration(Api::IS_SCREEN_LOCKED, REPORT_LIMIT));
+    EXPECT_TRUE(statistics.IsLimitMatched());
+    EXPECT_FALSE(statistics.RecordDuration(Api::IS_SCREEN_LOCKED, REPORT_LIMIT));
+
+    auto snapshots = statistics.TakeSnapshots();
+    ASSERT_EQ(snapshots.size(), static_cast<size_t>(Api::API_COUNT));
+    EXPECT_EQ(snapshots[Api::GET_DEFAULT_DISPLAY].count, static_cast<uint64_t>(REPORT_LIMIT - 1));
+    EXPECT_EQ(snapshots[Api::IS_SCREEN_LOCKED].count, 2U);
+    EXPECT_FALSE(statistics.IsLimitMatched());
+    EXPECT_EQ(statistics.TakeSnapshots()[Api::GET_DEFAULT_DISPLAY].count, 0U);
+
+    statistics.RecordDuration(Api::GET_DEFAULT_DISPLAY, 1);
+    EXPECT_EQ(statistics.GetTotalSnapshot(Api::GET_DEFAULT_DISPLAY).count, static_cast<uint64_t>(REPORT_LIMIT));
+    statistics.ResetApiStatistics();
+    EXPECT_EQ(statistics.GetTotalSnapshot(Api::GET_DEFAULT_DISPLAY).count, 0U);
+}
+
+/**
+ * @tc.name: ApiDurationStatisticsTest_Concurrency_001
+ * @tc.desc: Test that no duration is lost while many binder threads record and report at once
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ApiDurationStatisticsTest, ApiDurationStatisticsTest_Concurrency_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ApiDurationStatistics statistics;
+    std::atomic<uint64_t> reported { 0 };
+    std::atomic<int32_t> reports { 0 };
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < N_THREADS; ++t) {
+        threads.emplace_back([&statistics, &reported, &reports, t] {
+            for (int32_t i = 0; i < N_RECORDS_PER_THREAD; ++i) {
+                auto api = static_cast<Api>((t + i) % Api::API_COUNT);
+                if (!statistics.RecordDuration(api, (i * (t + 1)) % DURATION_SPREAD_US)) {
+                    continue;
+                }
+                reports.fetch_add(1);
+                for (const auto &snapshot : statistics.TakeSnapshots()) {
+                    reported.fetch_add(snapshot.count);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    uint64_t left = 0;
+    uint64_t total = 0;
+    for (const auto &snapshot : statistics.TakeSnapshots()) {
+        left += snapshot.count;
+    }
+    for (int32_t api = 0; api < Api::API_COUNT; ++api) {
+        total += statistics.GetTotalSnapshot(static_cast<Api>(api)).count;
+    }
+    constexpr uint64_t expected { static_cast<uint64_t>(N_THREADS) * N_RECORDS_PER_THREAD };
+    EXPECT_EQ(reported.load() + left, expected);
+    EXPECT_EQ(total, expected);
+    EXPECT_GT(reports.load(), 0);
+    EXPECT_LE(reports.load(), static_cast<int32_t>(expected / REPORT_LIMIT));
+}
+
+/**
+ * @tc.name: ApiDurationStatisticsTest_Dump_001
+ * @tc.desc: Test that the dump lists the percentiles of the called apis only
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ApiDurationStatisticsTest, ApiDurationStatisticsTest_Dump_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ApiDurationStatistics statistics;
+    statistics.RecordDuration(Api::PUBLISH_COMMON_EVENT, 1500);
+    statistics.TakeSnapshots();
+    statistics.RecordDuration(Api::PUBLISH_COMMON_EVENT, 1500);
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    statistics.Dump(fileno(file));
+    std::string output;
+    char buf[256] {};
+    rewind(file);
+    while (fgets(buf, sizeof(buf), file) != nullptr) {
+        output += buf;
+    }
+    fclose(file);
+    EXPECT_NE(output.find("PUBLISH_COMMON_EVENT: count:2 "), std::string::npos);
+    EXPECT_NE(output.find("p999:1.500"), std::string::npos);
+    EXPECT_EQ(output.find("IS_FOLDABLE"), std::string::npos);
+}
+
+/**
+ * @tc.name: ApiDurationStatisticsTest_Perf_001
+ * @tc.desc: Measure the cost of recording one duration
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(ApiDurationStatisticsTest, ApiDurationStatisticsTest_Perf_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    ApiDurationStatistics statistics;
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < N_RECORDS; ++i) {
+        statistics.RecordDuration(Api::RS_NOTIFY_TOUCH_EVENT, i % DURATION_SPREAD_US);
+    }
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    MMI_HILOGI("RecordDuration %{public}" PRId64 "ns", static_cast<int64_t>(elapsedNs / N_RECORDS));
+    EXPECT_EQ(statistics.GetTotalSnapshot(Api::RS_NOTIFY_TOUCH_EVENT).count, static_cast<uint64_t>(N_RECORDS));
+}
+} // namespace MMI
+} // namespace OHOS
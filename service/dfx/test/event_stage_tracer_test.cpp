@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+#include <gtest/gtest.h>
+#include <linux/input.h>
+#include <unistd.h>
+
+#include "event_filter_handler.h"
+#include "event_normalize_handler.h"
+#include "event_stage_tracer.h"
+#include "general_keyboard.h"
+#include "input_device_manager.h"
+#include "key_event_normalize.h"
+#include "libinput_wrapper.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventStageTracerTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t EVENT_ID { 1001 };
+constexpr useconds_t STAGE_SLEEP_US { 1000 };
+constexpr uint64_t STAGE_SLEEP_NS { STAGE_SLEEP_US * 1000 };
+constexpr int32_t N_MARKS { 100000 };
+const std::string LATENCY_FILE { "/data/test/event_stage_latency_test.dat" };
+
+uint64_t GetCount(EventStage stage)
+{
+    return EventStageTracer::GetSnapshot(static_cast<size_t>(stage)).count;
+}
+
+uint64_t GetTotalCount()
+{
+    return EventStageTracer::GetSnapshot(EventStageTracer::TOTAL_INDEX).count;
+}
+} // namespace
+
+class EventStageTracerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+
+    void SetUp()
+    {
+        EventStageTracer::Reset();
+        EventStageTracer::SetEnabled(true);
+    }
+
+    void TearDown()
+    {
+        EventStageTracer::SetEnabled(false);
+        EventStageTracer::Reset();
+    }
+
+private:
+    static GeneralKeyboard vKeyboard_;
+    static LibinputWrapper libinput_;
+};
+
+GeneralKeyboard EventStageTracerTest::vKeyboard_;
+LibinputWrapper EventStageTracerTest::libinput_;
+
+void EventStageTracerTest::SetUpTestCase(void)
+{
+    ASSERT_TRUE(libinput_.Init());
+    ASSERT_TRUE(vKeyboard_.SetUp());
+    ASSERT_TRUE(libinput_.AddPath(vKeyboard_.GetDevPath()));
+    libinput_event *event = libinput_.Dispatch();
+    ASSERT_TRUE(event != nullptr);
+    ASSERT_EQ(libinput_event_get_type(event), LIBINPUT_EVENT_DEVICE_ADDED);
+    struct libinput_device *device = libinput_event_get_device(event);
+    ASSERT_TRUE(device != nullptr);
+    INPUT_DEV_MGR->OnInputDeviceAdded(device);
+}
+
+void EventStageTracerTest::TearDownTestCase(void)
+{
+    libinput_.RemovePath(vKeyboard_.GetDevPath());
+    vKeyboard_.Close();
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Stage_001
+ * @tc.desc: Test that the time between two stages is counted for the earlier one and the total is counted on finish
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Stage_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventStageTracer::MarkRead(0);
+    EventStageTracer::MarkNormalize();
+    usleep(STAGE_SLEEP_US);
+    EventStageTracer::Mark(EVENT_ID, EventStage::FILTER);
+    EventStageTracer::Mark(EVENT_ID, EventStage::MONITOR);
+    EventStageTracer::Mark(EVENT_ID, EventStage::SEND);
+    usleep(STAGE_SLEEP_US);
+    EventStageTracer::Finish(EVENT_ID);
+    EventStageTracer::EndRead();
+
+    EXPECT_EQ(GetCount(EventStage::KERNEL), 0U);
+    EXPECT_EQ(GetCount(EventStage::LIBINPUT_READ), 1U);
+    EXPECT_EQ(GetCount(EventStage::NORMALIZE), 1U);
+    EXPECT_EQ(GetCount(EventStage::FILTER), 1U);
+    EXPECT_EQ(GetCount(EventStage::INTERCEPT), 0U);
+    EXPECT_EQ(GetCount(EventStage::MONITOR), 1U);
+    EXPECT_EQ(GetCount(EventStage::SEND), 1U);
+    EXPECT_EQ(GetTotalCount(), 1U);
+    EXPECT_GE(EventStageTracer::GetSnapshot(static_cast<size_t>(EventStage::NORMALIZE)).max, STAGE_SLEEP_NS);
+    EXPECT_GE(EventStageTracer::GetSnapshot(static_cast<size_t>(EventStage::SEND)).max, STAGE_SLEEP_NS);
+    EXPECT_GE(EventStageTracer::GetSnapshot(EventStageTracer::TOTAL_INDEX).max, 2 * STAGE_SLEEP_NS);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Stage_002
+ * @tc.desc: Test that an event sent to several windows is counted once and marks after finish are ignored
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Stage_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    for (int32_t window = 0; window < 3; ++window) {
+        EventStageTracer::Mark(EVENT_ID, EventStage::MARSHAL);
+        EventStageTracer::Mark(EVENT_ID, EventStage::SEND);
+        EventStageTracer::Finish(EVENT_ID);
+    }
+    EXPECT_EQ(GetCount(EventStage::MARSHAL), 1U);
+    EXPECT_EQ(GetCount(EventStage::SEND), 1U);
+    EXPECT_EQ(GetTotalCount(), 1U);
+    EXPECT_EQ(GetCount(EventStage::LIBINPUT_READ), 0U);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Stage_003
+ * @tc.desc: Test that an unfinished record is folded without a total when its slot is taken by a later event
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Stage_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventStageTracer::Mark(EVENT_ID, EventStage::FILTER);
+    EventStageTracer::Mark(EVENT_ID, EventStage::INTERCEPT);
+    EXPECT_EQ(GetCount(EventStage::FILTER), 0U);
+
+    EventStageTracer::Mark(static_cast<int32_t>(EVENT_ID + EventStageTracer::RECORD_COUNT), EventStage::FILTER);
+    EXPECT_EQ(GetCount(EventStage::FILTER), 1U);
+    EXPECT_EQ(GetCount(EventStage::INTERCEPT), 0U);
+    EXPECT_EQ(GetTotalCount(), 0U);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Stage_004
+ * @tc.desc: Test that the pending read and normalize stamps are attached to the first event only
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Stage_004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventStageTracer::MarkRead(0);
+    EventStageTracer::MarkNormalize();
+    EventStageTracer::Mark(EVENT_ID, EventStage::FILTER);
+    EventStageTracer::Mark(EVENT_ID + 1, EventStage::FILTER);
+    EventStageTracer::MarkNormalize();
+    EventStageTracer::Finish(EVENT_ID);
+    EventStageTracer::Finish(EVENT_ID + 1);
+    EventStageTracer::EndRead();
+
+    EXPECT_EQ(GetCount(EventStage::LIBINPUT_READ), 1U);
+    EXPECT_EQ(GetCount(EventStage::NORMALIZE), 1U);
+    EXPECT_EQ(GetCount(EventStage::FILTER), 2U);
+    EXPECT_EQ(GetTotalCount(), 2U);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Disabled_001
+ * @tc.desc: Test that nothing is recorded while tracing is off and measure the cost of a mark then
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Disabled_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventStageTracer::SetEnabled(false);
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < N_MARKS; ++i) {
+        EventStageTracer::Mark(i, EventStage::FILTER);
+        EventStageTracer::Finish(i);
+    }
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    MMI_HILOGI("Disabled mark and finish %{public}" PRId64 "ns", static_cast<int64_t>(elapsedNs / N_MARKS));
+    EXPECT_EQ(GetCount(EventStage::FILTER), 0U);
+    EXPECT_EQ(GetTotalCount(), 0U);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_File_001
+ * @tc.desc: Test that saved histograms are loaded back unchanged
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_File_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventStageTracer::Mark(EVENT_ID, EventStage::MONITOR);
+    EventStageTracer::Mark(EVENT_ID, EventStage::SEND);
+    EventStageTracer::Finish(EVENT_ID);
+    ASSERT_TRUE(EventStageTracer::SaveFile(LATENCY_FILE));
+    std::vector<LatencyHistogram::Snapshot> snapshots;
+    ASSERT_TRUE(EventStageTracer::LoadFile(LATENCY_FILE, snapshots));
+    std::remove(LATENCY_FILE.c_str());
+    ASSERT_EQ(snapshots.size(), EventStageTracer::HISTOGRAM_COUNT);
+    for (size_t index = 0; index < EventStageTracer::HISTOGRAM_COUNT; ++index) {
+        auto expected = EventStageTracer::GetSnapshot(index);
+        EXPECT_EQ(snapshots[index].count, expected.count);
+        EXPECT_EQ(snapshots[index].max, expected.max);
+        EXPECT_EQ(snapshots[index].counts, expected.counts);
+    }
+    EXPECT_EQ(snapshots[EventStageTracer::TOTAL_INDEX].count, 1U);
+}
+
+/**
+ * @tc.name: EventStageTracerTest_Libinput_001
+ * @tc.desc: Test that a key read from libinput carries its read and normalize stages into the handler chain
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStageTracerTest, EventStageTracerTest_Libinput_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    vKeyboard_.SendEvent(EV_KEY, KEY_A, 1);
+    vKeyboard_.SendEvent(EV_SYN, SYN_REPORT, 0);
+    libinput_event *event = libinput_.Dispatch();
+    ASSERT_TRUE(event != nullptr);
+    ASSERT_EQ(libinput_event_get_type(event), LIBINPUT_EVENT_KEYBOARD_KEY);
+
+    EventNormalizeHandler handler;
+    handler.SetNext(std::make_shared<EventFilterHandler>());
+    EventStageTracer::MarkRead(libinput_event_get_sensortime(event));
+    handler.HandleEvent(event, GetSysClockTime());
+    EventStageTracer::EndRead();
+    auto keyEvent = KeyEventHdr->GetKeyEvent();
+    ASSERT_NE(keyEvent, nullptr);
+    EventStageTracer::Finish(keyEvent->GetId());
+
+    EXPECT_EQ(GetCount(EventStage::LIBINPUT_READ), 1U);
+    EXPECT_EQ(GetCount(EventStage::NORMALIZE), 1U);
+    EXPECT_EQ(GetCount(EventStage::FILTER), 1U);
+    EXPECT_EQ(GetTotalCount(), 1U);
+
+    vKeyboard_.SendEvent(EV_KEY, KEY_A, 0);
+    vKeyboard_.SendEvent(EV_SYN, SYN_REPORT, 0);
+    libinput_.DrainEvents();
+}
+} // namespace MMI
+} // namespace OHOS
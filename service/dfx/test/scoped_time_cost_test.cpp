@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "mmi_log.h"
+#include "scoped_time_cost.h"
+#include "time_cost_chk.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "ScopedTimeCostTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t N_SCOPES { 100000 };
+constexpr int32_t N_SLOW_SCOPES { 3 };
+constexpr useconds_t SLOW_SCOPE_US { 2000 };
+
+template <class F>
+int64_t MeasureNanos(F &&func)
+{
+    auto begin = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+} // namespace
+
+class ScopedTimeCostTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+    void SetUp()
+    {
+        TimeCostStatistics::Reset();
+    }
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: ScopedTimeCostTest_Record_001
+ * @tc.desc: Test that every scope is counted under its site and slow scopes are counted as overtime
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ScopedTimeCostTest, ScopedTimeCostTest_Record_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    for (int32_t i = 0; i < N_SLOW_SCOPES; ++i) {
+        ScopedTimeCost timeCost(TimeCostSite::SERVER_MSG, i);
+        usleep(SLOW_SCOPE_US);
+    }
+    {
+        ScopedTimeCost timeCost(TimeCostSite::LIBINPUT_EVENT);
+    }
+    auto slow = TimeCostStatistics::GetSnapshot(TimeCostSite::SERVER_MSG);
+    EXPECT_EQ(slow.count, static_cast<uint64_t>(N_SLOW_SCOPES));
+    EXPECT_EQ(slow.overtimeCount, static_cast<uint64_t>(N_SLOW_SCOPES));
+    EXPECT_GE(slow.maxNs, static_cast<uint64_t>(SLOW_SCOPE_US) * 1000);
+    EXPECT_GE(slow.totalNs, slow.maxNs * N_SLOW_SCOPES / 2);
+
+    auto fast = TimeCostStatistics::GetSnapshot(TimeCostSite::LIBINPUT_EVENT);
+    EXPECT_EQ(fast.count, 1U);
+    EXPECT_EQ(fast.overtimeCount, 0U);
+    EXPECT_EQ(TimeCostStatistics::GetSnapshot(TimeCostSite::EPOLL_EVENT_INPUT).count, 0U);
+
+    TimeCostStatistics::Reset();
+    EXPECT_EQ(TimeCostStatistics::GetSnapshot(TimeCostSite::SERVER_MSG).count, 0U);
+    EXPECT_EQ(TimeCostStatistics::GetSnapshot(TimeCostSite::SERVER_MSG).maxNs, 0U);
+}
+
+/**
+ * @tc.name: ScopedTimeCostTest_Dump_001
+ * @tc.desc: Test that the dump lists every site with its counters
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ScopedTimeCostTest, ScopedTimeCostTest_Dump_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    {
+        ScopedTimeCost timeCost(TimeCostSite::EPOLL_EVENT_SOCKET);
+    }
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    TimeCostStatistics::Dump(fileno(file), {});
+    std::string output;
+    char buf[256] {};
+    rewind(file);
+    while (fgets(buf, sizeof(buf), file) != nullptr) {
+        output += buf;
+    }
+    fclose(file);
+    for (int32_t i = 0; i < static_cast<int32_t>(TimeCostSite::SITE_COUNT); ++i) {
+        EXPECT_NE(output.find(TimeCostStatistics::GetSiteName(static_cast<TimeCostSite>(i))), std::string::npos);
+    }
+    EXPECT_NE(output.find("MMI:EPOLL_EVENT_SOCKET: count:1 "), std::string::npos);
+}
+
+/**
+ * @tc.name: ScopedTimeCostTest_Overhead_001
+ * @tc.desc: Measure the cost of an empty scope against TimeCostChk
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(ScopedTimeCostTest, ScopedTimeCostTest_Overhead_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    int64_t scopedNs = MeasureNanos([] {
+        for (int32_t i = 0; i < N_SCOPES; ++i) {
+            ScopedTimeCost timeCost(TimeCostSite::LIBINPUT_EVENT, i);
+        }
+    });
+    int64_t chkNs = MeasureNanos([] {
+        for (int32_t i = 0; i < N_SCOPES; ++i) {
+            TimeCostChk chk("HandleLibinputEvent", "overtime 1000(us)", MAX_INPUT_EVENT_TIME, i);
+        }
+    });
+    MMI_HILOGI("ScopedTimeCost %{public}" PRId64 "ns/scope, TimeCostChk %{public}" PRId64 "ns/scope",
+        scopedNs / N_SCOPES, chkNs / N_SCOPES);
+    EXPECT_EQ(TimeCostStatistics::GetSnapshot(TimeCostSite::LIBINPUT_EVENT).count, static_cast<uint64_t>(N_SCOPES));
+}
+} // namespace MMI
+} // namespace OHOS
@@ -21,8 +21,10 @@
 #include "cursor_drawing_component.h"
 #include "dfx_hisysevent.h"
 #include "event_log_helper.h"
+#include "event_stage_tracer.h"
 #include "input_event_data_transformation.h"
 #include "input_event_handler.h"
+#include "input_event_pool.h"
 #ifdef OHOS_BUILD_ENABLE_KEY_HOOK
 #include "key_event_hook_manager.h"
 #endif // OHOS_BUILD_ENABLE_KEY_HOOK
@@ -205,7 +207,7 @@ void EventDispatchHandler::HandleMultiWindowPointerEvent(std::shared_ptr<Pointer
     }
     WIN_MGR->FoldScreenRotation(point);
     for (auto windowId : windowIds) {
-        auto pointerEvent = std::make_shared<PointerEvent>(*point);
+        auto pointerEvent = InputEventPool::Clone(*point);
         auto windowInfo = WIN_MGR->GetWindowAndDisplayInfo(windowId, point->GetTargetDisplayId());
         if (!ReissueEvent(pointerEvent, windowId, windowInfo)) {
             continue;
@@ -267,10 +269,10 @@ void EventDispatchHandler::NotifyPointerEventToRS(int32_t pointAction, const std
     if (POINTER_DEV_MGR.isInit) {
         CursorDrawingComponent::GetInstance().NotifyPointerEventToRS(pointAction, pointCnt);
     }
-    [[maybe_unused]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    [[maybe_unused]] auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
 #endif // OHOS_BUILD_ENABLE_WATCH
 }
@@ -462,11 +464,12 @@ void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEven
             "action:%{public}s)", point->GetDeviceId(), point->DumpPointerAction());
         ANRMgr->HandleAnrState(sess, ANR_DISPATCH, currentTime);
     }
-    auto pointerEvent = std::make_shared<PointerEvent>(*point);
+    auto pointerEvent = InputEventPool::Clone(*point);
     pointerEvent->SetMarkEnabled(AcquireEnableMark(pointerEvent));
     pointerEvent->SetSensorInputTime(point->GetSensorInputTime());
     FilterInvalidPointerItem(pointerEvent, fd);
     NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::MARSHAL);
     InputEventDataTransformation::Marshalling(pointerEvent, pkt);
 #ifdef OHOS_BUILD_ENABLE_SECURITY_COMPONENT
     InputEventDataTransformation::MarshallingEnhanceData(pointerEvent, pkt);
@@ -480,10 +483,12 @@ void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEven
         MMI_HILOG_FREEZEI("SendMsg:%{public}d", sess->GetPid());
     }
     WIN_MGR->PrintEnterEventInfo(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::SEND);
     if (!udsServer->SendMsg(fd, pkt)) {
         MMI_HILOGE("Sending structure of EventTouch failed! errCode:%{public}d", MSG_SEND_FAIL);
         return;
     }
+    EventStageTracer::Finish(pointerEvent->GetId());
     if (sess->GetPid() != AppDebugListener::GetInstance()->GetAppDebugPid() && pointerEvent->IsMarkEnabled()) {
         MMI_HILOGD("Session pid:%{public}d", sess->GetPid());
         ANRMgr->AddTimer(ANR_DISPATCH, point->GetId(), currentTime, sess);
@@ -546,6 +551,7 @@ int32_t EventDispatchHandler::DispatchKeyEvent(int32_t fd, UDSServer& udsServer,
         MMI_HILOGW("Keycode has been changed");
     }
     NetPacket pkt(MmiMessageId::ON_KEY_EVENT);
+    EventStageTracer::Mark(key->GetId(), EventStage::MARSHAL);
     InputEventDataTransformation::KeyEventToNetPacket(key, pkt);
     BytraceAdapter::StartBytrace(key, BytraceAdapter::KEY_DISPATCH_EVENT);
     pkt << fd;
@@ -559,10 +565,12 @@ int32_t EventDispatchHandler::DispatchKeyEvent(int32_t fd, UDSServer& udsServer,
     }
     MMI_HILOGD("InputTracking id:%{public}d, SendMsg to %{public}s:pid:%{public}d",
         key->GetId(), session->GetProgramName().c_str(), session->GetPid());
+    EventStageTracer::Mark(key->GetId(), EventStage::SEND);
     if (!udsServer.SendMsg(fd, pkt)) {
         MMI_HILOGE("Sending structure of EventKeyboard failed! errCode:%{public}d", MSG_SEND_FAIL);
         return MSG_SEND_FAIL;
     }
+    EventStageTracer::Finish(key->GetId());
     if (session->GetPid() != AppDebugListener::GetInstance()->GetAppDebugPid()) {
         MMI_HILOGD("Session pid:%{public}d", session->GetPid());
         ANRMgr->AddTimer(ANR_DISPATCH, key->GetId(), currentTime, session);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVENT_JOURNAL_H
+#define EVENT_JOURNAL_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+constexpr size_t JOURNAL_MAX_POINTERS { 10 };
+constexpr size_t JOURNAL_MAX_KEY_ITEMS { 6 };
+constexpr uint32_t JOURNAL_FLAG_PRIVACY { 0x1 };
+
+struct JournalPointerItem {
+    int32_t displayX;
+    int32_t displayY;
+    double pressure;
+};
+
+struct JournalKeyItem {
+    int64_t downTime;
+    int32_t deviceId;
+    int32_t keyCode;
+    uint32_t unicode;
+    int32_t pressed;
+};
+
+/**
+ * Fixed-size binary form of one recorded event. It is filled on the input thread without formatting
+ * and only rendered to text when the journal is dumped or decoded.
+ */
+struct JournalRecord {
+    int64_t handleTime;      // Wall clock in ms when the event was recorded.
+    int64_t actionTime;
+    int32_t eventType;
+    int32_t deviceId;
+    int32_t sourceType;
+    int32_t action;          // Pointer action, key action or switch type.
+    int32_t code;            // Pointer id, key code or switch value.
+    int32_t buttonId;
+    uint32_t axes;
+    uint32_t flags;
+    uint64_t pressedButtons; // Bit n is set when button n is pressed.
+    uint32_t itemCount;      // Items stored, events with more items are truncated.
+    uint32_t reserved;
+    union {
+        JournalPointerItem pointers[JOURNAL_MAX_POINTERS];
+        JournalKeyItem keys[JOURNAL_MAX_KEY_ITEMS];
+    };
+};
+static_assert(std::is_trivially_copyable_v<JournalRecord>, "JournalRecord is copied as raw bytes");
+
+/**
+ * Single producer ring of the latest records. The input thread pushes without locking and the oldest
+ * record is overwritten when the ring is full. Readers copy records out by position and use the per-slot
+ * sequence to reject slots that were not written yet or were overwritten while being copied.
+ */
+class JournalRing final {
+public:
+    static constexpr uint64_t CAPACITY { 256 };
+
+    JournalRing() = default;
+    ~JournalRing() = default;
+    DISALLOW_COPY_AND_MOVE(JournalRing);
+
+    // Must only be called from one thread at a time.
+    void Push(const JournalRecord &record);
+    // Position the next record will be pushed at, all earlier positions were pushed.
+    uint64_t GetHead() const;
+    bool Read(uint64_t pos, JournalRecord &record) const;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq { 0 };
+        JournalRecord record {};
+    };
+    Slot slots_[CAPACITY];
+    std::atomic<uint64_t> head_ { 0 };
+};
+
+/**
+ * Size-capped journal file of JournalRecords. The file is created at its final size and mapped, so an
+ * append is a memory copy. When the file is full it is renamed to the history path and a new one is
+ * started, keeping at most two files on disk.
+ */
+class EventJournal final {
+public:
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t capacity;
+        uint64_t count;
+    };
+
+    EventJournal(std::string path, std::string historyPath, uint32_t capacity);
+    ~EventJournal();
+    DISALLOW_COPY_AND_MOVE(EventJournal);
+
+    bool Append(const JournalRecord &record);
+    void Close();
+    uint64_t GetCount() const;
+    // I/O syscalls issued so far, appends into the mapping are not counted since they issue none.
+    uint64_t GetSyscallCount() const;
+
+    // Reads all records of a journal file in write order.
+    static int32_t Load(const std::string &path, std::vector<JournalRecord> &records);
+
+private:
+    bool Open();
+    bool Rotate();
+    size_t GetMapSize() const;
+
+    std::string path_;
+    std::string historyPath_;
+    uint32_t capacity_ { 0 };
+    Header *header_ { nullptr };
+    JournalRecord *records_ { nullptr };
+    uint64_t syscallCount_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // EVENT_JOURNAL_H
@@ -22,6 +22,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "event_journal.h"
 #include "pointer_event.h"
 #include "key_event.h"
 #include "switch_event.h"
@@ -30,20 +31,21 @@ namespace OHOS {
 namespace MMI {
 class EventStatistic final {
 public:
-    static void PushEventStr(std::string eventStr);
+    static void PushRecord(const JournalRecord &record);
     static void PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr);
     static void PushKeyEvent(std::shared_ptr<KeyEvent> eventPtr);
     static void PushSwitchEvent(std::shared_ptr<SwitchEvent> eventPtr);
     static void PushPointerRecord(std::shared_ptr<PointerEvent> eventPtr);
     static int32_t QueryPointerRecord(int32_t count, std::vector<std::shared_ptr<PointerEvent>> &pointerList);
-    static std::string PopEvent();
     static void WriteEventFile();
     static void Dump(int32_t fd, const std::vector<std::string> &args);
     static std::string ConvertInputEventToStr(const std::shared_ptr<InputEvent> eventPtr);
+    static std::string ConvertRecordToStr(const JournalRecord &record);
     static std::string ConvertTimeToStr(int64_t timestamp);
     static const char* ConvertEventTypeToString(int32_t eventType);
     static const char* ConvertSourceTypeToString(int32_t sourceType_);
     static const char* ConvertPointerActionToString(std::shared_ptr<PointerEvent> eventPtr);
+    static const char* ConvertPointerActionToString(int32_t pointerAction, uint32_t axes);
     static const char* ConvertKeyActionToString(int32_t keyAction);
     static const char* ConvertSwitchTypeToString(int32_t switchType);
 
@@ -64,11 +66,15 @@ private:
               pointerIds(pointerIds), pressures(pressures), tiltXs(tiltXs), tiltYs(tiltYs)
         {}
     };
-    static std::queue<std::string> eventQueue_;
-    static std::list<std::string> dumperEventList_;
+    static void FillRecord(InputEvent &event, JournalRecord &record);
+    static uint64_t FlushJournal(EventJournal &journal, uint64_t cursor);
+    static void LoadPreviousJournal();
+
+    static JournalRing journalRing_;
+    static std::vector<JournalRecord> previousRecords_;
     static std::mutex queueMutex_;
     static std::condition_variable queueCondition_;
-    static bool writeFileEnabled_;
+    static std::atomic<bool> writeFileEnabled_;
     static std::deque<EventStatistic::PointerEventRecord> pointerRecordDeque_;
 };
 } // namespace MMI
@@ -17,9 +17,13 @@
 
 #include <getopt.h>
 
+#include "dfx_hisysevent.h"
+#include "event_stage_tracer.h"
 #include "event_statistic.h"
 #include "input_device_manager.h"
 #include "input_event_handler.h"
+#include "input_event_pool.h"
+#include "scoped_time_cost.h"
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
 #include "i_input_windows_manager.h"
 #ifdef OHOS_BUILD_ENABLE_COMBINATION_KEY
@@ -98,6 +102,9 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
         { "cursor", no_argument, 0, 'c' },
         { "keycommand", no_argument, 0, 'k' },
         { "event", no_argument, 0, 'e' },
+        { "timecost", no_argument, 0, 't' },
+        { "latency", no_argument, 0, 'y' },
+        { "pool", no_argument, 0, 'p' },
         { nullptr, 0, 0, 0 }
     };
     if (args.empty()) {
@@ -125,7 +132,7 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
     }
     optind = 1;
     int32_t c;
-    while ((c = getopt_long (args.size(), argv, "hdlwusoifmcke", dumpOptions, &optionIndex)) != -1) {
+    while ((c = getopt_long (args.size(), argv, "hdlwusoifmcketyp", dumpOptions, &optionIndex)) != -1) {
         switch (c) {
             case 'h': {
                 DumpEventHelp(fd, args);
@@ -227,6 +234,21 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
                 EventStatistic::Dump(fd, args);
                 break;
             }
+            case 't': {
+                TimeCostStatistics::Dump(fd, args);
+#ifdef OHOS_BUILD_ENABLE_DFX_RADAR
+                DfxHisysevent::DumpApiCallTimes(fd);
+#endif // OHOS_BUILD_ENABLE_DFX_RADAR
+                break;
+            }
+            case 'y': {
+                EventStageTracer::Dump(fd, args);
+                break;
+            }
+            case 'p': {
+                InputEventPool::Dump(fd);
+                break;
+            }
             default: {
                 mprintf(fd, "cmd param is error\n");
                 DumpHelp(fd);
@@ -264,6 +286,9 @@ void EventDump::DumpHelp(int32_t fd)
     mprintf(fd, "      -c, --cursor: dump the cursor draw information\t");
     mprintf(fd, "      -k, --keycommand: dump the key command information\t");
     mprintf(fd, "      -e, --event: dump the libinput event information\t");
+    mprintf(fd, "      -t, --timecost: dump the time cost of the event handling sites and external api calls\t");
+    mprintf(fd, "      -y, --latency [on|off|clear|save]: dump the latency of each event handling stage\t");
+    mprintf(fd, "      -p, --pool: dump the hit rate and outstanding count of the input event pools\t");
 }
 } // namespace MMI
 } // namespace OHOS
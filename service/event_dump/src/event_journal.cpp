@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_journal.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "error_multimodal.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_HANDLER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventJournal"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr uint32_t JOURNAL_MAGIC { 0x4A455645 }; // "EVEJ"
+constexpr uint32_t JOURNAL_VERSION { 1 };
+constexpr mode_t JOURNAL_FILE_MODE { 0640 };
+} // namespace
+
+void JournalRing::Push(const JournalRecord &record)
+{
+    uint64_t pos = head_.load(std::memory_order_relaxed);
+    Slot &slot = slots_[pos % CAPACITY];
+    // An odd sequence marks the slot as being written, the even value 2 * (pos + 1) as holding pos.
+    slot.seq.store(2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.seq.store(2 * (pos + 1), std::memory_order_release);
+    head_.store(pos + 1, std::memory_order_release);
+}
+
+uint64_t JournalRing::GetHead() const
+{
+    return head_.load(std::memory_order_acquire);
+}
+
+bool JournalRing::Read(uint64_t pos, JournalRecord &record) const
+{
+    const Slot &slot = slots_[pos % CAPACITY];
+    uint64_t expected = 2 * (pos + 1);
+    if (slot.seq.load(std::memory_order_acquire) != expected) {
+        return false;
+    }
+    record = slot.record;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (slot.seq.load(std::memory_order_relaxed) == expected);
+}
+
+EventJournal::EventJournal(std::string path, std::string historyPath, uint32_t capacity)
+    : path_(std::move(path)), historyPath_(std::move(historyPath)), capacity_(capacity) {}
+
+EventJournal::~EventJournal()
+{
+    Close();
+}
+
+size_t EventJournal::GetMapSize() const
+{
+    return sizeof(Header) + static_cast<size_t>(capacity_) * sizeof(JournalRecord);
+}
+
+bool EventJournal::Open()
+{
+    if (capacity_ == 0) {
+        return false;
+    }
+    ++syscallCount_;
+    int32_t fd = open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, JOURNAL_FILE_MODE);
+    if (fd < 0) {
+        MMI_HILOGE("Open journal failed, errno:%{public}d", errno);
+        return false;
+    }
+    size_t mapSize = GetMapSize();
+    struct stat statbuf;
+    ++syscallCount_;
+    bool fresh = (fstat(fd, &statbuf) != 0) || (static_cast<size_t>(statbuf.st_size) != mapSize);
+    if (fresh) {
+        ++syscallCount_;
+        if (ftruncate(fd, static_cast<off_t>(mapSize)) != 0) {
+            MMI_HILOGE("Resize journal failed, errno:%{public}d", errno);
+            close(fd);
+            return false;
+        }
+    }
+    syscallCount_ += 2;
+    void *addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        MMI_HILOGE("Map journal failed, errno:%{public}d", errno);
+        return false;
+    }
+    header_ = static_cast<Header *>(addr);
+    records_ = reinterpret_cast<JournalRecord *>(static_cast<char *>(addr) + sizeof(Header));
+    if (fresh || header_->magic != JOURNAL_MAGIC || header_->version != JOURNAL_VERSION ||
+        header_->recordSize != sizeof(JournalRecord) || header_->capacity != capacity_ ||
+        header_->count > capacity_) {
+        *header_ = Header { JOURNAL_MAGIC, JOURNAL_VERSION, sizeof(JournalRecord), capacity_, 0 };
+    }
+    return true;
+}
+
+void EventJournal::Close()
+{
+    if (header_ == nullptr) {
+        return;
+    }
+    syscallCount_ += 2;
+    msync(header_, GetMapSize(), MS_ASYNC);
+    munmap(header_, GetMapSize());
+    header_ = nullptr;
+    records_ = nullptr;
+}
+
+bool EventJournal::Rotate()
+{
+    Close();
+    ++syscallCount_;
+    if (rename(path_.c_str(), historyPath_.c_str()) != 0) {
+        MMI_HILOGE("Rename journal failed, errno:%{public}d", errno);
+    }
+    return Open();
+}
+
+bool EventJournal::Append(const JournalRecord &record)
+{
+    if (header_ == nullptr && !Open()) {
+        return false;
+    }
+    if (header_->count >= capacity_ && !Rotate()) {
+        return false;
+    }
+    records_[header_->count] = record;
+    // The count is bumped after the copy, so a crash in between never exposes a torn record.
+    std::atomic_thread_fence(std::memory_order_release);
+    ++header_->count;
+    return true;
+}
+
+uint64_t EventJournal::GetCount() const
+{
+    return (header_ == nullptr) ? 0 : header_->count;
+}
+
+uint64_t EventJournal::GetSyscallCount() const
+{
+    return syscallCount_;
+}
+
+int32_t EventJournal::Load(const std::string &path, std::vector<JournalRecord> &records)
+{
+    int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        MMI_HILOGE("Open journal failed, errno:%{public}d", errno);
+        return RET_ERR;
+    }
+    Header header {};
+    if (pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+        header.magic != JOURNAL_MAGIC || header.version != JOURNAL_VERSION ||
+        header.recordSize != sizeof(JournalRecord) || header.count > header.capacity) {
+        MMI_HILOGE("Invalid journal header");
+        close(fd);
+        return RET_ERR;
+    }
+    size_t begin = records.size();
+    records.resize(begin + header.count);
+    size_t bytes = static_cast<size_t>(header.count) * sizeof(JournalRecord);
+    ssize_t ret = pread(fd, records.data() + begin, bytes, sizeof(Header));
+    close(fd);
+    if (ret != static_cast<ssize_t>(bytes)) {
+        MMI_HILOGE("Read journal failed");
+        records.resize(begin);
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+} // namespace MMI
+} // namespace OHOS
@@ -14,6 +14,9 @@
  */
 
 #include "event_statistic.h"
+
+#include <cinttypes>
+
 #include "util_ex.h"
 
 #undef MMI_LOG_DOMAIN
@@ -24,21 +27,22 @@
 namespace OHOS {
 namespace MMI {
 namespace {
-const char* EVENT_FILE_NAME = "/data/service/el1/public/multimodalinput/multimodal_event.dmp";
-const char* EVENT_FILE_NAME_HISTORY = "/data/service/el1/public/multimodalinput/multimodal_event_history.dmp";
-constexpr int32_t FILE_MAX_SIZE = 100 * 1024 * 1024;
-constexpr int32_t EVENT_OUT_SIZE = 30;
-constexpr int32_t FUNC_EXE_OK = 0;
-constexpr int32_t STRING_WIDTH = 3;
+const char* EVENT_JOURNAL_NAME = "/data/service/el1/public/multimodalinput/multimodal_event.journal";
+const char* EVENT_JOURNAL_NAME_HISTORY = "/data/service/el1/public/multimodalinput/multimodal_event_history.journal";
+constexpr uint32_t JOURNAL_CAPACITY = 64 * 1024;
+constexpr std::chrono::milliseconds JOURNAL_FLUSH_INTERVAL { 200 };
+constexpr uint64_t EVENT_OUT_SIZE = 30;
+constexpr int64_t MS_PER_SECOND = 1000;
 constexpr int32_t POINTER_RECORD_MAX_SIZE = 100;
+constexpr int32_t MAX_RECORD_BUTTON = 64;
 }
 
-std::queue<std::string> EventStatistic::eventQueue_;
-std::list<std::string> EventStatistic::dumperEventList_;
+JournalRing EventStatistic::journalRing_;
+std::vector<JournalRecord> EventStatistic::previousRecords_;
 std::mutex EventStatistic::queueMutex_;
 std::condition_variable EventStatistic::queueCondition_;
 std::deque<EventStatistic::PointerEventRecord> EventStatistic::pointerRecordDeque_;
-bool EventStatistic::writeFileEnabled_ = false;
+std::atomic<bool> EventStatistic::writeFileEnabled_ { false };
 static const std::unordered_map<int32_t, std::string> pointerActionMap = {
     { PointerEvent::POINTER_ACTION_CANCEL, "cancel" },
     { PointerEvent::POINTER_ACTION_DOWN, "down" },
@@ -91,25 +95,102 @@ static const std::unordered_map<int32_t, std::string> keyActionMap = {
     { KeyEvent::KEY_ACTION_UP, "key_action_up" },
 };
 
-std::string EventStatistic::ConvertInputEventToStr(const std::shared_ptr<InputEvent> eventPtr)
+namespace {
+void AppendRecordHeader(const JournalRecord &record, std::string &eventStr)
 {
-    auto nowTime = std::chrono::system_clock::now();
-    std::time_t timeT = std::chrono::system_clock::to_time_t(nowTime);
-    auto milsecsCount = std::chrono::duration_cast<std::chrono::milliseconds>(nowTime.time_since_epoch()).count();
-    std::string handleTime = ConvertTimeToStr(static_cast<int64_t>(timeT));
-    int32_t milsec = milsecsCount % 1000;
-    std::stringstream strStream;
-    strStream << std::left << std::setw(STRING_WIDTH) << milsec;
-    std::string milsecStr(strStream.str());
-    handleTime += "." + milsecStr;
-    std::string eventStr = "{";
-    eventStr += handleTime;
+    char milsec[8] = {0};
+    if (snprintf_s(milsec, sizeof(milsec), sizeof(milsec) - 1, "%-3d",
+        static_cast<int32_t>(record.handleTime % MS_PER_SECOND)) < 0) {
+        milsec[0] = '\0';
+    }
+    eventStr += "{";
+    eventStr += EventStatistic::ConvertTimeToStr(record.handleTime / MS_PER_SECOND);
+    eventStr += ".";
+    eventStr += milsec;
     eventStr += ",eventType:";
-    eventStr += ConvertEventTypeToString(eventPtr->GetEventType());
-    eventStr += ",actionTime:" + std::to_string(eventPtr->GetActionTime());
-    eventStr += ",deviceId:" + std::to_string(eventPtr->GetDeviceId());
+    eventStr += EventStatistic::ConvertEventTypeToString(record.eventType);
+    eventStr += ",actionTime:" + std::to_string(record.actionTime);
+    eventStr += ",deviceId:" + std::to_string(record.deviceId);
     eventStr += ",sourceType:";
-    eventStr += ConvertSourceTypeToString(eventPtr->GetSourceType());
+    eventStr += EventStatistic::ConvertSourceTypeToString(record.sourceType);
+}
+
+void AppendPointerRecord(const JournalRecord &record, std::string &eventStr)
+{
+    bool privacy = (record.flags & JOURNAL_FLAG_PRIVACY) != 0;
+    eventStr += ",pointerId:" + std::to_string(record.code);
+    eventStr += ",pointerAction:";
+    eventStr += EventStatistic::ConvertPointerActionToString(record.action, record.axes);
+    eventStr += ",buttonId:" + std::to_string(record.buttonId) + ",pointers:[";
+    size_t count = std::min<size_t>(record.itemCount, JOURNAL_MAX_POINTERS);
+    for (size_t i = 0; i < count; ++i) {
+        const JournalPointerItem &item = record.pointers[i];
+        eventStr += "{displayX:" + (privacy ? std::string("***") : std::to_string(item.displayX));
+        eventStr += ",displayY:" + (privacy ? std::string("***") : std::to_string(item.displayY));
+        eventStr += ",pressure:" + std::to_string(item.pressure);
+        eventStr += "}";
+        if (i + 1 != count) {
+            eventStr += ",";
+        }
+    }
+    eventStr += "],pressedButtons:[";
+    bool first = true;
+    for (int32_t button = 0; button < MAX_RECORD_BUTTON; ++button) {
+        if ((record.pressedButtons & (1ULL << button)) == 0) {
+            continue;
+        }
+        if (!first) {
+            eventStr += ",";
+        }
+        eventStr += std::to_string(button);
+        first = false;
+    }
+    eventStr += "]}";
+}
+
+void AppendKeyRecord(const JournalRecord &record, std::string &eventStr)
+{
+    bool privacy = (record.flags & JOURNAL_FLAG_PRIVACY) != 0;
+    eventStr += ",keyCode:" + (privacy ? std::string("***") : std::to_string(record.code));
+    eventStr += ",keyAction:";
+    eventStr += EventStatistic::ConvertKeyActionToString(record.action);
+    eventStr += ",keyItems:[";
+    size_t count = std::min<size_t>(record.itemCount, JOURNAL_MAX_KEY_ITEMS);
+    for (size_t i = 0; i < count; ++i) {
+        const JournalKeyItem &item = record.keys[i];
+        eventStr += "{pressed:" + std::to_string(item.pressed);
+        eventStr += ",deviceId:" + std::to_string(item.deviceId);
+        eventStr += ",keyCode:" + (privacy ? std::string("***") : std::to_string(item.keyCode));
+        eventStr += ",downTime:" + std::to_string(item.downTime);
+        eventStr += ",unicode:" + std::to_string(item.unicode) + "}";
+        if (i + 1 != count) {
+            eventStr += ",";
+        }
+    }
+    eventStr += "]}";
+}
+} // namespace
+
+void EventStatistic::FillRecord(InputEvent &event, JournalRecord &record)
+{
+    auto nowTime = std::chrono::system_clock::now();
+    record.handleTime = std::chrono::duration_cast<std::chrono::milliseconds>(nowTime.time_since_epoch()).count();
+    record.actionTime = event.GetActionTime();
+    record.eventType = event.GetEventType();
+    record.deviceId = event.GetDeviceId();
+    record.sourceType = event.GetSourceType();
+    if (event.HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
+        record.flags |= JOURNAL_FLAG_PRIVACY;
+    }
+}
+
+std::string EventStatistic::ConvertInputEventToStr(const std::shared_ptr<InputEvent> eventPtr)
+{
+    CHKPS(eventPtr);
+    JournalRecord record {};
+    FillRecord(*eventPtr, record);
+    std::string eventStr;
+    AppendRecordHeader(record, eventStr);
     return eventStr;
 }
 
@@ -126,6 +207,30 @@ std::string EventStatistic::ConvertTimeToStr(int64_t timestamp)
     return timeStr;
 }
 
+std::string EventStatistic::ConvertRecordToStr(const JournalRecord &record)
+{
+    std::string eventStr;
+    AppendRecordHeader(record, eventStr);
+    switch (record.eventType) {
+        case InputEvent::EVENT_TYPE_POINTER: {
+            AppendPointerRecord(record, eventStr);
+            break;
+        }
+        case InputEvent::EVENT_TYPE_KEY: {
+            AppendKeyRecord(record, eventStr);
+            break;
+        }
+        default: {
+            eventStr += ",switchValue:" + std::to_string(record.code);
+            eventStr += ",switchType:";
+            eventStr += ConvertSwitchTypeToString(record.action);
+            eventStr += "}";
+            break;
+        }
+    }
+    return eventStr;
+}
+
 void EventStatistic::PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr)
 {
     CHKPV(eventPtr);
@@ -139,99 +244,71 @@ void EventStatistic::PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr)
         MMI_HILOGD("PointEvent is filtered");
         return;
     }
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
-    eventStr += ",pointerId:" + std::to_string(eventPtr->GetPointerId());
-    eventStr += ",pointerAction:";
-    eventStr += ConvertPointerActionToString(eventPtr);
-    eventStr += ",buttonId:" + std::to_string(eventPtr->GetButtonId()) + ",pointers:[";
-    size_t pointerSize = 0;
+    JournalRecord record {};
+    FillRecord(*eventPtr, record);
+    record.action = pointerAction;
+    record.code = eventPtr->GetPointerId();
+    record.buttonId = eventPtr->GetButtonId();
+    record.axes = eventPtr->GetAxes();
+    bool privacy = (record.flags & JOURNAL_FLAG_PRIVACY) != 0;
     std::list<PointerEvent::PointerItem> pointerItems = eventPtr->GetAllPointerItems();
-    for (auto it = pointerItems.begin(); it != pointerItems.end(); it++) {
-        std::string displayX = "***";
-        std::string displayY = "***";
-        pointerSize++;
-        if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-            displayX = std::to_string((*it).GetDisplayX());
-            displayY = std::to_string((*it).GetDisplayY());
-        }
-        eventStr += "{";
-        eventStr += "displayX:" + displayX;
-        eventStr += ",displayY:" + displayY;
-        eventStr += ",pressure:" + std::to_string((*it).GetPressure());
-        eventStr += "}";
-        if (pointerSize != pointerItems.size()) {
-            eventStr += ",";
+    for (const auto &item : pointerItems) {
+        if (record.itemCount >= JOURNAL_MAX_POINTERS) {
+            break;
         }
+        JournalPointerItem &slot = record.pointers[record.itemCount++];
+        slot.displayX = privacy ? 0 : item.GetDisplayX();
+        slot.displayY = privacy ? 0 : item.GetDisplayY();
+        slot.pressure = item.GetPressure();
     }
-    eventStr += "],pressedButtons:[";
-    size_t buttonsSize = 0;
-    std::set<int32_t> pressedButtons = eventPtr->GetPressedButtons();
-    for (auto it = pressedButtons.begin(); it != pressedButtons.end(); it++) {
-        buttonsSize++;
-        eventStr += std::to_string(*it);
-        if (buttonsSize != pressedButtons.size()) {
-            eventStr += ",";
+    for (int32_t button : eventPtr->GetPressedButtons()) {
+        if (button >= 0 && button < MAX_RECORD_BUTTON) {
+            record.pressedButtons |= (1ULL << button);
         }
     }
-    eventStr += "]";
-    eventStr += "}";
-    PushEventStr(eventStr);
+    PushRecord(record);
 }
 
 void EventStatistic::PushKeyEvent(std::shared_ptr<KeyEvent> eventPtr)
 {
     CHKPV(eventPtr);
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
-    std::string keyCode = "***";
-    if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-        keyCode = std::to_string(eventPtr->GetKeyCode());
-    }
-    eventStr += ",keyCode:" + keyCode;
-    eventStr += ",keyAction:";
-    eventStr += ConvertKeyActionToString(eventPtr->GetKeyAction());
+    JournalRecord record {};
+    FillRecord(*eventPtr, record);
+    bool privacy = (record.flags & JOURNAL_FLAG_PRIVACY) != 0;
+    record.action = eventPtr->GetKeyAction();
+    record.code = privacy ? 0 : eventPtr->GetKeyCode();
     auto keyItems = eventPtr->GetKeyItems();
-    eventStr += ",keyItems:[";
-    for (size_t i = 0; i < keyItems.size(); i++) {
-        std::string keyItemCode = "***";
-        int32_t pressed = keyItems[i].IsPressed() ? 1 : 0;
-        if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-            keyItemCode = std::to_string(keyItems[i].GetKeyCode());
-        }
-        eventStr += "{pressed:" + std::to_string(pressed);
-        eventStr += ",deviceId:" + std::to_string(keyItems[i].GetDeviceId());
-        eventStr += ",keyCode:" + keyItemCode;
-        eventStr += ",downTime:" + std::to_string(keyItems[i].GetDownTime());
-        eventStr += ",unicode:" + std::to_string(keyItems[i].GetUnicode()) + "}";
-        if (i != keyItems.size() - 1) {
-            eventStr += ",";
+    for (const auto &keyItem : keyItems) {
+        if (record.itemCount >= JOURNAL_MAX_KEY_ITEMS) {
+            break;
         }
+        JournalKeyItem &slot = record.keys[record.itemCount++];
+        slot.downTime = keyItem.GetDownTime();
+        slot.deviceId = keyItem.GetDeviceId();
+        slot.keyCode = privacy ? 0 : keyItem.GetKeyCode();
+        slot.unicode = keyItem.GetUnicode();
+        slot.pressed = keyItem.IsPressed() ? 1 : 0;
     }
-    eventStr += "]";
-    eventStr += "}";
-    PushEventStr(eventStr);
+    PushRecord(record);
 }
 
 void EventStatistic::PushSwitchEvent(std::shared_ptr<SwitchEvent> eventPtr)
 {
     CHKPV(eventPtr);
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
-    eventStr += ",switchValue:" + std::to_string(eventPtr->GetSwitchValue());
-    eventStr += ",switchType:";
-    eventStr += ConvertSwitchTypeToString(eventPtr->GetSwitchType());
-    eventStr += "}";
-    PushEventStr(eventStr);
+    JournalRecord record {};
+    FillRecord(*eventPtr, record);
+    record.action = eventPtr->GetSwitchType();
+    record.code = eventPtr->GetSwitchValue();
+    PushRecord(record);
 }
 
-void EventStatistic::PushEventStr(std::string eventStr)
+void EventStatistic::PushRecord(const JournalRecord &record)
 {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    dumperEventList_.push_back(eventStr);
-    if (dumperEventList_.size() > EVENT_OUT_SIZE) {
-        dumperEventList_.pop_front();
-    }
-    if (writeFileEnabled_) {
-        eventQueue_.push(eventStr);
-        queueCondition_.notify_all();
+    journalRing_.Push(record);
+    // Wake the writer early when half of the ring is pending, otherwise it flushes on its own interval.
+    if (writeFileEnabled_.load(std::memory_order_relaxed) &&
+        (journalRing_.GetHead() % (JournalRing::CAPACITY / 2) == 0)) {
+        queueCondition_.notify_one();
     }
 }
 
@@ -293,50 +370,72 @@ int32_t EventStatistic::QueryPointerRecord(int32_t count, std::vector<std::share
     return RET_OK;
 }
 
-std::string EventStatistic::PopEvent()
+uint64_t EventStatistic::FlushJournal(EventJournal &journal, uint64_t cursor)
 {
-    std::unique_lock<std::mutex> lock(queueMutex_);
-    if (eventQueue_.empty()) {
-        queueCondition_.wait(lock, []() { return !eventQueue_.empty(); });
+    uint64_t head = journalRing_.GetHead();
+    if (head - cursor > JournalRing::CAPACITY) {
+        MMI_HILOGW("Journal writer fell behind, %{public}" PRIu64 " records lost",
+            head - cursor - JournalRing::CAPACITY);
+        cursor = head - JournalRing::CAPACITY;
     }
-    std::string eventStr = eventQueue_.front();
-    eventQueue_.pop();
-    return eventStr;
+    JournalRecord record;
+    for (; cursor < head; ++cursor) {
+        if (journalRing_.Read(cursor, record)) {
+            journal.Append(record);
+        }
+    }
+    return head;
+}
+
+void EventStatistic::LoadPreviousJournal()
+{
+    std::vector<JournalRecord> records;
+    for (const char *path : { EVENT_JOURNAL_NAME_HISTORY, EVENT_JOURNAL_NAME }) {
+        if (access(path, F_OK) == 0 && EventJournal::Load(path, records) != RET_OK) {
+            MMI_HILOGW("Skip unreadable journal");
+        }
+    }
+    if (records.size() > EVENT_OUT_SIZE) {
+        records.erase(records.begin(), records.end() - EVENT_OUT_SIZE);
+    }
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    previousRecords_ = std::move(records);
 }
 
 void EventStatistic::WriteEventFile()
 {
+    // Read before the first append, so the files only hold records from before this start.
+    LoadPreviousJournal();
+    EventJournal journal(EVENT_JOURNAL_NAME, EVENT_JOURNAL_NAME_HISTORY, JOURNAL_CAPACITY);
+    // Starting from zero persists whatever the ring still holds from before the writer started.
+    uint64_t cursor = 0;
     while (writeFileEnabled_) {
-        std::string eventStr = PopEvent();
-        struct stat statbuf;
-        int32_t fileSize = 0;
-        if (stat(EVENT_FILE_NAME, &statbuf) == FUNC_EXE_OK) {
-            fileSize = static_cast<int32_t>(statbuf.st_size);
-        }
-        if (fileSize >= FILE_MAX_SIZE) {
-            if (access(EVENT_FILE_NAME_HISTORY, F_OK) == FUNC_EXE_OK &&
-                remove(EVENT_FILE_NAME_HISTORY) != FUNC_EXE_OK) {
-                MMI_HILOGE("Remove history file failed");
-            }
-            if (rename(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY) != FUNC_EXE_OK) {
-                MMI_HILOGE("Rename file failed");
-            }
-        }
-        std::ofstream file(EVENT_FILE_NAME, std::ios::app);
-        if (file.is_open()) {
-            file << eventStr << std::endl;
-            file.close();
-        } else {
-            MMI_HILOGE("Open file failed");
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCondition_.wait_for(lock, JOURNAL_FLUSH_INTERVAL);
         }
+        cursor = FlushJournal(journal, cursor);
     }
+    FlushJournal(journal, cursor);
 }
 
 void EventStatistic::Dump(int32_t fd, const std::vector<std::string> &args)
 {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    for (auto it = dumperEventList_.begin(); it != dumperEventList_.end(); ++it) {
-        mprintf(fd, (*it).c_str());
+    uint64_t head = journalRing_.GetHead();
+    if (head < EVENT_OUT_SIZE) {
+        // The ring starts empty with the service, the rest comes from the journal of the previous run.
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        size_t count = std::min(static_cast<size_t>(EVENT_OUT_SIZE - head), previousRecords_.size());
+        for (auto it = previousRecords_.end() - count; it != previousRecords_.end(); ++it) {
+            mprintf(fd, "%s", ConvertRecordToStr(*it).c_str());
+        }
+    }
+    uint64_t pos = (head > EVENT_OUT_SIZE) ? (head - EVENT_OUT_SIZE) : 0;
+    JournalRecord record;
+    for (; pos < head; ++pos) {
+        if (journalRing_.Read(pos, record)) {
+            mprintf(fd, "%s", ConvertRecordToStr(record).c_str());
+        }
     }
 }
 
@@ -395,8 +494,12 @@ const char* EventStatistic::ConvertSourceTypeToString(int32_t sourceType)
  
 const char* EventStatistic::ConvertPointerActionToString(std::shared_ptr<PointerEvent> eventPtr)
 {
-    int32_t pointerAction = eventPtr->GetPointerAction();
-    int32_t axes = eventPtr->GetAxes();
+    CHKPR(eventPtr, "unknown");
+    return ConvertPointerActionToString(eventPtr->GetPointerAction(), eventPtr->GetAxes());
+}
+
+const char* EventStatistic::ConvertPointerActionToString(int32_t pointerAction, uint32_t axes)
+{
     if (pointerAction == PointerEvent::POINTER_ACTION_AXIS_BEGIN) {
         if (PointerEvent::HasAxis(axes, PointerEvent::AXIS_TYPE_SCROLL_VERTICAL) ||
             PointerEvent::HasAxis(axes, PointerEvent::AXIS_TYPE_SCROLL_HORIZONTAL)) {
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "error_multimodal.h"
+#include "event_journal.h"
+#include "event_statistic.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventJournalTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+const char* JOURNAL_PATH = "/data/service/el1/public/multimodalinput/event_journal_test.journal";
+const char* JOURNAL_HISTORY_PATH = "/data/service/el1/public/multimodalinput/event_journal_test_history.journal";
+constexpr uint32_t SMALL_CAPACITY { 4 };
+constexpr int32_t N_EVENTS { 10000 };
+// EventStatistic::WriteEventFile used to stat the file, then open, write and close it for every event.
+constexpr uint64_t TEXT_SYSCALLS_PER_EVENT { 4 };
+
+JournalRecord MakeRecord(int32_t code)
+{
+    JournalRecord record {};
+    record.eventType = InputEvent::EVENT_TYPE_KEY;
+    record.code = code;
+    return record;
+}
+} // namespace
+
+class EventJournalTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+    void SetUp()
+    {
+        unlink(JOURNAL_PATH);
+        unlink(JOURNAL_HISTORY_PATH);
+    }
+    void TearDown()
+    {
+        unlink(JOURNAL_PATH);
+        unlink(JOURNAL_HISTORY_PATH);
+    }
+};
+
+/**
+ * @tc.name: EventJournalTest_JournalRing_001
+ * @tc.desc: Verify the ring rejects positions that were not pushed yet or were overwritten
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventJournalTest, EventJournalTest_JournalRing_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto ring = std::make_unique<JournalRing>();
+    JournalRecord record {};
+    EXPECT_FALSE(ring->Read(0, record));
+    uint64_t total = JournalRing::CAPACITY + 3;
+    for (uint64_t i = 0; i < total; ++i) {
+        ring->Push(MakeRecord(static_cast<int32_t>(i)));
+    }
+    EXPECT_EQ(ring->GetHead(), total);
+    EXPECT_FALSE(ring->Read(2, record));
+    EXPECT_FALSE(ring->Read(total, record));
+    ASSERT_TRUE(ring->Read(3, record));
+    EXPECT_EQ(record.code, 3);
+    ASSERT_TRUE(ring->Read(total - 1, record));
+    EXPECT_EQ(record.code, static_cast<int32_t>(total - 1));
+}
+
+/**
+ * @tc.name: EventJournalTest_Append_001
+ * @tc.desc: Verify records survive reopening and a full journal rotates into the history file
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventJournalTest, EventJournalTest_Append_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    {
+        EventJournal journal(JOURNAL_PATH, JOURNAL_HISTORY_PATH, SMALL_CAPACITY);
+        ASSERT_TRUE(journal.Append(MakeRecord(0)));
+        ASSERT_TRUE(journal.Append(MakeRecord(1)));
+    }
+    EventJournal journal(JOURNAL_PATH, JOURNAL_HISTORY_PATH, SMALL_CAPACITY);
+    for (int32_t code = 2; code <= SMALL_CAPACITY; ++code) {
+        ASSERT_TRUE(journal.Append(MakeRecord(code)));
+    }
+    EXPECT_EQ(journal.GetCount(), 1U);
+    journal.Close();
+
+    std::vector<JournalRecord> records;
+    ASSERT_EQ(EventJournal::Load(JOURNAL_HISTORY_PATH, records), RET_OK);
+    ASSERT_EQ(EventJournal::Load(JOURNAL_PATH, records), RET_OK);
+    ASSERT_EQ(records.size(), SMALL_CAPACITY + 1);
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].code, static_cast<int32_t>(i));
+    }
+}
+
+/**
+ * @tc.name: EventJournalTest_Load_001
+ * @tc.desc: Verify loading rejects missing files and files that are not journals
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventJournalTest, EventJournalTest_Load_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<JournalRecord> records;
+    EXPECT_EQ(EventJournal::Load(JOURNAL_PATH, records), RET_ERR);
+    FILE *file = fopen(JOURNAL_PATH, "w");
+    ASSERT_NE(file, nullptr);
+    fputs("{1970-01-01 08:00:00.0  ,eventType:key}\n", file);
+    fclose(file);
+    EXPECT_EQ(EventJournal::Load(JOURNAL_PATH, records), RET_ERR);
+    EXPECT_TRUE(records.empty());
+}
+
+/**
+ * @tc.name: EventJournalTest_Append_002
+ * @tc.desc: Verify 10k pushed key events reach the ring and 10k appended records load back in order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventJournalTest, EventJournalTest_Append_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    uint64_t head = EventStatistic::journalRing_.GetHead();
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        EventStatistic::PushKeyEvent(keyEvent);
+    }
+    EXPECT_EQ(EventStatistic::journalRing_.GetHead(), head + N_EVENTS);
+    JournalRecord latest {};
+    ASSERT_TRUE(EventStatistic::journalRing_.Read(head + N_EVENTS - 1, latest));
+    EXPECT_EQ(latest.code, KeyEvent::KEYCODE_A);
+
+    EventJournal journal(JOURNAL_PATH, JOURNAL_HISTORY_PATH, N_EVENTS);
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        ASSERT_TRUE(journal.Append(MakeRecord(i)));
+    }
+    EXPECT_EQ(journal.GetCount(), static_cast<uint64_t>(N_EVENTS));
+    journal.Close();
+    std::vector<JournalRecord> records;
+    ASSERT_EQ(EventJournal::Load(JOURNAL_PATH, records), RET_OK);
+    ASSERT_EQ(records.size(), static_cast<size_t>(N_EVENTS));
+    EXPECT_EQ(records.front().code, 0);
+    EXPECT_EQ(records.back().code, N_EVENTS - 1);
+}
+
+/**
+ * @tc.name: EventJournalTest_Benchmark_001
+ * @tc.desc: Measure the input thread cost per event and the I/O syscalls needed to persist 10k events
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(EventJournalTest, EventJournalTest_Benchmark_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    KeyEvent::KeyItem keyItem;
+    keyItem.SetKeyCode(KeyEvent::KEYCODE_A);
+    keyItem.SetPressed(true);
+    keyEvent->AddKeyItem(keyItem);
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        EventStatistic::PushKeyEvent(keyEvent);
+    }
+    auto pushCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count() / N_EVENTS;
+
+    begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        EventStatistic::ConvertInputEventToStr(keyEvent);
+    }
+    auto formatCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count() / N_EVENTS;
+
+    EventJournal journal(JOURNAL_PATH, JOURNAL_HISTORY_PATH, N_EVENTS);
+    JournalRecord record = MakeRecord(KeyEvent::KEYCODE_A);
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        ASSERT_TRUE(journal.Append(record));
+    }
+    uint64_t syscalls = journal.GetSyscallCount();
+    MMI_HILOGI("Push:%{public}lld ns/event, text formatting:%{public}lld ns/event, "
+        "syscalls for %{public}d events:%{public}llu, text writer:%{public}llu",
+        static_cast<long long>(pushCost), static_cast<long long>(formatCost), N_EVENTS,
+        static_cast<unsigned long long>(syscalls),
+        static_cast<unsigned long long>(TEXT_SYSCALLS_PER_EVENT * N_EVENTS));
+    EXPECT_LT(syscalls, TEXT_SYSCALLS_PER_EVENT * N_EVENTS / 1000);
+}
+} // namespace MMI
+} // namespace OHOS
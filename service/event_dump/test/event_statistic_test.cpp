@@ -29,7 +29,6 @@ constexpr int32_t EVENT_OUT_SIZE { 30 };
 constexpr int32_t POINTER_RECORD_MAX_SIZE { 100 };
 const char* EVENT_FILE_NAME = "/data/service/el1/public/multimodalinput/multimodal_event.dmp";
 const char* EVENT_FILE_NAME_HISTORY = "/data/service/el1/public/multimodalinput/multimodal_event_history.dmp";
-constexpr int32_t FILE_MAX_SIZE = 100 * 1024 * 1024;
 } // namespace
 
 class EventStatisticTest : public testing::Test {
@@ -145,25 +144,26 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushSwitchEvent, TestSize.Level1
 }
 
 /**
- * @tc.name: EventDumpTest_PushEventStr
- * @tc.desc: Event dump PushEventStr
+ * @tc.name: EventDumpTest_PushRecord
+ * @tc.desc: Event dump PushRecord keeps the latest records in the ring
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PushEventStr, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_PushRecord, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    eventStatistic.writeFileEnabled_ = true;
-    std::string str = "test_push_event_str";
-    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushEventStr(str));
-
-    for (auto i = 0; i < EVENT_OUT_SIZE - 1; i++) {
-        auto inputEvent1 = std::make_shared<InputEvent>(2);
-        eventStatistic.dumperEventList_.push_back(EventStatistic::ConvertInputEventToStr(inputEvent1));
+    uint64_t head = eventStatistic.journalRing_.GetHead();
+    JournalRecord record {};
+    record.eventType = InputEvent::EVENT_TYPE_KEY;
+    for (int32_t i = 0; i < EVENT_OUT_SIZE; i++) {
+        record.code = i;
+        ASSERT_NO_FATAL_FAILURE(eventStatistic.PushRecord(record));
     }
-    eventStatistic.writeFileEnabled_ = false;
-    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushEventStr(str));
+    EXPECT_EQ(eventStatistic.journalRing_.GetHead(), head + EVENT_OUT_SIZE);
+    JournalRecord latest {};
+    ASSERT_TRUE(eventStatistic.journalRing_.Read(head + EVENT_OUT_SIZE - 1, latest));
+    EXPECT_EQ(latest.code, EVENT_OUT_SIZE - 1);
 }
 
 /**
@@ -178,10 +178,11 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_Dump, TestSize.Level1)
     EventStatistic eventStatistic;
     int32_t fd = 0;
     std::vector<std::string> dumpStr;
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     for (auto i = 0; i < 5; i++) {
-        std::string str = "EventStatistic Test Dump ";
-        eventStatistic.dumperEventList_.push_back(str);
-        dumpStr.push_back(str);
+        eventStatistic.PushKeyEvent(keyEvent);
+        dumpStr.push_back("EventStatistic Test Dump ");
     }
     ASSERT_NO_FATAL_FAILURE(eventStatistic.Dump(fd, dumpStr));
 }
@@ -768,57 +769,82 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_QueryPointerRecord_009, TestSize
 }
 
 /**
- * @tc.name: EventStatisticTest_PopEvent_001
- * @tc.desc: Verify PopEvent returns the correct event string when queue is not empty.
+ * @tc.name: EventStatisticTest_ConvertRecordToStr_001
+ * @tc.desc: Verify a pointer record renders in the dump text format, coordinates hidden in privacy mode
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PopEvent_001, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_ConvertRecordToStr_001, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-        eventStatistic.eventQueue_.push("TestEvent1");
-        eventStatistic.queueCondition_.notify_one();
-    }
-    std::string eventStr = eventStatistic.PopEvent();
-    EXPECT_EQ(eventStr, "TestEvent1");
+    auto pointerEvent = PointerEvent::Create();
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetButtonId(PointerEvent::MOUSE_BUTTON_LEFT);
+    pointerEvent->SetButtonPressed(PointerEvent::MOUSE_BUTTON_LEFT);
+    pointerEvent->SetButtonPressed(PointerEvent::MOUSE_BUTTON_RIGHT);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(120);
+    item.SetDisplayY(240);
+    pointerEvent->AddPointerItem(item);
+    uint64_t head = eventStatistic.journalRing_.GetHead();
+    eventStatistic.PushPointerEvent(pointerEvent);
+    JournalRecord record {};
+    ASSERT_TRUE(eventStatistic.journalRing_.Read(head, record));
+    std::string str = eventStatistic.ConvertRecordToStr(record);
+    EXPECT_NE(str.find(",pointerAction:down,buttonId:0,pointers:[{displayX:120,displayY:240,pressure:"),
+        std::string::npos);
+    EXPECT_NE(str.find("],pressedButtons:[0,1]}"), std::string::npos);
+
+    pointerEvent->AddFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE);
+    eventStatistic.PushPointerEvent(pointerEvent);
+    ASSERT_TRUE(eventStatistic.journalRing_.Read(head + 1, record));
+    EXPECT_EQ(record.pointers[0].displayX, 0);
+    str = eventStatistic.ConvertRecordToStr(record);
+    EXPECT_NE(str.find("{displayX:***,displayY:***"), std::string::npos);
 }
 
 /**
- * @tc.name: EventStatisticTest_PopEvent_002
- * @tc.desc: Verify PopEvent blocks until eventQueue_ is filled (using thread).
+ * @tc.name: EventStatisticTest_ConvertRecordToStr_002
+ * @tc.desc: Verify key and switch records render in the dump text format
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PopEvent_002, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_ConvertRecordToStr_002, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-    }
-    std::thread producer([&eventStatistic]() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("DelayedEvent");
-        eventStatistic.queueCondition_.notify_one();
-    });
-    std::string result = eventStatistic.PopEvent();
-    producer.join();
-    EXPECT_EQ(result, "DelayedEvent");
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+    KeyEvent::KeyItem keyItem;
+    keyItem.SetKeyCode(KeyEvent::KEYCODE_A);
+    keyItem.SetDeviceId(0);
+    keyItem.SetDownTime(100);
+    keyItem.SetPressed(true);
+    keyEvent->AddKeyItem(keyItem);
+    uint64_t head = eventStatistic.journalRing_.GetHead();
+    eventStatistic.PushKeyEvent(keyEvent);
+    JournalRecord record {};
+    ASSERT_TRUE(eventStatistic.journalRing_.Read(head, record));
+    std::string expected = ",keyCode:" + std::to_string(KeyEvent::KEYCODE_A) + ",keyAction:key_action_up,keyItems:[" +
+        "{pressed:1,deviceId:0,keyCode:" + std::to_string(KeyEvent::KEYCODE_A) + ",downTime:100,unicode:0}]}";
+    EXPECT_NE(eventStatistic.ConvertRecordToStr(record).find(expected), std::string::npos);
+
+    auto switchEvent = std::make_shared<SwitchEvent>(1);
+    switchEvent->SetSwitchType(SwitchEvent::SWITCH_LID);
+    eventStatistic.PushSwitchEvent(switchEvent);
+    ASSERT_TRUE(eventStatistic.journalRing_.Read(head + 1, record));
+    EXPECT_NE(eventStatistic.ConvertRecordToStr(record).find(",switchValue:1,switchType:switch_lid}"),
+        std::string::npos);
 }
 
 /**
  * @tc.name: EventStatisticTest_WriteEventFile_001
- * @tc.desc: Verify WriteEventFile writes event string into the file
+ * @tc.desc: Verify WriteEventFile persists pushed events into the journal file
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -826,44 +852,31 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_001, TestSize.Lev
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-    }
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("TestEventFile");
-        eventStatistic.queueCondition_.notify_one();
-    }
+    auto switchEvent = std::make_shared<SwitchEvent>(1);
+    switchEvent->SetSwitchType(SwitchEvent::SWITCH_TABLET);
+    eventStatistic.PushSwitchEvent(switchEvent);
     eventStatistic.writeFileEnabled_ = true;
     std::thread writer([&eventStatistic]() {
         eventStatistic.WriteEventFile();
     });
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     eventStatistic.writeFileEnabled_ = false;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("Exit");
-        eventStatistic.queueCondition_.notify_one();
-    }
+    eventStatistic.queueCondition_.notify_all();
     writer.join();
-    std::ifstream file(EVENT_FILE_NAME);
-    ASSERT_TRUE(file.is_open());
-    std::string content;
-    std::getline(file, content);
-    file.close();
-    EXPECT_EQ(content, "TestEventFile");
+    std::vector<JournalRecord> records;
+    ASSERT_EQ(EventJournal::Load(EVENT_FILE_NAME, records), RET_OK);
+    ASSERT_FALSE(records.empty());
+    EXPECT_NE(eventStatistic.ConvertRecordToStr(records.back()).find(",switchValue:1,switchType:switch_tablet}"),
+        std::string::npos);
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
 }
 
 /**
  * @tc.name: EventStatisticTest_WriteEventFile_002
- * @tc.desc: Verify WriteEventFile rotates file when file exceeds FILE_MAX_SIZE
+ * @tc.desc: Verify WriteEventFile replaces a file that is not a journal
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -872,28 +885,22 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_002, TestSize.Lev
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
     {
-        std::ofstream bigFile(EVENT_FILE_NAME);
-        bigFile << std::string(FILE_MAX_SIZE + 10, 'X');
-        bigFile.close();
-    }
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("RotateEvent");
-        eventStatistic.queueCondition_.notify_one();
+        std::ofstream textFile(EVENT_FILE_NAME);
+        textFile << "{2024-01-01 00:00:00.0  ,eventType:key}" << std::endl;
+        textFile.close();
     }
+    eventStatistic.PushSwitchEvent(std::make_shared<SwitchEvent>(0));
     eventStatistic.writeFileEnabled_ = true;
     std::thread writer([&eventStatistic]() {
         eventStatistic.WriteEventFile();
     });
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     eventStatistic.writeFileEnabled_ = false;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("Exit");
-        eventStatistic.queueCondition_.notify_one();
-    }
+    eventStatistic.queueCondition_.notify_all();
     writer.join();
-    EXPECT_EQ(access(EVENT_FILE_NAME_HISTORY, F_OK), 0);
+    std::vector<JournalRecord> records;
+    ASSERT_EQ(EventJournal::Load(EVENT_FILE_NAME, records), RET_OK);
+    EXPECT_FALSE(records.empty());
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
 }
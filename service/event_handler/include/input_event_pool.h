@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_EVENT_POOL_H
+#define INPUT_EVENT_POOL_H
+
+#include <cstdint>
+#include <memory>
+
+#include "key_event.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace MMI {
+/**
+ * Copies of pointer and key events made per event on the dispatch path. The copy and its shared_ptr control block
+ * live in one block taken from a small cache of the calling thread, and the block goes back to the cache of the
+ * thread dropping the last reference. The events themselves are not recycled: their assignment is deleted and
+ * Reset() leaves part of the state in place, so every copy is constructed from scratch. That includes the pointer
+ * item list and the other containers of each copy, which are still allocated from the heap with no capacity kept
+ * from earlier copies.
+ */
+class InputEventPool final {
+public:
+    enum PoolKind : int32_t {
+        POINTER_EVENT = 0,
+        KEY_EVENT,
+        KIND_COUNT
+    };
+
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t outstanding { 0 };
+    };
+
+    // Blocks kept per thread and per kind, further blocks are freed.
+    static constexpr size_t MAX_CACHED_BLOCKS { 64 };
+
+    // Like std::make_shared, allocation failure is fatal, so the copy is never nullptr.
+    static std::shared_ptr<PointerEvent> Clone(const PointerEvent &other);
+    static std::shared_ptr<KeyEvent> Clone(const KeyEvent &other);
+    static Statistics GetStatistics(PoolKind kind);
+    // Number of blocks cached by the calling thread.
+    static size_t GetCachedCount(PoolKind kind);
+    static void Dump(int32_t fd);
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // INPUT_EVENT_POOL_H
@@ -22,6 +22,7 @@
 #ifdef OHOS_BUILD_ENABLE_TOUCH
 #include "event_resample.h"
 #endif // OHOS_BUILD_ENABLE_TOUCH
+#include "event_stage_tracer.h"
 #include "event_statistic.h"
 #ifdef OHOS_BUILD_ENABLE_FINGERPRINT
 #include "fingerprint_event_processor.h"
@@ -38,7 +39,7 @@
 #include "libinput_adapter.h"
 #include "mmi_log.h"
 #include "multimodal_input_preferences_manager.h"
-#include "time_cost_chk.h"
+#include "scoped_time_cost.h"
 #include "timer_manager.h"
 #include "touch_event_normalize.h"
 #ifdef OHOS_BUILD_ENABLE_POINTER
@@ -136,6 +137,7 @@ void EventNormalizeHandler::HandleEvent(libinput_event* event, int64_t frameTime
     if (event == nullptr) {
         return;
     }
+    EventStageTracer::MarkNormalize();
     DfxHisysevent::GetDispStartTime();
     auto type = libinput_event_get_type(event);
 
@@ -159,7 +161,7 @@ void EventNormalizeHandler::HandleEvent(libinput_event* event, int64_t frameTime
         return;
     }
     
-    TimeCostChk chk("HandleLibinputEvent", "overtime 1000(us)", MAX_INPUT_EVENT_TIME, type);
+    ScopedTimeCost timeCost(TimeCostSite::LIBINPUT_EVENT, type);
     if (type == LIBINPUT_EVENT_TOUCH_FRAME) {
         MMI_HILOGD("This touch event is LIBINPUT_EVENT_TOUCH_FRAME type:%{public}d", type);
         return;
@@ -730,10 +732,10 @@ int32_t EventNormalizeHandler::HandleTouchEvent(libinput_event* event, int64_t f
             OHOS::ResourceSchedule::ResType::RES_TYPE_CLICK_RECOGNIZE,
             OHOS::ResourceSchedule::ResType::ClickEventType::TOUCH_EVENT_DOWN_MMI,
             mapPayload);
-        [[ maybe_unused ]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        [[ maybe_unused ]] auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
+        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
         mapPayload.clear();
     }
@@ -907,7 +909,10 @@ int32_t EventNormalizeHandler::HandleJoystickAxisEvent(libinput_event *event)
     BytraceAdapter::StartPackageEvent("package joystick axis event");
     auto pointerEvent = joystick_.OnAxisEvent(event);
     BytraceAdapter::StopPackageEvent();
-    CHKPR(pointerEvent, ERROR_NULL_POINTER);
+    if (pointerEvent == nullptr) {
+        MMI_HILOGD("Joystick axis event suppressed");
+        return RET_OK;
+    }
     PointerEventSetPressedKeys(pointerEvent);
     BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_START);
     EventStatistic::PushPointerEvent(pointerEvent);
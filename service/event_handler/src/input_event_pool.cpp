@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_pool.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <new>
+
+#include "mmi_log.h"
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputEventPool"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr double PERCENT { 100.0 };
+constexpr const char *KIND_NAMES[InputEventPool::KIND_COUNT] { "PointerEvent", "KeyEvent" };
+
+struct PoolCounters {
+    std::atomic<uint64_t> hits { 0 };
+    std::atomic<uint64_t> misses { 0 };
+    std::atomic<uint64_t> released { 0 };
+};
+
+PoolCounters g_counters[InputEventPool::KIND_COUNT];
+
+// Free blocks of one kind cached by one thread. All blocks of a kind have the size of its control block.
+template <InputEventPool::PoolKind KIND>
+class BlockCache final {
+public:
+    static void *Take(size_t size)
+    {
+        Cache *cache = GetCache();
+        if ((cache == nullptr) || (cache->count == 0) || (cache->blockSize != size)) {
+            return nullptr;
+        }
+        return cache->blocks[--cache->count];
+    }
+
+    static bool Put(void *block, size_t size)
+    {
+        Cache *cache = GetCache();
+        if ((cache == nullptr) || (cache->count >= InputEventPool::MAX_CACHED_BLOCKS)) {
+            return false;
+        }
+        if (cache->count == 0) {
+            cache->blockSize = size;
+        } else if (cache->blockSize != size) {
+            return false;
+        }
+        cache->blocks[cache->count++] = block;
+        return true;
+    }
+
+    static size_t GetCount()
+    {
+        Cache *cache = GetCache();
+        return (cache != nullptr ? cache->count : 0);
+    }
+
+private:
+    struct Cache {
+        ~Cache()
+        {
+            destroyed_ = true;
+            for (size_t i = 0; i < count; ++i) {
+                ::operator delete(blocks[i]);
+            }
+            count = 0;
+        }
+
+        void *blocks[InputEventPool::MAX_CACHED_BLOCKS] {};
+        size_t count { 0 };
+        size_t blockSize { 0 };
+    };
+
+    // Events may be released by other thread_local objects after the cache of their thread is gone.
+    static Cache *GetCache()
+    {
+        if (destroyed_) {
+            return nullptr;
+        }
+        thread_local Cache cache;
+        return &cache;
+    }
+
+    static thread_local bool destroyed_;
+};
+
+template <InputEventPool::PoolKind KIND>
+thread_local bool BlockCache<KIND>::destroyed_ { false };
+
+template <typename T, InputEventPool::PoolKind KIND>
+class PoolAllocator final {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = PoolAllocator<U, KIND>;
+    };
+
+    PoolAllocator() = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U, KIND> &) noexcept {}
+
+    T *allocate(size_t n)
+    {
+        if (n == 1) {
+            void *block = BlockCache<KIND>::Take(sizeof(T));
+            if (block != nullptr) {
+                g_counters[KIND].hits.fetch_add(1, std::memory_order_relaxed);
+                return static_cast<T *>(block);
+            }
+        }
+        g_counters[KIND].misses.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t n) noexcept
+    {
+        g_counters[KIND].released.fetch_add(1, std::memory_order_relaxed);
+        if ((n == 1) && BlockCache<KIND>::Put(ptr, sizeof(T))) {
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U, KIND> &) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U, KIND> &) const noexcept
+    {
+        return false;
+    }
+};
+} // namespace
+
+std::shared_ptr<PointerEvent> InputEventPool::Clone(const PointerEvent &other)
+{
+    return std::allocate_shared<PointerEvent>(PoolAllocator<PointerEvent, POINTER_EVENT>(), other);
+}
+
+std::shared_ptr<KeyEvent> InputEventPool::Clone(const KeyEvent &other)
+{
+    return std::allocate_shared<KeyEvent>(PoolAllocator<KeyEvent, KEY_EVENT>(), other);
+}
+
+InputEventPool::Statistics InputEventPool::GetStatistics(PoolKind kind)
+{
+    Statistics statistics;
+    if ((kind < 0) || (kind >= KIND_COUNT)) {
+        return statistics;
+    }
+    // Read released first, so that a block taken and released meanwhile cannot make outstanding negative.
+    uint64_t released = g_counters[kind].released.load(std::memory_order_relaxed);
+    statistics.hits = g_counters[kind].hits.load(std::memory_order_relaxed);
+    statistics.misses = g_counters[kind].misses.load(std::memory_order_relaxed);
+    statistics.outstanding = statistics.hits + statistics.misses - released;
+    return statistics;
+}
+
+size_t InputEventPool::GetCachedCount(PoolKind kind)
+{
+    switch (kind) {
+        case POINTER_EVENT: {
+            return BlockCache<POINTER_EVENT>::GetCount();
+        }
+        case KEY_EVENT: {
+            return BlockCache<KEY_EVENT>::GetCount();
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+void InputEventPool::Dump(int32_t fd)
+{
+    mprintf(fd, "Input event pools (up to %zu cached blocks per thread):\n", MAX_CACHED_BLOCKS);
+    for (int32_t kind = 0; kind < KIND_COUNT; ++kind) {
+        Statistics statistics = GetStatistics(static_cast<PoolKind>(kind));
+        uint64_t total = statistics.hits + statistics.misses;
+        mprintf(fd, "  %-12s hits:%" PRIu64 " | misses:%" PRIu64 " | hit rate:%.1f%% | outstanding:%" PRIu64 "\n",
+            KIND_NAMES[kind], statistics.hits, statistics.misses,
+            (total > 0 ? statistics.hits * PERCENT / total : 0.0), statistics.outstanding);
+    }
+}
+} // namespace MMI
+} // namespace OHOS
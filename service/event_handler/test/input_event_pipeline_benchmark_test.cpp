@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <linux/input.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "general_keyboard.h"
+#include "general_mouse.h"
+#include "general_touchpad.h"
+#include "general_touchscreen.h"
+#include "i_input_windows_manager.h"
+#include "input_event_handler.h"
+#include "input_event_pool.h"
+#include "latency_histogram.h"
+#include "libinput_wrapper.h"
+#include "mmi_log.h"
+#include "uds_server.h"
+#include "util.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputEventPipelineBenchmarkTest"
+
+namespace {
+// Only operator new on the benchmark thread while an event is handled is counted.
+thread_local bool g_countAllocations { false };
+thread_local uint64_t g_allocations { 0 };
+} // namespace
+
+void *operator new(size_t size)
+{
+    if (g_countAllocations) {
+        ++g_allocations;
+    }
+    void *ptr = malloc(size > 0 ? size : 1);
+    if (ptr == nullptr) {
+        abort();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t CLIENT_PID { 20000 };
+constexpr int32_t CLIENT_UID { 20000 };
+constexpr int32_t CLIENT_MODULE_TYPE { 1 };
+constexpr int32_t DISPLAY_ID { 0 };
+constexpr int32_t WINDOW_ID { 1 };
+constexpr int32_t DISPLAY_WIDTH { 1080 };
+constexpr int32_t DISPLAY_HEIGHT { 1920 };
+constexpr int32_t DISPLAY_DPI { 240 };
+constexpr size_t RECV_BUF_SIZE { 4096 };
+
+constexpr int32_t N_FINGERS { 10 };
+constexpr int32_t N_TOUCH_FRAMES { 300 };
+constexpr int32_t TOUCH_FINGER_SPACING { 1000 };
+constexpr int32_t TOUCH_BASE_Y { 4000 };
+constexpr int32_t TOUCH_STEP_Y { 40 };
+constexpr int32_t TOUCH_PRESSURE { 50 };
+
+constexpr int32_t N_MOUSE_FRAMES { 2000 };
+constexpr int32_t MOUSE_FRAMES_PER_TURN { 200 };
+constexpr int32_t MOUSE_STEP { 3 };
+constexpr useconds_t MOUSE_INTERVAL_US { 1000 };
+constexpr uint64_t N_LEAK_EVENTS { 10000 };
+
+constexpr int32_t N_KEY_STROKES { 500 };
+constexpr uint16_t TYPED_KEYS[] { KEY_H, KEY_E, KEY_L, KEY_L, KEY_O, KEY_SPACE, KEY_W, KEY_O, KEY_R, KEY_L, KEY_D };
+
+constexpr int32_t N_SWIPES { 20 };
+constexpr int32_t N_SWIPE_FINGERS { 3 };
+constexpr int32_t N_SWIPE_FRAMES { 40 };
+constexpr int32_t SWIPE_BASE_X { 400 };
+constexpr int32_t SWIPE_FINGER_SPACING { 150 };
+constexpr int32_t SWIPE_BASE_Y { 500 };
+constexpr int32_t SWIPE_STEP { 20 };
+constexpr useconds_t SWIPE_INTERVAL_US { 8000 };
+
+constexpr double PERCENTILES[] { 50.0, 90.0, 99.0, 99.9 };
+constexpr double NS_PER_US { 1000.0 };
+constexpr double NS_PER_SEC { 1000000000.0 };
+} // namespace
+
+/**
+ * Feeds synthetic evdev streams from virtual devices through libinput and the handler chain built by
+ * InputEventHandler, with one full screen window owned by a fake client that is connected by a socket pair.
+ * Only the time spent in InputEventHandler::OnEvent is measured.
+ */
+class InputEventPipelineBenchmarkTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+
+protected:
+    class Scenario final {
+    public:
+        explicit Scenario(const char *name) : name_(name) {}
+        ~Scenario() = default;
+        DISALLOW_COPY_AND_MOVE(Scenario);
+
+        // Hands every pending libinput event to the chain and empties the client socket.
+        void HandlePending();
+        void Report() const;
+
+        uint64_t GetEventCount() const
+        {
+            return events_;
+        }
+
+    private:
+        const char *name_ { nullptr };
+        uint64_t events_ { 0 };
+        uint64_t handlingNs_ { 0 };
+        uint64_t allocations_ { 0 };
+        uint64_t deliveredBytes_ { 0 };
+        LatencyHistogram latency_;
+    };
+
+    static void SetUpDevice(GeneralDevice &device);
+    static void CloseDevice(GeneralDevice &device);
+    static void SetUpWindows();
+    static void SetUpClient();
+
+    static GeneralTouchscreen vTouchscreen_;
+    static GeneralMouse vMouse_;
+    static GeneralKeyboard vKeyboard_;
+    static GeneralTouchpad vTouchpad_;
+    static LibinputWrapper libinput_;
+    static UDSServer udsServer_;
+    static int32_t clientFd_;
+};
+
+GeneralTouchscreen InputEventPipelineBenchmarkTest::vTouchscreen_;
+GeneralMouse InputEventPipelineBenchmarkTest::vMouse_;
+GeneralKeyboard InputEventPipelineBenchmarkTest::vKeyboard_;
+GeneralTouchpad InputEventPipelineBenchmarkTest::vTouchpad_;
+LibinputWrapper InputEventPipelineBenchmarkTest::libinput_;
+UDSServer InputEventPipelineBenchmarkTest::udsServer_;
+int32_t InputEventPipelineBenchmarkTest::clientFd_ { -1 };
+
+void InputEventPipelineBenchmarkTest::SetUpTestCase(void)
+{
+    InputHandler->Init(udsServer_);
+    ASSERT_TRUE(libinput_.Init());
+    SetUpDevice(vTouchscreen_);
+    SetUpDevice(vMouse_);
+    SetUpDevice(vKeyboard_);
+    SetUpDevice(vTouchpad_);
+    SetUpWindows();
+    SetUpClient();
+    std::cout << "scenario            events    events/s  p50(us)  p90(us)  p99(us) p999(us)  max(us) allocs/event"
+        << std::endl;
+}
+
+void InputEventPipelineBenchmarkTest::TearDownTestCase(void)
+{
+    CloseDevice(vTouchpad_);
+    CloseDevice(vKeyboard_);
+    CloseDevice(vMouse_);
+    CloseDevice(vTouchscreen_);
+    udsServer_.UdsStop();
+    if (clientFd_ >= 0) {
+        close(clientFd_);
+        clientFd_ = -1;
+    }
+}
+
+void InputEventPipelineBenchmarkTest::SetUpDevice(GeneralDevice &device)
+{
+    ASSERT_TRUE(device.SetUp());
+    ASSERT_TRUE(libinput_.AddPath(device.GetDevPath()));
+    libinput_event *event = libinput_.Dispatch();
+    ASSERT_TRUE(event != nullptr);
+    ASSERT_EQ(libinput_event_get_type(event), LIBINPUT_EVENT_DEVICE_ADDED);
+    InputHandler->OnEvent(event, GetSysClockTime());
+    libinput_event_destroy(event);
+    libinput_.DrainEvents();
+}
+
+void InputEventPipelineBenchmarkTest::CloseDevice(GeneralDevice &device)
+{
+    if (!device.GetDevPath().empty()) {
+        libinput_.RemovePath(device.GetDevPath());
+    }
+    device.Close();
+}
+
+void InputEventPipelineBenchmarkTest::SetUpWindows()
+{
+    OLD::DisplayGroupInfo displayGroupInfo;
+    displayGroupInfo.type = GROUP_DEFAULT;
+    displayGroupInfo.mainDisplayId = DISPLAY_ID;
+    displayGroupInfo.focusWindowId = WINDOW_ID;
+
+    OLD::DisplayInfo display;
+    display.id = DISPLAY_ID;
+    display.x = 0;
+    display.y = 0;
+    display.width = DISPLAY_WIDTH;
+    display.height = DISPLAY_HEIGHT;
+    display.validWidth = DISPLAY_WIDTH;
+    display.validHeight = DISPLAY_HEIGHT;
+    display.dpi = DISPLAY_DPI;
+    display.name = "benchmark";
+    display.uniq = "default0";
+    display.direction = DIRECTION0;
+    display.displayDirection = DIRECTION0;
+    displayGroupInfo.displaysInfo.push_back(display);
+
+    WindowInfo window;
+    window.id = WINDOW_ID;
+    window.pid = CLIENT_PID;
+    window.uid = CLIENT_UID;
+    window.displayId = DISPLAY_ID;
+    window.area = { 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT };
+    window.defaultHotAreas = { window.area };
+    window.pointerHotAreas = { window.area };
+    window.agentWindowId = WINDOW_ID;
+    window.flags = 0;
+    window.transform = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    displayGroupInfo.windowsInfo.push_back(window);
+    WIN_MGR->UpdateDisplayInfo(displayGroupInfo);
+}
+
+void InputEventPipelineBenchmarkTest::SetUpClient()
+{
+    int32_t sockFds[2] { -1, -1 };
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+    clientFd_ = sockFds[1];
+    ASSERT_EQ(fcntl(clientFd_, F_SETFL, fcntl(clientFd_, F_GETFL) | O_NONBLOCK), 0);
+    auto session = std::make_shared<UDSSession>("PipelineBenchmark", CLIENT_MODULE_TYPE, sockFds[0],
+        CLIENT_UID, CLIENT_PID);
+    ASSERT_TRUE(udsServer_.AddSession(session));
+}
+
+void InputEventPipelineBenchmarkTest::Scenario::HandlePending()
+{
+    libinput_event *event = libinput_.Dispatch();
+    while (event != nullptr) {
+        g_allocations = 0;
+        g_countAllocations = true;
+        auto begin = std::chrono::steady_clock::now();
+        InputHandler->OnEvent(event, GetSysClockTime());
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        g_countAllocations = false;
+        allocations_ += g_allocations;
+        latency_.Record(static_cast<uint64_t>(elapsedNs));
+        handlingNs_ += static_cast<uint64_t>(elapsedNs);
+        ++events_;
+        libinput_event_destroy(event);
+        event = libinput_.Dispatch();
+    }
+    char buf[RECV_BUF_SIZE] {};
+    ssize_t size = 0;
+    while ((size = recv(clientFd_, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+        deliveredBytes_ += static_cast<uint64_t>(size);
+    }
+}
+
+void InputEventPipelineBenchmarkTest::Scenario::Report() const
+{
+    LatencyHistogram::Snapshot snapshot = latency_.GetSnapshot();
+    double eventsPerSec = (handlingNs_ > 0 ? events_ * NS_PER_SEC / handlingNs_ : 0.0);
+    double allocsPerEvent = (events_ > 0 ? static_cast<double>(allocations_) / events_ : 0.0);
+    char line[256] {};
+    if (snprintf(line, sizeof(line), "%-16s %9" PRIu64 " %11.0f %8.1f %8.1f %8.1f %8.1f %8.1f %12.1f", name_, events_,
+        eventsPerSec, snapshot.GetPercentile(PERCENTILES[0]) / NS_PER_US,
+        snapshot.GetPercentile(PERCENTILES[1]) / NS_PER_US, snapshot.GetPercentile(PERCENTILES[2]) / NS_PER_US,
+        snapshot.GetPercentile(PERCENTILES[3]) / NS_PER_US, snapshot.max / NS_PER_US, allocsPerEvent) < 0) {
+        return;
+    }
+    std::cout << line << std::endl;
+    MMI_HILOGI("%{public}s, delivered %{public}" PRIu64 " bytes to the client", line, deliveredBytes_);
+}
+
+/**
+ * @tc.name: InputEventPipelineBenchmarkTest_Touch_001
+ * @tc.desc: Benchmark ten fingers moving together on a touchscreen
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(InputEventPipelineBenchmarkTest, InputEventPipelineBenchmarkTest_Touch_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Scenario scenario("touch_10_fingers");
+    for (int32_t frame = 0; frame < N_TOUCH_FRAMES; ++frame) {
+        for (int32_t finger = 0; finger < N_FINGERS; ++finger) {
+            vTouchscreen_.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, finger);
+            vTouchscreen_.SendEvent(EV_ABS, ABS_MT_POSITION_X, TOUCH_FINGER_SPACING * (finger + 1));
+            vTouchscreen_.SendEvent(EV_ABS, ABS_MT_POSITION_Y, TOUCH_BASE_Y + TOUCH_STEP_Y * frame);
+            vTouchscreen_.SendEvent(EV_ABS, ABS_MT_PRESSURE, TOUCH_PRESSURE);
+            vTouchscreen_.SendEvent(EV_SYN, SYN_MT_REPORT, 0);
+        }
+        if (frame == 0) {
+            vTouchscreen_.SendEvent(EV_KEY, BTN_TOUCH, 1);
+        }
+        vTouchscreen_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+    }
+    vTouchscreen_.SendEvent(EV_KEY, BTN_TOUCH, 0);
+    vTouchscreen_.SendEvent(EV_SYN, SYN_MT_REPORT, 0);
+    vTouchscreen_.SendEvent(EV_SYN, SYN_REPORT, 0);
+    scenario.HandlePending();
+    scenario.Report();
+    EXPECT_GE(scenario.GetEventCount(), static_cast<uint64_t>(N_TOUCH_FRAMES));
+}
+
+/**
+ * @tc.name: InputEventPipelineBenchmarkTest_Mouse_001
+ * @tc.desc: Benchmark a mouse reporting at 1000 Hz
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(InputEventPipelineBenchmarkTest, InputEventPipelineBenchmarkTest_Mouse_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Scenario scenario("mouse_1000hz");
+    for (int32_t frame = 0; frame < N_MOUSE_FRAMES; ++frame) {
+        int32_t direction = ((frame / MOUSE_FRAMES_PER_TURN) % 2 == 0 ? 1 : -1);
+        vMouse_.SendEvent(EV_REL, REL_X, direction * MOUSE_STEP);
+        vMouse_.SendEvent(EV_REL, REL_Y, direction * MOUSE_STEP);
+        vMouse_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+        usleep(MOUSE_INTERVAL_US);
+    }
+    scenario.Report();
+    EXPECT_GE(scenario.GetEventCount(), static_cast<uint64_t>(N_MOUSE_FRAMES));
+}
+
+/**
+ * @tc.name: InputEventPipelineBenchmarkTest_PoolLeak_001
+ * @tc.desc: Test that no pooled pointer event is left behind after ten thousand mouse events have been dispatched
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(InputEventPipelineBenchmarkTest, InputEventPipelineBenchmarkTest_PoolLeak_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto base = InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT);
+    Scenario scenario("mouse_pool_leak");
+    for (int32_t frame = 0; scenario.GetEventCount() < N_LEAK_EVENTS; ++frame) {
+        int32_t direction = ((frame / MOUSE_FRAMES_PER_TURN) % 2 == 0 ? 1 : -1);
+        vMouse_.SendEvent(EV_REL, REL_X, direction * MOUSE_STEP);
+        vMouse_.SendEvent(EV_REL, REL_Y, direction * MOUSE_STEP);
+        vMouse_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+    }
+    scenario.Report();
+    auto statistics = InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT);
+    uint64_t hits = statistics.hits - base.hits;
+    uint64_t misses = statistics.misses - base.misses;
+    MMI_HILOGI("Pointer event pool hits:%{public}" PRIu64 ", misses:%{public}" PRIu64 ", outstanding:%{public}" PRIu64,
+        hits, misses, statistics.outstanding);
+    EXPECT_EQ(statistics.outstanding, base.outstanding);
+    EXPECT_GE(hits + misses, N_LEAK_EVENTS);
+    EXPECT_LE(misses, static_cast<uint64_t>(InputEventPool::MAX_CACHED_BLOCKS));
+}
+
+/**
+ * @tc.name: InputEventPipelineBenchmarkTest_Keyboard_001
+ * @tc.desc: Benchmark typing on a keyboard
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(InputEventPipelineBenchmarkTest, InputEventPipelineBenchmarkTest_Keyboard_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Scenario scenario("key_typing");
+    constexpr size_t keyCount { sizeof(TYPED_KEYS) / sizeof(TYPED_KEYS[0]) };
+    for (int32_t stroke = 0; stroke < N_KEY_STROKES; ++stroke) {
+        uint16_t key = TYPED_KEYS[stroke % keyCount];
+        vKeyboard_.SendEvent(EV_KEY, key, 1);
+        vKeyboard_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+        vKeyboard_.SendEvent(EV_KEY, key, 0);
+        vKeyboard_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+    }
+    scenario.Report();
+    EXPECT_GE(scenario.GetEventCount(), static_cast<uint64_t>(N_KEY_STROKES) * 2);
+}
+
+/**
+ * @tc.name: InputEventPipelineBenchmarkTest_TouchpadSwipe_001
+ * @tc.desc: Benchmark three finger swipes on a touchpad
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(InputEventPipelineBenchmarkTest, InputEventPipelineBenchmarkTest_TouchpadSwipe_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    Scenario scenario("touchpad_swipe");
+    int32_t trackingId = 0;
+    for (int32_t swipe = 0; swipe < N_SWIPES; ++swipe) {
+        for (int32_t finger = 0; finger < N_SWIPE_FINGERS; ++finger) {
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_SLOT, finger);
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, ++trackingId);
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_POSITION_X, SWIPE_BASE_X + SWIPE_FINGER_SPACING * finger);
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_POSITION_Y, SWIPE_BASE_Y);
+        }
+        vTouchpad_.SendEvent(EV_KEY, BTN_TOUCH, 1);
+        vTouchpad_.SendEvent(EV_KEY, BTN_TOOL_TRIPLETAP, 1);
+        vTouchpad_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        scenario.HandlePending();
+        for (int32_t frame = 1; frame <= N_SWIPE_FRAMES; ++frame) {
+            usleep(SWIPE_INTERVAL_US);
+            for (int32_t finger = 0; finger < N_SWIPE_FINGERS; ++finger) {
+                vTouchpad_.SendEvent(EV_ABS, ABS_MT_SLOT, finger);
+                vTouchpad_.SendEvent(EV_ABS, ABS_MT_POSITION_X,
+                    SWIPE_BASE_X + SWIPE_FINGER_SPACING * finger + SWIPE_STEP * frame);
+            }
+            vTouchpad_.SendEvent(EV_SYN, SYN_REPORT, 0);
+            scenario.HandlePending();
+        }
+        for (int32_t finger = 0; finger < N_SWIPE_FINGERS; ++finger) {
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_SLOT, finger);
+            vTouchpad_.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+        }
+        vTouchpad_.SendEvent(EV_KEY, BTN_TOUCH, 0);
+        vTouchpad_.SendEvent(EV_KEY, BTN_TOOL_TRIPLETAP, 0);
+        vTouchpad_.SendEvent(EV_SYN, SYN_REPORT, 0);
+        usleep(SWIPE_INTERVAL_US);
+        scenario.HandlePending();
+    }
+    scenario.Report();
+    EXPECT_GT(scenario.GetEventCount(), 0U);
+}
+} // namespace MMI
+} // namespace OHOS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "input_event_pool.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputEventPoolTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t EVENT_ID { 1001 };
+constexpr int32_t POINTER_ID { 3 };
+constexpr int32_t DISPLAY_X { 540 };
+constexpr int32_t DISPLAY_Y { 960 };
+constexpr size_t N_HELD_EVENTS { InputEventPool::MAX_CACHED_BLOCKS * 2 };
+} // namespace
+
+class InputEventPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    static std::shared_ptr<PointerEvent> CreatePointerEvent()
+    {
+        auto pointerEvent = PointerEvent::Create();
+        if (pointerEvent == nullptr) {
+            return nullptr;
+        }
+        pointerEvent->SetId(EVENT_ID);
+        pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+        pointerEvent->SetPointerId(POINTER_ID);
+        PointerEvent::PointerItem item;
+        item.SetPointerId(POINTER_ID);
+        item.SetDisplayX(DISPLAY_X);
+        item.SetDisplayY(DISPLAY_Y);
+        pointerEvent->AddPointerItem(item);
+        return pointerEvent;
+    }
+};
+
+/**
+ * @tc.name: InputEventPoolTest_Clone_001
+ * @tc.desc: Test that pooled copies carry the state of the original events
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventPoolTest, InputEventPoolTest_Clone_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = CreatePointerEvent();
+    ASSERT_NE(pointerEvent, nullptr);
+    auto pointerCopy = InputEventPool::Clone(*pointerEvent);
+    ASSERT_NE(pointerCopy, nullptr);
+    EXPECT_NE(pointerCopy, pointerEvent);
+    EXPECT_EQ(pointerCopy->GetId(), EVENT_ID);
+    EXPECT_EQ(pointerCopy->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem item;
+    ASSERT_TRUE(pointerCopy->GetPointerItem(POINTER_ID, item));
+    EXPECT_EQ(item.GetDisplayX(), DISPLAY_X);
+    EXPECT_EQ(item.GetDisplayY(), DISPLAY_Y);
+
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetId(EVENT_ID);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    auto keyCopy = InputEventPool::Clone(*keyEvent);
+    ASSERT_NE(keyCopy, nullptr);
+    EXPECT_EQ(keyCopy->GetId(), EVENT_ID);
+    EXPECT_EQ(keyCopy->GetKeyCode(), KeyEvent::KEYCODE_A);
+    EXPECT_EQ(keyCopy->GetKeyAction(), KeyEvent::KEY_ACTION_DOWN);
+}
+
+/**
+ * @tc.name: InputEventPoolTest_Reuse_001
+ * @tc.desc: Test that a released copy leaves its block to the next copy and is no longer outstanding
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventPoolTest, InputEventPoolTest_Reuse_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = CreatePointerEvent();
+    ASSERT_NE(pointerEvent, nullptr);
+    { auto warmUp = InputEventPool::Clone(*pointerEvent); }
+    auto base = InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT);
+    ASSERT_GE(InputEventPool::GetCachedCount(InputEventPool::POINTER_EVENT), 1U);
+
+    auto copy = InputEventPool::Clone(*pointerEvent);
+    auto statistics = InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT);
+    EXPECT_EQ(statistics.hits, base.hits + 1);
+    EXPECT_EQ(statistics.misses, base.misses);
+    EXPECT_EQ(statistics.outstanding, base.outstanding + 1);
+    copy.reset();
+    EXPECT_EQ(InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT).outstanding, base.outstanding);
+}
+
+/**
+ * @tc.name: InputEventPoolTest_Bound_001
+ * @tc.desc: Test that the cache of a thread keeps at most MAX_CACHED_BLOCKS blocks
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventPoolTest, InputEventPoolTest_Bound_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = CreatePointerEvent();
+    ASSERT_NE(pointerEvent, nullptr);
+    auto base = InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT);
+    std::vector<std::shared_ptr<PointerEvent>> events;
+    for (size_t i = 0; i < N_HELD_EVENTS; ++i) {
+        events.push_back(InputEventPool::Clone(*pointerEvent));
+    }
+    EXPECT_EQ(InputEventPool::GetCachedCount(InputEventPool::POINTER_EVENT), 0U);
+    EXPECT_EQ(InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT).outstanding,
+        base.outstanding + N_HELD_EVENTS);
+    events.clear();
+    EXPECT_EQ(InputEventPool::GetCachedCount(InputEventPool::POINTER_EVENT), InputEventPool::MAX_CACHED_BLOCKS);
+    EXPECT_EQ(InputEventPool::GetStatistics(InputEventPool::POINTER_EVENT).outstanding, base.outstanding);
+}
+
+/**
+ * @tc.name: InputEventPoolTest_Thread_001
+ * @tc.desc: Test that a copy released on another thread is counted back and goes to the cache of that thread
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventPoolTest, InputEventPoolTest_Thread_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    auto base = InputEventPool::GetStatistics(InputEventPool::KEY_EVENT);
+    auto copy = InputEventPool::Clone(*keyEvent);
+    size_t cachedOnWorker = 0;
+    std::thread worker([&copy, &cachedOnWorker]() {
+        copy.reset();
+        cachedOnWorker = InputEventPool::GetCachedCount(InputEventPool::KEY_EVENT);
+    });
+    worker.join();
+    EXPECT_EQ(copy, nullptr);
+    EXPECT_EQ(cachedOnWorker, 1U);
+    EXPECT_EQ(InputEventPool::GetStatistics(InputEventPool::KEY_EVENT).outstanding, base.outstanding);
+}
+
+/**
+ * @tc.name: InputEventPoolTest_Dump_001
+ * @tc.desc: Test that the dump lists the hit rate and outstanding count of every pool
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventPoolTest, InputEventPoolTest_Dump_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    auto copy = InputEventPool::Clone(*keyEvent);
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    InputEventPool::Dump(fileno(file));
+    std::string output;
+    char buf[256] {};
+    rewind(file);
+    while (fgets(buf, sizeof(buf), file) != nullptr) {
+        output += buf;
+    }
+    fclose(file);
+    EXPECT_NE(output.find("PointerEvent"), std::string::npos);
+    EXPECT_NE(output.find("KeyEvent"), std::string::npos);
+    EXPECT_NE(output.find("hit rate:"), std::string::npos);
+    EXPECT_NE(output.find("outstanding:"), std::string::npos);
+}
+} // namespace MMI
+} // namespace OHOS
@@ -16,26 +16,43 @@
 #ifndef EVENT_DISPATCH_ORDER_CHECKER_H
 #define EVENT_DISPATCH_ORDER_CHECKER_H
 
-#include <shared_mutex>
-#include <unordered_set>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 
 namespace OHOS {
 namespace MMI {
+/**
+ * Remembers the last event each hook has passed on. The hook id and the event id share one atomic word in a fixed
+ * table, so checks and updates of a known hook take no lock and a slot reused by a later hook never mixes the two.
+ * Adding and removing hooks is serialized by a mutex, so a hook holds at most one slot. KeyEventHookManager admits
+ * no more than MAX_CHECKER_COUNT hooks, so every hook finds a slot.
+ */
 class EventDispatchOrderChecker {
 public:
+    static constexpr size_t MAX_CHECKER_COUNT { 32 };
+
     EventDispatchOrderChecker(const EventDispatchOrderChecker&) = delete;
     EventDispatchOrderChecker& operator=(const EventDispatchOrderChecker&) = delete;
     static EventDispatchOrderChecker& GetInstance();
     int32_t CheckDispatchOrder(int32_t hookId, int32_t eventId);
+    // The last dispatched id of a hook only ever grows.
     int32_t UpdateLastDispatchedId(int32_t hookId, int32_t eventId);
     int32_t RemoveChecker(int32_t hookId);
 
 private:
-    EventDispatchOrderChecker() = default;
+    EventDispatchOrderChecker();
     ~EventDispatchOrderChecker() = default;
 
-    std::unordered_map<int32_t, int32_t> dispatchedEventIds_; // hookId -> dispatched eventId
-    std::shared_mutex rwMutex_;
+    static uint64_t Pack(int32_t hookId, int32_t eventId);
+    static int32_t GetHookId(uint64_t value);
+    static int32_t GetEventId(uint64_t value);
+    std::atomic<uint64_t> *FindSlot(int32_t hookId, uint64_t &value);
+    static void RaiseEventId(std::atomic<uint64_t> &slot, uint64_t value, int32_t hookId, int32_t eventId);
+
+    static constexpr uint64_t EMPTY_SLOT { UINT64_MAX };
+    std::atomic<uint64_t> slots_[MAX_CHECKER_COUNT]; // hookId << 32 | dispatched eventId
+    std::mutex mutex_; // Held to claim or clear slots.
 };
 } // namespace MMI
 } // namespace OHOS
@@ -16,16 +16,25 @@
 #ifndef EVENT_EXPIRATION_CHECKER_H
 #define EVENT_EXPIRATION_CHECKER_H
 
-#include <queue>
+#include <array>
+#include <memory>
 #include <shared_mutex>
-#include <unordered_set>
+#include <unordered_map>
 
 #include "key_event.h"
 
 namespace OHOS {
 namespace MMI {
+/**
+ * Keeps the key events sent to each hook until the hook passes them on. Every hook has a ring of STASH_CAPACITY
+ * slots indexed by event id, so an event is found in constant time and is dropped when a later event takes its slot.
+ * An event expires STASH_EVENT_TIMEOUT_MS after it was stashed, which is decided by its timestamp on lookup.
+ */
 class EventExpirationChecker {
 public:
+    static constexpr size_t STASH_CAPACITY { 128 };
+    static constexpr int64_t STASH_EVENT_TIMEOUT_MS { 3000 };
+
     EventExpirationChecker(const EventExpirationChecker&) = delete;
     EventExpirationChecker& operator=(const EventExpirationChecker&) = delete;
     static EventExpirationChecker& GetInstance();
@@ -38,14 +47,21 @@ private:
     EventExpirationChecker() = default;
     ~EventExpirationChecker() = default;
 
-    void RemoveExpiredStashEventLocked(int32_t hookId);
-
-private:
     struct StashEvent {
-        long long timeStampRcvd { 0 };
+        int32_t eventId { -1 };
+        int64_t timeStampRcvd { 0 };
         std::shared_ptr<KeyEvent> keyEvent { nullptr };
     };
-    std::unordered_map<int32_t, std::deque<StashEvent>> stashEvents_; // hookId -> dispatched eventId
+    using StashRing = std::array<StashEvent, STASH_CAPACITY>;
+
+    static int64_t GetTimeMs();
+    static size_t GetSlot(int32_t eventId);
+    static bool IsExpired(const StashEvent &stashEvent, int64_t now);
+    int32_t UpdateStashEventLocked(int32_t hookId, std::shared_ptr<KeyEvent> keyEvent, int64_t now);
+    const StashEvent *FindStashEventLocked(int32_t hookId, int32_t eventId, int64_t now) const;
+
+private:
+    std::unordered_map<int32_t, std::unique_ptr<StashRing>> stashEvents_; // hookId -> dispatched events
     std::shared_mutex rwMutex_;
 };
 } // namespace MMI
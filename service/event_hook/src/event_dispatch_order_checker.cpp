@@ -25,6 +25,17 @@
 
 namespace OHOS {
 namespace MMI {
+namespace {
+constexpr uint32_t HOOK_ID_SHIFT { 32 };
+} // namespace
+
+EventDispatchOrderChecker::EventDispatchOrderChecker()
+{
+    for (auto &slot : slots_) {
+        slot.store(EMPTY_SLOT, std::memory_order_relaxed);
+    }
+}
+
 EventDispatchOrderChecker& EventDispatchOrderChecker::GetInstance()
 {
     static EventDispatchOrderChecker instance;
@@ -34,32 +45,105 @@ EventDispatchOrderChecker& EventDispatchOrderChecker::GetInstance()
 int32_t EventDispatchOrderChecker::CheckDispatchOrder(int32_t hookId, int32_t eventId)
 {
     CALL_DEBUG_ENTER;
-    std::shared_lock<std::shared_mutex> lock(rwMutex_);
-    if (dispatchedEventIds_.find(hookId) == dispatchedEventIds_.end()) {
+    uint64_t value = 0;
+    if (FindSlot(hookId, value) == nullptr) {
         MMI_HILOGW("No checker of hook:%{public}d existed", hookId);
         return RET_OK;
     }
-    return dispatchedEventIds_[hookId] < eventId ? RET_OK : RET_ERR;
+    return GetEventId(value) < eventId ? RET_OK : RET_ERR;
 }
 
 int32_t EventDispatchOrderChecker::UpdateLastDispatchedId(int32_t hookId, int32_t eventId)
 {
     CALL_DEBUG_ENTER;
-    std::unique_lock<std::shared_mutex> lock(rwMutex_);
-    dispatchedEventIds_[hookId] = eventId;
-    return RET_OK;
+    if (hookId < 0) {
+        MMI_HILOGE("Invalid hook:%{public}d", hookId);
+        return RET_ERR;
+    }
+    uint64_t value = 0;
+    std::atomic<uint64_t> *slot = FindSlot(hookId, value);
+    if (slot != nullptr) {
+        RaiseEventId(*slot, value, hookId, eventId);
+        return RET_OK;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Another thread may have added the hook before the lock was taken.
+    slot = FindSlot(hookId, value);
+    if (slot != nullptr) {
+        RaiseEventId(*slot, value, hookId, eventId);
+        return RET_OK;
+    }
+    for (auto &candidate : slots_) {
+        if (candidate.load(std::memory_order_relaxed) == EMPTY_SLOT) {
+            candidate.store(Pack(hookId, eventId), std::memory_order_release);
+            return RET_OK;
+        }
+    }
+    MMI_HILOGE("No room for the checker of hook:%{public}d", hookId);
+    return RET_ERR;
 }
 
 int32_t EventDispatchOrderChecker::RemoveChecker(int32_t hookId)
 {
     CALL_INFO_TRACE;
-    std::unique_lock<std::shared_mutex> lock(rwMutex_);
-    if (dispatchedEventIds_.find(hookId) == dispatchedEventIds_.end()) {
+    if (hookId < 0) {
+        MMI_HILOGE("Invalid hook:%{public}d", hookId);
+        return RET_ERR;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    bool removed = false;
+    for (auto &slot : slots_) {
+        if (GetHookId(slot.load(std::memory_order_relaxed)) == hookId) {
+            slot.store(EMPTY_SLOT, std::memory_order_release);
+            removed = true;
+        }
+    }
+    if (!removed) {
         MMI_HILOGW("No checker of hook:%{public}d existed", hookId);
         return RET_ERR;
     }
-    dispatchedEventIds_.erase(hookId);
     return RET_OK;
 }
+
+uint64_t EventDispatchOrderChecker::Pack(int32_t hookId, int32_t eventId)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(hookId)) << HOOK_ID_SHIFT) | static_cast<uint32_t>(eventId);
+}
+
+int32_t EventDispatchOrderChecker::GetHookId(uint64_t value)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(value >> HOOK_ID_SHIFT));
+}
+
+int32_t EventDispatchOrderChecker::GetEventId(uint64_t value)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(value));
+}
+
+void EventDispatchOrderChecker::RaiseEventId(std::atomic<uint64_t> &slot, uint64_t value, int32_t hookId,
+    int32_t eventId)
+{
+    // Stops once the hook has been removed from the slot, the update is then ordered before the removal.
+    while ((GetHookId(value) == hookId) && (GetEventId(value) < eventId)) {
+        if (slot.compare_exchange_weak(value, Pack(hookId, eventId), std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+            return;
+        }
+    }
+}
+
+std::atomic<uint64_t> *EventDispatchOrderChecker::FindSlot(int32_t hookId, uint64_t &value)
+{
+    if (hookId < 0) {
+        return nullptr;
+    }
+    for (auto &slot : slots_) {
+        value = slot.load(std::memory_order_acquire);
+        if (GetHookId(value) == hookId) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include "define_multimodal.h"
+#include "input_event_pool.h"
 #include "mmi_log.h"
 
 #undef MMI_LOG_DOMAIN
@@ -26,10 +27,6 @@
 
 namespace OHOS {
 namespace MMI {
-namespace {
-constexpr long long STASH_EVENT_TIMEOUT_MS { 3000 };
-}
-
 EventExpirationChecker& EventExpirationChecker::GetInstance()
 {
     static EventExpirationChecker instance;
@@ -39,33 +36,19 @@ EventExpirationChecker& EventExpirationChecker::GetInstance()
 int32_t EventExpirationChecker::CheckExpiration(int32_t hookId, int32_t eventId)
 {
     CALL_DEBUG_ENTER;
-    std::unique_lock<std::shared_mutex> lock(rwMutex_);
-    RemoveExpiredStashEventLocked(hookId);
+    std::shared_lock<std::shared_mutex> lock(rwMutex_);
     if (stashEvents_.find(hookId) == stashEvents_.end()) {
         MMI_HILOGW("No checker of hook:%{public}d existed", hookId);
         return RET_ERR;
     }
-    auto iter = std::find_if(stashEvents_[hookId].begin(), stashEvents_[hookId].end(),
-        [eventId] (const auto &stashEvent) {
-            CHKPF(stashEvent.keyEvent);
-            return stashEvent.keyEvent->GetId() == eventId;
-        }
-    );
-    return iter != stashEvents_[hookId].end() ? RET_OK : RET_ERR;
+    return FindStashEventLocked(hookId, eventId, GetTimeMs()) != nullptr ? RET_OK : RET_ERR;
 }
 
 int32_t EventExpirationChecker::UpdateStashEvent(int32_t hookId, std::shared_ptr<KeyEvent> keyEvent)
 {
     CALL_DEBUG_ENTER;
     std::unique_lock<std::shared_mutex> lock(rwMutex_);
-    RemoveExpiredStashEventLocked(hookId);
-    EventExpirationChecker::StashEvent stashEvent {
-        .timeStampRcvd = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now().time_since_epoch()).count(),
-        .keyEvent = KeyEvent::Clone(keyEvent)
-    };
-    stashEvents_[hookId].push_back(stashEvent);
-    return RET_OK;
+    return UpdateStashEventLocked(hookId, keyEvent, GetTimeMs());
 }
 
 std::shared_ptr<KeyEvent> EventExpirationChecker::GetKeyEvent(int32_t hookId, int32_t eventId)
@@ -75,34 +58,8 @@ std::shared_ptr<KeyEvent> EventExpirationChecker::GetKeyEvent(int32_t hookId, in
         MMI_HILOGW("No checker of hook:%{public}d existed", hookId);
         return nullptr;
     }
-    auto iter = std::find_if(stashEvents_[hookId].begin(), stashEvents_[hookId].end(),
-        [eventId] (const auto &stashEvent) {
-            CHKPF(stashEvent.keyEvent);
-            return stashEvent.keyEvent->GetId() == eventId;
-        }
-    );
-    if (iter == stashEvents_[hookId].end()) {
-        return nullptr;
-    }
-    return iter->keyEvent;
-}
-
-void EventExpirationChecker::RemoveExpiredStashEventLocked(int32_t hookId)
-{
-    if (stashEvents_.find(hookId) == stashEvents_.end()) {
-        MMI_HILOGW("No checker of hook:%{public}d existed", hookId);
-        return;
-    }
-    long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()).count();
-    while (!stashEvents_[hookId].empty()) {
-        if (auto head = stashEvents_[hookId].front();
-            now - head.timeStampRcvd >= STASH_EVENT_TIMEOUT_MS) {
-            stashEvents_[hookId].pop_front();
-            continue;
-        }
-        break;
-    }
+    const StashEvent *stashEvent = FindStashEventLocked(hookId, eventId, GetTimeMs());
+    return stashEvent != nullptr ? stashEvent->keyEvent : nullptr;
 }
 
 int32_t EventExpirationChecker::RemoveChecker(int32_t hookId)
@@ -116,5 +73,55 @@ int32_t EventExpirationChecker::RemoveChecker(int32_t hookId)
     stashEvents_.erase(hookId);
     return RET_OK;
 }
+
+int64_t EventExpirationChecker::GetTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+size_t EventExpirationChecker::GetSlot(int32_t eventId)
+{
+    return static_cast<uint32_t>(eventId) % STASH_CAPACITY;
+}
+
+bool EventExpirationChecker::IsExpired(const StashEvent &stashEvent, int64_t now)
+{
+    return now - stashEvent.timeStampRcvd >= STASH_EVENT_TIMEOUT_MS;
+}
+
+int32_t EventExpirationChecker::UpdateStashEventLocked(int32_t hookId, std::shared_ptr<KeyEvent> keyEvent,
+    int64_t now)
+{
+    CHKPR(keyEvent, RET_ERR);
+    auto &ring = stashEvents_[hookId];
+    if (ring == nullptr) {
+        ring = std::make_unique<StashRing>();
+    }
+    StashEvent &stashEvent = (*ring)[GetSlot(keyEvent->GetId())];
+    if ((stashEvent.keyEvent != nullptr) && (stashEvent.eventId != keyEvent->GetId()) &&
+        !IsExpired(stashEvent, now)) {
+        MMI_HILOGW("Event:%{public}d of hook:%{public}d dropped for event:%{public}d before expiration",
+            stashEvent.eventId, hookId, keyEvent->GetId());
+    }
+    stashEvent.eventId = keyEvent->GetId();
+    stashEvent.timeStampRcvd = now;
+    stashEvent.keyEvent = InputEventPool::Clone(*keyEvent);
+    return RET_OK;
+}
+
+const EventExpirationChecker::StashEvent *EventExpirationChecker::FindStashEventLocked(int32_t hookId,
+    int32_t eventId, int64_t now) const
+{
+    auto iter = stashEvents_.find(hookId);
+    if ((iter == stashEvents_.end()) || (iter->second == nullptr)) {
+        return nullptr;
+    }
+    const StashEvent &stashEvent = (*iter->second)[GetSlot(eventId)];
+    if ((stashEvent.keyEvent == nullptr) || (stashEvent.eventId != eventId) || IsExpired(stashEvent, now)) {
+        return nullptr;
+    }
+    return &stashEvent;
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
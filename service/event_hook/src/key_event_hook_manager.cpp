@@ -62,6 +62,11 @@ int32_t KeyEventHookManager::AddKeyEventHook(int32_t pid, SessionPtr sess, int32
         MMI_HILOGE("Hook from pid:%{public}d existed already", pid);
         return ERROR_REPEAT_INTERCEPTOR;
     }
+    // Each hook needs a slot of the dispatch order checker, a hook without one would pass every order check.
+    if (size_t hookNum = GetHookNum(); hookNum >= EventDispatchOrderChecker::MAX_CHECKER_COUNT) {
+        MMI_HILOGE("Hook from pid:%{public}d rejected, %{public}zu hooks existed already", pid, hookNum);
+        return RET_ERR;
+    }
     auto hook = std::make_shared<Hook>(GenerateHookId(), sess, [sess, this] (std::shared_ptr<Hook> hook,
         std::shared_ptr<KeyEvent> keyEvent) -> bool {
         return this->HookHandler(sess, hook, keyEvent);
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "define_multimodal.h"
+#include "event_dispatch_order_checker.h"
+#include "event_expiration_checker.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventDispatchOrderCheckerTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t HOOK_ID { 3000 };
+constexpr int32_t EVENT_ID { 4000 };
+constexpr int32_t N_THREADS { 8 };
+constexpr int32_t N_UPDATES_PER_THREAD { 10000 };
+constexpr int32_t N_RACE_ROUNDS { 200 };
+
+size_t CountSlots(EventDispatchOrderChecker &checker, int32_t hookId)
+{
+    size_t count = 0;
+    for (auto &slot : checker.slots_) {
+        if (EventDispatchOrderChecker::GetHookId(slot.load()) == hookId) {
+            ++count;
+        }
+    }
+    return count;
+}
+} // namespace
+
+class EventDispatchOrderCheckerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    void TearDown()
+    {
+        for (int32_t hookId = HOOK_ID; hookId < HOOK_ID + static_cast<int32_t>(
+            EventDispatchOrderChecker::MAX_CHECKER_COUNT) + 1; ++hookId) {
+            EVENT_DISPATCH_ORDER_CHECKER.RemoveChecker(hookId);
+        }
+        EVENT_EXPIRATION_CHECKER.RemoveChecker(HOOK_ID);
+    }
+};
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_Order_001
+ * @tc.desc: Test that only ids after the last dispatched one pass and that the last dispatched id never goes back
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_Order_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_DISPATCH_ORDER_CHECKER;
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_OK);
+    ASSERT_EQ(checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID), RET_OK);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID - 1), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID + 1), RET_OK);
+    EXPECT_EQ(checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID - 1), RET_OK);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + 1, EVENT_ID), RET_OK);
+}
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_OutOfOrder_001
+ * @tc.desc: Test that a reply for an earlier event is refused after a later event was passed on, though stashed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_OutOfOrder_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &expirationChecker = EVENT_EXPIRATION_CHECKER;
+    auto &orderChecker = EVENT_DISPATCH_ORDER_CHECKER;
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    for (int32_t eventId = EVENT_ID; eventId < EVENT_ID + 3; ++eventId) {
+        keyEvent->SetId(eventId);
+        ASSERT_EQ(expirationChecker.UpdateStashEvent(HOOK_ID, keyEvent), RET_OK);
+    }
+    constexpr int32_t lastEventId { EVENT_ID + 2 };
+    EXPECT_EQ(expirationChecker.CheckExpiration(HOOK_ID, lastEventId), RET_OK);
+    EXPECT_EQ(orderChecker.CheckDispatchOrder(HOOK_ID, lastEventId), RET_OK);
+    ASSERT_EQ(orderChecker.UpdateLastDispatchedId(HOOK_ID, lastEventId), RET_OK);
+
+    EXPECT_EQ(expirationChecker.CheckExpiration(HOOK_ID, EVENT_ID + 1), RET_OK);
+    EXPECT_EQ(orderChecker.CheckDispatchOrder(HOOK_ID, EVENT_ID + 1), RET_ERR);
+    EXPECT_EQ(orderChecker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_ERR);
+    EXPECT_EQ(orderChecker.CheckDispatchOrder(HOOK_ID, lastEventId), RET_ERR);
+}
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_Remove_001
+ * @tc.desc: Test that a removed checker lets every id pass and that its slot is free for another hook
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_Remove_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_DISPATCH_ORDER_CHECKER;
+    EXPECT_EQ(checker.RemoveChecker(HOOK_ID), RET_ERR);
+    int32_t hookCount = static_cast<int32_t>(EventDispatchOrderChecker::MAX_CHECKER_COUNT);
+    for (int32_t hookId = HOOK_ID; hookId < HOOK_ID + hookCount; ++hookId) {
+        ASSERT_EQ(checker.UpdateLastDispatchedId(hookId, EVENT_ID), RET_OK);
+    }
+    EXPECT_EQ(checker.UpdateLastDispatchedId(HOOK_ID + hookCount, EVENT_ID), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + hookCount, EVENT_ID), RET_OK);
+
+    EXPECT_EQ(checker.RemoveChecker(HOOK_ID), RET_OK);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_OK);
+    EXPECT_EQ(checker.RemoveChecker(HOOK_ID), RET_ERR);
+    EXPECT_EQ(checker.UpdateLastDispatchedId(HOOK_ID + hookCount, EVENT_ID), RET_OK);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + hookCount, EVENT_ID), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + 1, EVENT_ID), RET_ERR);
+}
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_Concurrency_001
+ * @tc.desc: Test that concurrent updates of one hook keep the largest id
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_Concurrency_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_DISPATCH_ORDER_CHECKER;
+    ASSERT_EQ(checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID), RET_OK);
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < N_THREADS; ++t) {
+        threads.emplace_back([&checker, t] {
+            for (int32_t i = 0; i < N_UPDATES_PER_THREAD; ++i) {
+                checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID + i * N_THREADS + t);
+                checker.UpdateLastDispatchedId(HOOK_ID + 1 + t, EVENT_ID + i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    constexpr int32_t maxEventId { EVENT_ID + N_UPDATES_PER_THREAD * N_THREADS - 1 };
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, maxEventId), RET_ERR);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, maxEventId + 1), RET_OK);
+    for (int32_t t = 0; t < N_THREADS; ++t) {
+        EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + 1 + t, EVENT_ID + N_UPDATES_PER_THREAD - 1), RET_ERR);
+        EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID + 1 + t, EVENT_ID + N_UPDATES_PER_THREAD), RET_OK);
+    }
+}
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_Concurrency_002
+ * @tc.desc: Test that threads adding the same hook at once leave it in one slot with the largest id
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_Concurrency_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_DISPATCH_ORDER_CHECKER;
+    for (int32_t round = 0; round < N_RACE_ROUNDS; ++round) {
+        std::atomic<bool> start { false };
+        std::vector<std::thread> threads;
+        for (int32_t t = 0; t < N_THREADS; ++t) {
+            threads.emplace_back([&checker, &start, t] {
+                while (!start.load()) {
+                    std::this_thread::yield();
+                }
+                checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID + t);
+            });
+        }
+        start.store(true);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(CountSlots(checker, HOOK_ID), 1U);
+        EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID + N_THREADS - 1), RET_ERR);
+        EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID + N_THREADS), RET_OK);
+        ASSERT_EQ(checker.RemoveChecker(HOOK_ID), RET_OK);
+        ASSERT_EQ(CountSlots(checker, HOOK_ID), 0U);
+    }
+}
+
+/**
+ * @tc.name: EventDispatchOrderCheckerTest_Concurrency_003
+ * @tc.desc: Test that updates racing with removals never leave a hook in two slots nor leak slots
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventDispatchOrderCheckerTest, EventDispatchOrderCheckerTest_Concurrency_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_DISPATCH_ORDER_CHECKER;
+    std::atomic<bool> stop { false };
+    std::vector<std::thread> updaters;
+    for (int32_t t = 0; t < N_THREADS; ++t) {
+        updaters.emplace_back([&checker, &stop] {
+            for (int32_t i = 0; !stop.load(); ++i) {
+                checker.UpdateLastDispatchedId(HOOK_ID, EVENT_ID + i);
+            }
+        });
+    }
+    for (int32_t i = 0; i < N_UPDATES_PER_THREAD; ++i) {
+        checker.RemoveChecker(HOOK_ID);
+        EXPECT_LE(CountSlots(checker, HOOK_ID), 1U);
+    }
+    stop.store(true);
+    for (auto &thread : updaters) {
+        thread.join();
+    }
+    EXPECT_LE(CountSlots(checker, HOOK_ID), 1U);
+    checker.RemoveChecker(HOOK_ID);
+    EXPECT_EQ(CountSlots(checker, HOOK_ID), 0U);
+    EXPECT_EQ(checker.CheckDispatchOrder(HOOK_ID, EVENT_ID), RET_OK);
+    int32_t hookCount = static_cast<int32_t>(EventDispatchOrderChecker::MAX_CHECKER_COUNT);
+    for (int32_t hookId = HOOK_ID; hookId < HOOK_ID + hookCount; ++hookId) {
+        EXPECT_EQ(checker.UpdateLastDispatchedId(hookId, EVENT_ID), RET_OK);
+    }
+}
+} // namespace MMI
+} // namespace OHOS
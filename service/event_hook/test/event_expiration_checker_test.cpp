@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+
+#include <gtest/gtest.h>
+
+#include "define_multimodal.h"
+#include "event_dispatch_order_checker.h"
+#include "event_expiration_checker.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventExpirationCheckerTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t HOOK_ID { 1000 };
+constexpr int32_t EVENT_ID { 2000 };
+constexpr int64_t STASH_TIME_MS { 100000 };
+constexpr int32_t N_HOOKS { 8 };
+constexpr int32_t N_EVENTS { 20000 };
+
+std::shared_ptr<KeyEvent> CreateKeyEvent(int32_t eventId)
+{
+    auto keyEvent = KeyEvent::Create();
+    if (keyEvent == nullptr) {
+        return nullptr;
+    }
+    keyEvent->SetId(eventId);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    return keyEvent;
+}
+} // namespace
+
+class EventExpirationCheckerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    void TearDown()
+    {
+        EVENT_EXPIRATION_CHECKER.RemoveChecker(HOOK_ID);
+    }
+};
+
+/**
+ * @tc.name: EventExpirationCheckerTest_Expiry_001
+ * @tc.desc: Test that a stashed event is found until just before the timeout and not from the timeout on
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventExpirationCheckerTest, EventExpirationCheckerTest_Expiry_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_EXPIRATION_CHECKER;
+    auto keyEvent = CreateKeyEvent(EVENT_ID);
+    ASSERT_NE(keyEvent, nullptr);
+    ASSERT_EQ(checker.UpdateStashEventLocked(HOOK_ID, keyEvent, STASH_TIME_MS), RET_OK);
+    EXPECT_NE(checker.FindStashEventLocked(HOOK_ID, EVENT_ID, STASH_TIME_MS), nullptr);
+    EXPECT_NE(checker.FindStashEventLocked(HOOK_ID, EVENT_ID,
+        STASH_TIME_MS + EventExpirationChecker::STASH_EVENT_TIMEOUT_MS - 1), nullptr);
+    EXPECT_EQ(checker.FindStashEventLocked(HOOK_ID, EVENT_ID,
+        STASH_TIME_MS + EventExpirationChecker::STASH_EVENT_TIMEOUT_MS), nullptr);
+    EXPECT_EQ(checker.FindStashEventLocked(HOOK_ID, EVENT_ID + 1, STASH_TIME_MS), nullptr);
+}
+
+/**
+ * @tc.name: EventExpirationCheckerTest_Expiry_002
+ * @tc.desc: Test that an expired slot taken by a later event only yields the later event
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventExpirationCheckerTest, EventExpirationCheckerTest_Expiry_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_EXPIRATION_CHECKER;
+    constexpr int32_t laterEventId { EVENT_ID + static_cast<int32_t>(EventExpirationChecker::STASH_CAPACITY) };
+    constexpr int64_t laterTimeMs { STASH_TIME_MS + EventExpirationChecker::STASH_EVENT_TIMEOUT_MS };
+    ASSERT_EQ(checker.UpdateStashEventLocked(HOOK_ID, CreateKeyEvent(EVENT_ID), STASH_TIME_MS), RET_OK);
+    ASSERT_EQ(checker.UpdateStashEventLocked(HOOK_ID, CreateKeyEvent(laterEventId), laterTimeMs), RET_OK);
+    EXPECT_EQ(checker.FindStashEventLocked(HOOK_ID, EVENT_ID, laterTimeMs), nullptr);
+    auto stashEvent = checker.FindStashEventLocked(HOOK_ID, laterEventId, laterTimeMs);
+    ASSERT_NE(stashEvent, nullptr);
+    ASSERT_NE(stashEvent->keyEvent, nullptr);
+    EXPECT_EQ(stashEvent->keyEvent->GetId(), laterEventId);
+}
+
+/**
+ * @tc.name: EventExpirationCheckerTest_Slot_001
+ * @tc.desc: Test that events in distinct slots are kept apart and the stash holds copies
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventExpirationCheckerTest, EventExpirationCheckerTest_Slot_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_EXPIRATION_CHECKER;
+    for (int32_t i = 0; i < static_cast<int32_t>(EventExpirationChecker::STASH_CAPACITY); ++i) {
+        ASSERT_EQ(checker.UpdateStashEvent(HOOK_ID, CreateKeyEvent(EVENT_ID + i)), RET_OK);
+    }
+    for (int32_t i = 0; i < static_cast<int32_t>(EventExpirationChecker::STASH_CAPACITY); ++i) {
+        EXPECT_EQ(checker.CheckExpiration(HOOK_ID, EVENT_ID + i), RET_OK);
+    }
+    auto keyEvent = CreateKeyEvent(EVENT_ID);
+    ASSERT_NE(keyEvent, nullptr);
+    ASSERT_EQ(checker.UpdateStashEvent(HOOK_ID, keyEvent), RET_OK);
+    auto stashed = checker.GetKeyEvent(HOOK_ID, EVENT_ID);
+    ASSERT_NE(stashed, nullptr);
+    EXPECT_NE(stashed, keyEvent);
+    EXPECT_EQ(stashed->GetKeyCode(), KeyEvent::KEYCODE_A);
+    EXPECT_EQ(checker.UpdateStashEvent(HOOK_ID, nullptr), RET_ERR);
+}
+
+/**
+ * @tc.name: EventExpirationCheckerTest_Remove_001
+ * @tc.desc: Test that no event of a removed hook is found
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventExpirationCheckerTest, EventExpirationCheckerTest_Remove_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &checker = EVENT_EXPIRATION_CHECKER;
+    EXPECT_EQ(checker.CheckExpiration(HOOK_ID, EVENT_ID), RET_ERR);
+    ASSERT_EQ(checker.UpdateStashEvent(HOOK_ID, CreateKeyEvent(EVENT_ID)), RET_OK);
+    EXPECT_EQ(checker.CheckExpiration(HOOK_ID, EVENT_ID), RET_OK);
+    EXPECT_EQ(checker.RemoveChecker(HOOK_ID), RET_OK);
+    EXPECT_EQ(checker.CheckExpiration(HOOK_ID, EVENT_ID), RET_ERR);
+    EXPECT_EQ(checker.GetKeyEvent(HOOK_ID, EVENT_ID), nullptr);
+    EXPECT_EQ(checker.RemoveChecker(HOOK_ID), RET_ERR);
+}
+
+/**
+ * @tc.name: EventExpirationCheckerTest_Perf_001
+ * @tc.desc: Measure the checks of one hook passing a key event on while several hooks are registered
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(EventExpirationCheckerTest, EventExpirationCheckerTest_Perf_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto &expirationChecker = EVENT_EXPIRATION_CHECKER;
+    auto &orderChecker = EVENT_DISPATCH_ORDER_CHECKER;
+    auto keyEvent = CreateKeyEvent(EVENT_ID);
+    ASSERT_NE(keyEvent, nullptr);
+    int32_t failures = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < N_EVENTS; ++i) {
+        keyEvent->SetId(EVENT_ID + i);
+        for (int32_t hookId = HOOK_ID; hookId < HOOK_ID + N_HOOKS; ++hookId) {
+            expirationChecker.UpdateStashEvent(hookId, keyEvent);
+            if ((expirationChecker.CheckExpiration(hookId, EVENT_ID + i) != RET_OK) ||
+                (orderChecker.CheckDispatchOrder(hookId, EVENT_ID + i) != RET_OK) ||
+                (expirationChecker.GetKeyEvent(hookId, EVENT_ID + i) == nullptr)) {
+                ++failures;
+            }
+            orderChecker.UpdateLastDispatchedId(hookId, EVENT_ID + i);
+        }
+    }
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    for (int32_t hookId = HOOK_ID; hookId < HOOK_ID + N_HOOKS; ++hookId) {
+        expirationChecker.RemoveChecker(hookId);
+        orderChecker.RemoveChecker(hookId);
+    }
+    int64_t hopNs = static_cast<int64_t>(elapsedNs / (N_EVENTS * N_HOOKS));
+    MMI_HILOGI("Hook hop with %{public}d hooks %{public}" PRId64 "ns", N_HOOKS, hopNs);
+    EXPECT_EQ(failures, 0);
+}
+} // namespace MMI
+} // namespace OHOS
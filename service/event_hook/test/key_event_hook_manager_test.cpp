@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include "define_multimodal.h"
+#include "event_dispatch_order_checker.h"
+#include "key_event_hook_manager.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "KeyEventHookManagerTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+const std::string PROGRAM_NAME { "key_event_hook_manager_test" };
+constexpr int32_t MODULE_TYPE { 1 };
+constexpr int32_t UDS_FD { -1 };
+constexpr int32_t UDS_UID { 100 };
+constexpr int32_t BASE_PID { 5000 };
+} // namespace
+
+class KeyEventHookManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    void TearDown()
+    {
+        for (const auto &[pid, hookId] : hookIds_) {
+            KeyEventHookManager::GetInstance().RemoveKeyEventHook(pid, hookId);
+        }
+        hookIds_.clear();
+    }
+
+protected:
+    int32_t AddHook(int32_t pid)
+    {
+        SessionPtr sess = std::make_shared<UDSSession>(PROGRAM_NAME, MODULE_TYPE, UDS_FD, UDS_UID, pid);
+        int32_t hookId = -1;
+        int32_t ret = KeyEventHookManager::GetInstance().AddKeyEventHook(pid, sess, hookId);
+        if (ret == RET_OK) {
+            hookIds_[pid] = hookId;
+        }
+        return ret;
+    }
+
+    std::map<int32_t, int32_t> hookIds_;
+};
+
+/**
+ * @tc.name: KeyEventHookManagerTest_AddKeyEventHook_001
+ * @tc.desc: Test that a hook beyond the slots of the dispatch order checker is rejected until a slot is freed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KeyEventHookManagerTest, KeyEventHookManagerTest_AddKeyEventHook_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    const int32_t maxHooks = static_cast<int32_t>(EventDispatchOrderChecker::MAX_CHECKER_COUNT);
+    for (int32_t pid = BASE_PID; pid < BASE_PID + maxHooks; ++pid) {
+        ASSERT_EQ(AddHook(pid), RET_OK);
+    }
+    EXPECT_EQ(AddHook(BASE_PID + maxHooks), RET_ERR);
+    EXPECT_EQ(hookIds_.count(BASE_PID + maxHooks), 0U);
+
+    ASSERT_EQ(KeyEventHookManager::GetInstance().RemoveKeyEventHook(BASE_PID, hookIds_[BASE_PID]), RET_OK);
+    hookIds_.erase(BASE_PID);
+    EXPECT_EQ(AddHook(BASE_PID + maxHooks), RET_OK);
+}
+} // namespace MMI
+} // namespace OHOS
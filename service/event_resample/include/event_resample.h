@@ -16,11 +16,13 @@
 #ifndef EVENT_RESAMPLE_H
 #define EVENT_RESAMPLE_H
 
+#include <array>
 #include <map>
 
 #include "singleton.h"
 #include "error_multimodal.h"
 #include "pointer_event.h"
+#include "resample_predictor.h"
 
 namespace OHOS {
 namespace MMI {
@@ -34,13 +36,17 @@ public:
     std::shared_ptr<PointerEvent> GetPointerEvent();
 
     void PrintfDeviceName();
-    
+
+    // Loaded from system parameters on construction. Takes effect from the next touch down.
+    void SetResampleConfig(const ResampleConfig &config);
+    const ResampleConfig& GetResampleConfig() const;
+
     // Microseconds per milliseconds.
-    static constexpr int64_t US_PER_MS = 1000;
+    static constexpr int64_t US_PER_MS = RESAMPLE_US_PER_MS;
 
     // Latency added during resampling. A few milliseconds doesn't hurt much but
     // reduces the impact of mispredicted touch positions.
-    static constexpr int64_t RESAMPLE_LATENCY = 5 * US_PER_MS;
+    static constexpr int64_t RESAMPLE_LATENCY = RESAMPLE_DEFAULT_LATENCY;
 
     // Minimum time difference between consecutive samples before attempting to resample.
     static constexpr int64_t RESAMPLE_MIN_DELTA = 2 * US_PER_MS;
@@ -51,10 +57,10 @@ public:
 
     // Maximum time to predict forward from the last known state, to avoid predicting too
     // far into the future. This time is further bounded by 50% of the last time delta.
-    static constexpr int64_t RESAMPLE_MAX_PREDICTION = 4 * US_PER_MS;
+    static constexpr int64_t RESAMPLE_MAX_PREDICTION = RESAMPLE_DEFAULT_MAX_PREDICTION;
 
-    // Maximum history size to store samples
-    static constexpr size_t HISTORY_SIZE_MAX = 2;
+    // Default history size to store samples, see ResampleConfig::historyDepth.
+    static constexpr size_t HISTORY_SIZE_MAX = RESAMPLE_HISTORY_MIN;
 
 private:
 
@@ -186,30 +192,68 @@ private:
         int32_t source;
         size_t historyCurrent;
         size_t historySize;
-        History history[HISTORY_SIZE_MAX];
+        size_t historyDepth { HISTORY_SIZE_MAX };
+        History history[RESAMPLE_HISTORY_CAPACITY];
         History lastResample;
+        ResampleConfig config;
+        std::array<KalmanTracker, RESAMPLE_MAX_POINTERS> trackers;
+        uint32_t trackedPointers { 0 }; // Bit per pointer id fed to trackers by the latest sample
 
-        void Initialize(int32_t deviceId, int32_t source)
+        void Initialize(int32_t deviceId, int32_t source, const ResampleConfig &config)
         {
             this->deviceId = deviceId;
             this->source = source;
+            this->config = config;
+            historyDepth = ResamplePredictor::ClampHistoryDepth(config.historyDepth);
             historyCurrent = 0;
             historySize = 0;
             lastResample.actionTime = 0;
+            ResetTrackers(trackedPointers);
+            trackedPointers = 0;
         }
 
         void AddHistory(const MotionEvent &event)
         {
-            historyCurrent ^= 1;
-            if (historySize < HISTORY_SIZE_MAX) {
+            historyCurrent = (historyCurrent + 1) % historyDepth;
+            if (historySize < historyDepth) {
                 historySize += 1;
             }
             history[historyCurrent].InitializeFrom(event);
+            if (config.mode == ResampleMode::KALMAN) {
+                UpdateTrackers(event);
+            }
+        }
+
+        // Trackers of pointers lifted since the previous sample are reset, so that a reused id starts over.
+        void UpdateTrackers(const MotionEvent &event)
+        {
+            uint32_t current = 0;
+            for (const auto &it : event.pointers) {
+                if (it.first >= RESAMPLE_MAX_POINTERS) {
+                    continue;
+                }
+                ResampleSample sample { event.actionTime, static_cast<float>(it.second.coordX),
+                    static_cast<float>(it.second.coordY) };
+                trackers[it.first].Update(sample, config);
+                current |= (1U << it.first);
+            }
+            ResetTrackers(trackedPointers & ~current);
+            trackedPointers = current;
+        }
+
+        void ResetTrackers(uint32_t pointers)
+        {
+            for (uint32_t id = 0; id < RESAMPLE_MAX_POINTERS; ++id) {
+                if ((pointers & (1U << id)) != 0) {
+                    trackers[id].Reset();
+                }
+            }
         }
 
+        // idx 0 is the latest sample, idx must be less than historyDepth.
         const History* GetHistory(size_t idx) const
         {
-            return &history[(historyCurrent + idx) & 1];
+            return &history[(historyCurrent + historyDepth - idx) % historyDepth];
         }
 
         bool RecentCoordinatesAreIdentical(uint32_t id) const
@@ -238,6 +282,7 @@ private:
     int64_t frameTime_ {-1};
     bool resampleTouch_ {true};
     std::shared_ptr<PointerEvent> pointerEvent_ {nullptr};
+    ResampleConfig config_;
 
     void EventDump(const char *msg, MotionEvent &event);
     ErrCode InitializeInputEvent(std::shared_ptr<PointerEvent> pointerEvent, int64_t frameTime);
@@ -249,7 +294,8 @@ private:
     void UpdateTouchState(MotionEvent &event);
     void ResampleTouchState(int64_t sampleTime, MotionEvent* event, const MotionEvent* next);
     void ResampleCoordinates(int64_t sampleTime, MotionEvent* event, TouchState &touchState,
-                             const History* current, const History* other, float alpha);
+                             const History* current, const History* other, float alpha, bool predict = false);
+    bool PredictCoordinates(const TouchState &touchState, uint32_t id, int64_t sampleTime, Pointer &coords) const;
     ssize_t FindBatch(int32_t deviceId, int32_t source) const;
     ssize_t FindTouchState(int32_t deviceId, int32_t source) const;
     bool CanAddSample(const Batch &batch, MotionEvent &event);
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RESAMPLE_PREDICTOR_H
+#define RESAMPLE_PREDICTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace MMI {
+enum class ResampleMode : int32_t {
+    LINEAR = 0,
+    QUADRATIC = 1,
+    KALMAN = 2,
+};
+
+// Microseconds per millisecond.
+constexpr int64_t RESAMPLE_US_PER_MS { 1000 };
+// Default latency (us) added during resampling, see ResampleConfig::latency.
+constexpr int64_t RESAMPLE_DEFAULT_LATENCY { 5 * RESAMPLE_US_PER_MS };
+// Default bound (us) of the prediction horizon, see ResampleConfig::maxPrediction.
+constexpr int64_t RESAMPLE_DEFAULT_MAX_PREDICTION { 4 * RESAMPLE_US_PER_MS };
+constexpr size_t RESAMPLE_HISTORY_MIN { 2 };
+constexpr size_t RESAMPLE_HISTORY_CAPACITY { 8 };
+// Pointers tracked per touch, pointers with larger ids are resampled without prediction.
+constexpr uint32_t RESAMPLE_MAX_POINTERS { 10 };
+
+struct ResampleConfig {
+    ResampleMode mode { ResampleMode::LINEAR };
+    // Raw samples kept per pointer, clamped to [RESAMPLE_HISTORY_MIN, RESAMPLE_HISTORY_CAPACITY].
+    size_t historyDepth { RESAMPLE_HISTORY_MIN };
+    // Latency (us) added during resampling, the sample time is frame time minus this value.
+    int64_t latency { RESAMPLE_DEFAULT_LATENCY };
+    // Upper bound (us) of how far beyond the last raw sample a position may be predicted.
+    int64_t maxPrediction { RESAMPLE_DEFAULT_MAX_PREDICTION };
+    // Target frame interval (us) supplied by the caller, 0 if unknown. When set the prediction
+    // horizon is further bounded by half a frame.
+    int64_t frameInterval { 0 };
+    // Kalman tuning, expressed per millisecond.
+    double processNoise { 0.5 };
+    double measurementNoise { 4.0 };
+};
+
+struct ResampleSample {
+    int64_t time { 0 };
+    float x { 0.0F };
+    float y { 0.0F };
+};
+
+/**
+ * Constant-velocity Kalman filter for one pointer, fed with every raw sample.
+ */
+class KalmanTracker final {
+public:
+    void Reset();
+    void Update(const ResampleSample &sample, const ResampleConfig &config);
+    bool Predict(int64_t time, float &x, float &y) const;
+    bool IsReady() const { return updates_ >= READY_UPDATES; }
+
+private:
+    struct Axis {
+        double pos { 0.0 };
+        double vel { 0.0 };
+        double p00 { 0.0 };
+        double p01 { 0.0 };
+        double p11 { 0.0 };
+
+        void Init(double value, double measurementNoise);
+        void Update(double value, double dtMs, const ResampleConfig &config);
+    };
+
+    static constexpr int32_t READY_UPDATES { 2 };
+    Axis axisX_;
+    Axis axisY_;
+    int64_t lastTime_ { 0 };
+    int32_t updates_ { 0 };
+};
+
+class ResamplePredictor final {
+public:
+    // Least-squares quadratic fit over up to RESAMPLE_HISTORY_CAPACITY samples ordered newest first, needs at
+    // least three. Returns false when the samples cannot support the fit.
+    static bool ExtrapolateQuadratic(const ResampleSample *history, size_t count, int64_t sampleTime,
+        float &x, float &y);
+    // Clamps sampleTime to the prediction horizon allowed after a raw sample taken at lastTime,
+    // delta being the interval between the two latest raw samples.
+    static int64_t ClampHorizon(int64_t lastTime, int64_t delta, int64_t sampleTime, const ResampleConfig &config);
+    static size_t ClampHistoryDepth(size_t depth);
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // RESAMPLE_PREDICTOR_H
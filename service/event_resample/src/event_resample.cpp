@@ -15,9 +15,13 @@
 
 #include "event_resample.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "event_log_helper.h"
 #include "input_device_manager.h"
 #include "i_input_windows_manager.h"
+#include "parameters.h"
 
 #undef MMI_LOG_DOMAIN
 #define MMI_LOG_DOMAIN MMI_LOG_SERVER
@@ -26,7 +30,30 @@
 
 namespace OHOS {
 namespace MMI {
-EventResample::EventResample(){};
+namespace {
+// Products pick the predictor, see ResampleMode, and the number of raw samples it may use.
+ResampleConfig LoadResampleConfig()
+{
+    ResampleConfig config;
+    int32_t mode = system::GetIntParameter("const.multimodalinput.resample_mode",
+        static_cast<int32_t>(config.mode));
+    if ((mode >= static_cast<int32_t>(ResampleMode::LINEAR)) && (mode <= static_cast<int32_t>(ResampleMode::KALMAN))) {
+        config.mode = static_cast<ResampleMode>(mode);
+    } else {
+        MMI_HILOGE("Invalid resample mode:%{public}d", mode);
+    }
+    int32_t depth = system::GetIntParameter("const.multimodalinput.resample_history_depth",
+        static_cast<int32_t>(config.historyDepth));
+    config.historyDepth = ResamplePredictor::ClampHistoryDepth(static_cast<size_t>(std::max(depth, 0)));
+    return config;
+}
+} // namespace
+
+EventResample::EventResample()
+{
+    SetResampleConfig(LoadResampleConfig());
+}
+
 EventResample::~EventResample(){};
 
 std::shared_ptr<PointerEvent> EventResample::OnEventConsume(std::shared_ptr<PointerEvent> pointerEvent,
@@ -253,7 +280,7 @@ ErrCode EventResample::ConsumeBatch(int64_t frameTime, MotionEvent** outEvent)
 
         int64_t sampleTime = frameTime;
         if (resampleTouch_) {
-            sampleTime -= RESAMPLE_LATENCY;
+            sampleTime -= config_.latency;
         }
         ssize_t split = FindSampleNoLaterThan(batch, sampleTime);
         if (split < 0) {
@@ -319,7 +346,7 @@ void EventResample::UpdateTouchState(MotionEvent &event)
                 idx = static_cast<ssize_t>(touchStates_.size()) - 1;
             }
             TouchState& touchState = touchStates_.at(idx);
-            touchState.Initialize(deviceId, source);
+            touchState.Initialize(deviceId, source, config_);
             touchState.AddHistory(event);
             break;
         }
@@ -379,6 +406,7 @@ void EventResample::ResampleTouchState(int64_t sampleTime, MotionEvent* event, c
     const History* other;
     History future;
     float alpha;
+    bool predict = false;
     if (next) {
         // Interpolate between current sample and future sample.
         // So current->actionTime <= sampleTime <= future.actionTime.
@@ -399,21 +427,19 @@ void EventResample::ResampleTouchState(int64_t sampleTime, MotionEvent* event, c
         } else if (delta > RESAMPLE_MAX_DELTA) {
             return;
         }
-        int64_t maxPredict = current->actionTime + std::min(delta / 2, RESAMPLE_MAX_PREDICTION);
-        if (sampleTime > maxPredict) {
-            sampleTime = maxPredict;
-        }
+        sampleTime = ResamplePredictor::ClampHorizon(current->actionTime, delta, sampleTime, touchState.config);
         alpha = static_cast<float>(current->actionTime - sampleTime) / delta;
+        predict = (touchState.config.mode != ResampleMode::LINEAR);
     } else {
         return;
     }
 
     // Resample touch coordinates.
-    ResampleCoordinates(sampleTime, event, touchState, current, other, alpha);
+    ResampleCoordinates(sampleTime, event, touchState, current, other, alpha, predict);
 }
 
 void EventResample::ResampleCoordinates(int64_t sampleTime, MotionEvent* event, TouchState &touchState,
-                                        const History* current, const History* other, float alpha)
+                                        const History* current, const History* other, float alpha, bool predict)
 {
     History oldLastResample;
     oldLastResample.InitializeFrom(touchState.lastResample);
@@ -437,7 +463,8 @@ void EventResample::ResampleCoordinates(int64_t sampleTime, MotionEvent* event,
         if (item == event->pointers.end()) {
             return;
         }
-        if (other->HasPointerId(id) && ShouldResampleTool(item->second.toolType)) {
+        if (other->HasPointerId(id) && ShouldResampleTool(item->second.toolType) &&
+            !(predict && PredictCoordinates(touchState, id, sampleTime, resampledCoords))) {
             const Pointer& otherCoords = other->GetPointerById(id);
             resampledCoords.coordX = CalcCoord(currentCoords.coordX, otherCoords.coordX, alpha);
             resampledCoords.coordY = CalcCoord(currentCoords.coordY, otherCoords.coordY, alpha);
@@ -447,6 +474,37 @@ void EventResample::ResampleCoordinates(int64_t sampleTime, MotionEvent* event,
     }
 }
 
+bool EventResample::PredictCoordinates(const TouchState &touchState, uint32_t id, int64_t sampleTime,
+                                       Pointer &coords) const
+{
+    float x = 0.0F;
+    float y = 0.0F;
+    if (touchState.config.mode == ResampleMode::KALMAN) {
+        if ((id >= RESAMPLE_MAX_POINTERS) || !touchState.trackers[id].Predict(sampleTime, x, y)) {
+            return false;
+        }
+    } else {
+        ResampleSample samples[RESAMPLE_HISTORY_CAPACITY];
+        size_t count = 0;
+        size_t available = std::min(touchState.historySize, touchState.historyDepth);
+        for (size_t idx = 0; idx < available; ++idx) {
+            const History* history = touchState.GetHistory(idx);
+            if (!history->HasPointerId(id)) {
+                break;
+            }
+            const Pointer& pointer = history->GetPointerById(id);
+            samples[count++] = ResampleSample { history->actionTime, static_cast<float>(pointer.coordX),
+                static_cast<float>(pointer.coordY) };
+        }
+        if (!ResamplePredictor::ExtrapolateQuadratic(samples, count, sampleTime, x, y)) {
+            return false;
+        }
+    }
+    coords.coordX = static_cast<int32_t>(std::lround(x));
+    coords.coordY = static_cast<int32_t>(std::lround(y));
+    return true;
+}
+
 ssize_t EventResample::FindBatch(int32_t deviceId, int32_t source) const
 {
     ssize_t idx = 0;
@@ -519,6 +577,18 @@ bool EventResample::ShouldResampleTool(int32_t toolType)
     }
 }
 
+void EventResample::SetResampleConfig(const ResampleConfig &config)
+{
+    config_ = config;
+    MMI_HILOGI("Resample mode:%{public}d, history depth:%{public}zu, latency:%{public}" PRId64,
+        static_cast<int32_t>(config.mode), config.historyDepth, config.latency);
+}
+
+const ResampleConfig& EventResample::GetResampleConfig() const
+{
+    return config_;
+}
+
 void EventResample::PrintfDeviceName()
 {
     CHKPV(pointerEvent_);
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resample_predictor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr double US_PER_MS { static_cast<double>(RESAMPLE_US_PER_MS) };
+constexpr int32_t QUADRATIC_MIN_SAMPLES { 3 };
+constexpr double MIN_DETERMINANT { 1e-9 };
+// Initial velocity variance ((px/ms)^2), large enough for the first update to dominate.
+constexpr double INITIAL_VELOCITY_VARIANCE { 100.0 };
+constexpr double THIRD { 1.0 / 3.0 };
+constexpr double HALF { 0.5 };
+
+inline double Determinant3(double a00, double a01, double a02, double a10, double a11, double a12,
+    double a20, double a21, double a22)
+{
+    return a00 * (a11 * a22 - a12 * a21) - a01 * (a10 * a22 - a12 * a20) + a02 * (a10 * a21 - a11 * a20);
+}
+
+// Solves the normal equations of p(t) = c0 + c1 * t + c2 * t^2 and returns c0, c1, c2.
+bool SolveQuadratic(const double *moments, const double *rhs, double *coef)
+{
+    double det = Determinant3(moments[0], moments[1], moments[2], moments[1], moments[2], moments[3],
+        moments[2], moments[3], moments[4]);
+    if (std::fabs(det) < MIN_DETERMINANT) {
+        return false;
+    }
+    coef[0] = Determinant3(rhs[0], moments[1], moments[2], rhs[1], moments[2], moments[3],
+        rhs[2], moments[3], moments[4]) / det;
+    coef[1] = Determinant3(moments[0], rhs[0], moments[2], moments[1], rhs[1], moments[3],
+        moments[2], rhs[2], moments[4]) / det;
+    coef[2] = Determinant3(moments[0], moments[1], rhs[0], moments[1], moments[2], rhs[1],
+        moments[2], moments[3], rhs[2]) / det;
+    return true;
+}
+} // namespace
+
+void KalmanTracker::Reset()
+{
+    axisX_ = Axis();
+    axisY_ = Axis();
+    lastTime_ = 0;
+    updates_ = 0;
+}
+
+void KalmanTracker::Axis::Init(double value, double measurementNoise)
+{
+    pos = value;
+    vel = 0.0;
+    p00 = measurementNoise;
+    p01 = 0.0;
+    p11 = INITIAL_VELOCITY_VARIANCE;
+}
+
+void KalmanTracker::Axis::Update(double value, double dtMs, const ResampleConfig &config)
+{
+    // Predict with a constant velocity model driven by white noise acceleration.
+    double dt2 = dtMs * dtMs;
+    pos += vel * dtMs;
+    p00 += 2.0 * dtMs * p01 + dt2 * p11 + config.processNoise * dt2 * dtMs * THIRD;
+    p01 += dtMs * p11 + config.processNoise * dt2 * HALF;
+    p11 += config.processNoise * dtMs;
+
+    // Correct with the measured position.
+    double innovation = value - pos;
+    double gainDenominator = p00 + config.measurementNoise;
+    double gainPos = p00 / gainDenominator;
+    double gainVel = p01 / gainDenominator;
+    pos += gainPos * innovation;
+    vel += gainVel * innovation;
+    p11 -= gainVel * p01;
+    p01 -= gainPos * p01;
+    p00 -= gainPos * p00;
+}
+
+void KalmanTracker::Update(const ResampleSample &sample, const ResampleConfig &config)
+{
+    if (updates_ == 0 || sample.time <= lastTime_) {
+        if (updates_ == 0) {
+            axisX_.Init(sample.x, config.measurementNoise);
+            axisY_.Init(sample.y, config.measurementNoise);
+            lastTime_ = sample.time;
+            updates_ = 1;
+        }
+        return;
+    }
+    double dtMs = static_cast<double>(sample.time - lastTime_) / US_PER_MS;
+    axisX_.Update(sample.x, dtMs, config);
+    axisY_.Update(sample.y, dtMs, config);
+    lastTime_ = sample.time;
+    if (updates_ < READY_UPDATES) {
+        ++updates_;
+    }
+}
+
+bool KalmanTracker::Predict(int64_t time, float &x, float &y) const
+{
+    if (!IsReady()) {
+        return false;
+    }
+    double dtMs = static_cast<double>(std::max<int64_t>(time - lastTime_, 0)) / US_PER_MS;
+    x = static_cast<float>(axisX_.pos + axisX_.vel * dtMs);
+    y = static_cast<float>(axisY_.pos + axisY_.vel * dtMs);
+    return true;
+}
+
+bool ResamplePredictor::ExtrapolateQuadratic(const ResampleSample *history, size_t count, int64_t sampleTime,
+    float &x, float &y)
+{
+    if (history == nullptr || count < QUADRATIC_MIN_SAMPLES) {
+        return false;
+    }
+    count = std::min(count, RESAMPLE_HISTORY_CAPACITY);
+    // Times are taken relative to the newest sample, in milliseconds, to keep the system well conditioned.
+    double moments[5] = { 0.0 };
+    double rhsX[3] = { 0.0 };
+    double rhsY[3] = { 0.0 };
+    for (size_t i = 0; i < count; ++i) {
+        double t = static_cast<double>(history[i].time - history[0].time) / US_PER_MS;
+        double power = 1.0;
+        for (size_t k = 0; k < 5; ++k) {
+            moments[k] += power;
+            if (k < 3) {
+                rhsX[k] += power * history[i].x;
+                rhsY[k] += power * history[i].y;
+            }
+            power *= t;
+        }
+    }
+    double coefX[3] = { 0.0 };
+    double coefY[3] = { 0.0 };
+    if (!SolveQuadratic(moments, rhsX, coefX) || !SolveQuadratic(moments, rhsY, coefY)) {
+        return false;
+    }
+    double t = static_cast<double>(sampleTime - history[0].time) / US_PER_MS;
+    x = static_cast<float>(coefX[0] + t * (coefX[1] + t * coefX[2]));
+    y = static_cast<float>(coefY[0] + t * (coefY[1] + t * coefY[2]));
+    return true;
+}
+
+int64_t ResamplePredictor::ClampHorizon(int64_t lastTime, int64_t delta, int64_t sampleTime,
+    const ResampleConfig &config)
+{
+    int64_t horizon = std::min(delta / 2, config.maxPrediction);
+    if (config.frameInterval > 0) {
+        horizon = std::min(horizon, config.frameInterval / 2);
+    }
+    return std::min(sampleTime, lastTime + horizon);
+}
+
+size_t ResamplePredictor::ClampHistoryDepth(size_t depth)
+{
+    return std::clamp(depth, RESAMPLE_HISTORY_MIN, RESAMPLE_HISTORY_CAPACITY);
+}
+} // namespace MMI
+} // namespace OHOS
@@ -984,5 +984,155 @@ HWTEST_F(EventResampleTest, ShouldResampleToolTest1, TestSize.Level1)
     CALL_TEST_DEBUG;
     ASSERT_NO_FATAL_FAILURE(EventResampleHdr->ShouldResampleTool(PointerEvent::TOOL_TYPE_RUBBER));
 }
+
+namespace {
+// Feeds a single finger stroke sampled every 4ms from x(t) = 100 + 12t - t^2 / 2 (t in ms).
+void FeedStroke(EventResample &resample, int32_t deviceId, int32_t samples)
+{
+    constexpr int64_t interval = 4000;
+    for (int32_t i = 0; i < samples; ++i) {
+        EventResample::MotionEvent event;
+        event.deviceId = deviceId;
+        event.sourceType = PointerEvent::SOURCE_TYPE_TOUCHSCREEN;
+        event.pointerAction = (i == 0) ? PointerEvent::POINTER_ACTION_DOWN : PointerEvent::POINTER_ACTION_MOVE;
+        event.actionTime = i * interval;
+        int32_t ms = i * 4;
+        EventResample::Pointer pointer;
+        pointer.coordX = 100 + 12 * ms - ms * ms / 2;
+        pointer.coordY = 50;
+        pointer.toolType = PointerEvent::TOOL_TYPE_FINGER;
+        pointer.id = 0;
+        event.pointers[0] = pointer;
+        event.pointerCount = 1;
+        resample.UpdateTouchState(event);
+    }
+}
+
+EventResample::MotionEvent MakeMoveEvent(int32_t deviceId, int64_t actionTime)
+{
+    EventResample::MotionEvent event;
+    event.deviceId = deviceId;
+    event.sourceType = PointerEvent::SOURCE_TYPE_TOUCHSCREEN;
+    event.pointerAction = PointerEvent::POINTER_ACTION_MOVE;
+    event.actionTime = actionTime;
+    EventResample::Pointer pointer;
+    pointer.Reset();
+    pointer.toolType = PointerEvent::TOOL_TYPE_FINGER;
+    event.pointers[0] = pointer;
+    event.pointerCount = 1;
+    return event;
+}
+} // namespace
+
+/**
+ * @tc.name: EventResampleTest_ResampleConfig_001
+ * @tc.desc: The configuration set on the resampler applies from the next touch down
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventResampleTest, EventResampleTest_ResampleConfig_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventResample resample;
+    EXPECT_EQ(resample.GetResampleConfig().latency, EventResample::RESAMPLE_LATENCY);
+    EXPECT_EQ(resample.GetResampleConfig().maxPrediction, EventResample::RESAMPLE_MAX_PREDICTION);
+    ResampleConfig config;
+    config.mode = ResampleMode::QUADRATIC;
+    config.historyDepth = 4;
+    resample.SetResampleConfig(config);
+    EXPECT_EQ(resample.GetResampleConfig().mode, ResampleMode::QUADRATIC);
+
+    FeedStroke(resample, 1, 6);
+    ssize_t idx = resample.FindTouchState(1, PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    ASSERT_GE(idx, 0);
+    EXPECT_EQ(resample.touchStates_[idx].historyDepth, 4U);
+    EXPECT_EQ(resample.touchStates_[idx].historySize, 4U);
+    EXPECT_EQ(resample.touchStates_[idx].GetHistory(0)->actionTime, 20000);
+    EXPECT_EQ(resample.touchStates_[idx].GetHistory(3)->actionTime, 8000);
+}
+
+/**
+ * @tc.name: EventResampleTest_ResampleConfig_002
+ * @tc.desc: Kalman trackers of lifted pointers are reset, pointers beyond the tracked ids are not tracked
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventResampleTest, EventResampleTest_ResampleConfig_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventResample resample;
+    ResampleConfig config;
+    config.mode = ResampleMode::KALMAN;
+    resample.SetResampleConfig(config);
+    FeedStroke(resample, 1, 4);
+    ssize_t idx = resample.FindTouchState(1, PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    ASSERT_GE(idx, 0);
+    auto &touchState = resample.touchStates_[idx];
+    EXPECT_TRUE(touchState.trackers[0].IsReady());
+    EXPECT_EQ(touchState.trackedPointers, 1U);
+
+    EventResample::MotionEvent event = MakeMoveEvent(1, 14000);
+    event.pointers.clear();
+    EventResample::Pointer pointer;
+    pointer.Reset();
+    event.pointers[1] = pointer;
+    event.pointers[RESAMPLE_MAX_POINTERS] = pointer;
+    touchState.AddHistory(event);
+    EXPECT_FALSE(touchState.trackers[0].IsReady());
+    EXPECT_EQ(touchState.trackedPointers, 1U << 1);
+}
+
+/**
+ * @tc.name: EventResampleTest_ResampleTouchState_Predict_001
+ * @tc.desc: Quadratic prediction follows a decelerating stroke where linear extrapolation overshoots
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventResampleTest, EventResampleTest_ResampleTouchState_Predict_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventResample linear;
+    FeedStroke(linear, 1, 4);
+    EventResample::MotionEvent linearEvent = MakeMoveEvent(1, 12000);
+    linear.ResampleTouchState(14000, &linearEvent, nullptr);
+    // Two last samples 164 -> 172, extrapolated by half a delta.
+    EXPECT_EQ(linearEvent.pointers[0].coordX, 176);
+    EXPECT_EQ(linearEvent.actionTime, 14000);
+
+    EventResample quadratic;
+    ResampleConfig config;
+    config.mode = ResampleMode::QUADRATIC;
+    config.historyDepth = 4;
+    quadratic.SetResampleConfig(config);
+    FeedStroke(quadratic, 1, 4);
+    EventResample::MotionEvent quadraticEvent = MakeMoveEvent(1, 12000);
+    quadratic.ResampleTouchState(20000, &quadraticEvent, nullptr);
+    // The horizon is clamped to half a delta, the stroke is at 170 at 14ms.
+    EXPECT_EQ(quadraticEvent.pointers[0].coordX, 170);
+    EXPECT_EQ(quadraticEvent.pointers[0].coordY, 50);
+    EXPECT_EQ(quadraticEvent.actionTime, 14000);
+}
+
+/**
+ * @tc.name: EventResampleTest_ResampleTouchState_Predict_002
+ * @tc.desc: Kalman prediction stays near the stroke and honours the frame interval horizon
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventResampleTest, EventResampleTest_ResampleTouchState_Predict_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventResample resample;
+    ResampleConfig config;
+    config.mode = ResampleMode::KALMAN;
+    config.frameInterval = 2000;
+    resample.SetResampleConfig(config);
+    FeedStroke(resample, 1, 4);
+    EventResample::MotionEvent event = MakeMoveEvent(1, 12000);
+    resample.ResampleTouchState(20000, &event, nullptr);
+    EXPECT_EQ(event.actionTime, 13000);
+    EXPECT_GE(event.pointers[0].coordX, 164);
+    EXPECT_LE(event.pointers[0].coordX, 178);
+}
 } // namespace MMI
 } // namespace OHOS
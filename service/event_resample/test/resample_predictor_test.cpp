@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "resample_predictor.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int64_t SAMPLE_INTERVAL { 4000 };
+constexpr float POSITION_TOLERANCE { 0.01F };
+constexpr size_t TRACE_LENGTH { 4 };
+
+// Fills samples newest first with positions taken from fn at t = 0, -interval, -2 * interval, ...
+template<typename Fn>
+void MakeSamples(ResampleSample *samples, size_t count, Fn fn)
+{
+    for (size_t i = 0; i < count; ++i) {
+        int64_t time = -static_cast<int64_t>(i) * SAMPLE_INTERVAL;
+        samples[i] = ResampleSample { time, fn(time), fn(time) * 0.5F };
+    }
+}
+} // namespace
+
+class ResamplePredictorTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: ResamplePredictorTest_ExtrapolateQuadratic_001
+ * @tc.desc: Quadratic extrapolation is exact on a decelerating stroke where linear overshoots
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ResamplePredictorTest, ResamplePredictorTest_ExtrapolateQuadratic_001, TestSize.Level1)
+{
+    // Position in px for t in us, velocity falls to zero at t = 4000.
+    auto stroke = [](int64_t t) {
+        float ms = static_cast<float>(t) / 1000.0F;
+        return 200.0F + 8.0F * ms - ms * ms;
+    };
+    ResampleSample samples[TRACE_LENGTH];
+    MakeSamples(samples, TRACE_LENGTH, stroke);
+    float quadX = 0.0F;
+    float quadY = 0.0F;
+    ASSERT_TRUE(ResamplePredictor::ExtrapolateQuadratic(samples, TRACE_LENGTH, 4000, quadX, quadY));
+    EXPECT_NEAR(quadX, stroke(4000), POSITION_TOLERANCE);
+    EXPECT_NEAR(quadY, stroke(4000) * 0.5F, POSITION_TOLERANCE);
+
+    // Linear extrapolation of the two latest samples, as done without prediction.
+    float alpha = static_cast<float>(4000 - samples[0].time) / (samples[0].time - samples[1].time);
+    float linearX = samples[0].x + alpha * (samples[0].x - samples[1].x);
+    EXPECT_GT(std::fabs(linearX - stroke(4000)), std::fabs(quadX - stroke(4000)));
+}
+
+/**
+ * @tc.name: ResamplePredictorTest_ExtrapolateQuadratic_002
+ * @tc.desc: Quadratic extrapolation rejects too few or degenerate samples
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ResamplePredictorTest, ResamplePredictorTest_ExtrapolateQuadratic_002, TestSize.Level1)
+{
+    ResampleSample samples[TRACE_LENGTH];
+    MakeSamples(samples, TRACE_LENGTH, [](int64_t) { return 1.0F; });
+    float x = 0.0F;
+    float y = 0.0F;
+    EXPECT_FALSE(ResamplePredictor::ExtrapolateQuadratic(samples, 2, 1000, x, y));
+    for (auto &sample : samples) {
+        sample.time = 0;
+    }
+    EXPECT_FALSE(ResamplePredictor::ExtrapolateQuadratic(samples, TRACE_LENGTH, 1000, x, y));
+    EXPECT_FALSE(ResamplePredictor::ExtrapolateQuadratic(nullptr, TRACE_LENGTH, 1000, x, y));
+}
+
+/**
+ * @tc.name: ResamplePredictorTest_KalmanTracker_001
+ * @tc.desc: Kalman tracker converges on a constant velocity stroke
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ResamplePredictorTest, ResamplePredictorTest_KalmanTracker_001, TestSize.Level1)
+{
+    ResampleConfig config;
+    KalmanTracker tracker;
+    float x = 0.0F;
+    float y = 0.0F;
+    EXPECT_FALSE(tracker.Predict(0, x, y));
+    constexpr int32_t samples = 30;
+    for (int32_t i = 0; i < samples; ++i) {
+        int64_t time = i * SAMPLE_INTERVAL;
+        tracker.Update(ResampleSample { time, 2.0F * i, 100.0F }, config);
+    }
+    ASSERT_TRUE(tracker.IsReady());
+    int64_t lastTime = (samples - 1) * SAMPLE_INTERVAL;
+    ASSERT_TRUE(tracker.Predict(lastTime + SAMPLE_INTERVAL, x, y));
+    EXPECT_NEAR(x, 2.0F * samples, 0.5F);
+    EXPECT_NEAR(y, 100.0F, 0.5F);
+    tracker.Reset();
+    EXPECT_FALSE(tracker.IsReady());
+}
+
+/**
+ * @tc.name: ResamplePredictorTest_ClampHorizon_001
+ * @tc.desc: Prediction horizon is bounded by half the sample delta, the maximum and half a frame
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ResamplePredictorTest, ResamplePredictorTest_ClampHorizon_001, TestSize.Level1)
+{
+    ResampleConfig config;
+    EXPECT_EQ(ResamplePredictor::ClampHorizon(10000, 4000, 20000, config), 12000);
+    EXPECT_EQ(ResamplePredictor::ClampHorizon(10000, 16000, 20000, config), 10000 + config.maxPrediction);
+    EXPECT_EQ(ResamplePredictor::ClampHorizon(10000, 4000, 11000, config), 11000);
+    config.frameInterval = 2778;
+    EXPECT_EQ(ResamplePredictor::ClampHorizon(10000, 16000, 20000, config), 11389);
+    EXPECT_EQ(ResamplePredictor::ClampHistoryDepth(0), RESAMPLE_HISTORY_MIN);
+    EXPECT_EQ(ResamplePredictor::ClampHistoryDepth(100), RESAMPLE_HISTORY_CAPACITY);
+}
+} // namespace MMI
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include "event_filter_handler.h"
 
 #include "dfx_hisysevent.h"
+#include "event_stage_tracer.h"
 
 #undef MMI_LOG_DOMAIN
 #define MMI_LOG_DOMAIN MMI_LOG_HANDLER
@@ -29,6 +30,7 @@ void EventFilterHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent
 {
     CALL_DEBUG_ENTER;
     CHKPV(keyEvent);
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::FILTER);
     if (TouchPadKnuckleDoubleClickHandle(keyEvent)) {
         return;
     }
@@ -46,6 +48,7 @@ void EventFilterHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent
 void EventFilterHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::FILTER);
     if (HandlePointerEventFilter(pointerEvent)) {
         return;
     }
@@ -58,6 +61,7 @@ void EventFilterHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent>
 void EventFilterHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::FILTER);
     if (HandlePointerEventFilter(pointerEvent)) {
         MMI_HILOGD("Touch event is filtered");
         return;
@@ -169,7 +173,7 @@ bool EventFilterHandler::HandleKeyEventFilter(std::shared_ptr<KeyEvent> event)
             DfxHisysevent::KEY_ERROR_CODE::INVALID_PARAMETER);
         return false;
     }
-    std::shared_ptr<InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(keyItems.front().GetDeviceId());
+    std::shared_ptr<const InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(keyItems.front().GetDeviceId());
     CHKPF(inputDevice);
     for (auto &i: filters_) {
         if (!inputDevice->HasCapability(i.deviceTags)) {
@@ -194,7 +198,7 @@ bool EventFilterHandler::HandlePointerEventFilter(std::shared_ptr<PointerEvent>
     if (filters_.empty()) {
         return false;
     }
-    std::shared_ptr<InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(event->GetDeviceId());
+    std::shared_ptr<const InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(event->GetDeviceId());
     for (auto &i: filters_) {
         if (inputDevice != nullptr && !inputDevice->HasCapability(i.deviceTags)) {
             continue;
@@ -17,7 +17,7 @@
 namespace OHOS {
 using namespace OHOS::MMI;
 
-std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
+std::shared_ptr<const InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
 {
     if (DfsMessageParcel::messageParcel == nullptr) {
         return 0;
@@ -453,10 +453,10 @@ void FingerprintEventProcessor::StartSmartKey(bool isShowDialog)
         }
         auto begin = std::chrono::high_resolution_clock::now();
         auto ret = abmc->StartExtensionAbility(want, nullptr, -1, AppExecFwk::ExtensionAbilityType::SERVICE);
-        auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY, durationMS);
+        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
         if (ret != RET_OK) {
             MMI_HILOGE("StartExtensionAbility failed, ret:%{public}d", ret);
@@ -491,10 +491,10 @@ void FingerprintEventProcessor::ReportResSched(uint32_t resType, int64_t value)
     std::unordered_map<std::string, std::string> payload { {"msg", ""} };
     auto begin = std::chrono::high_resolution_clock::now();
     ResourceSchedule::ResSchedClient::GetInstance().ReportData(resType, value, payload);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
 }
 #endif // OHOS_BUILD_ENABLE_FINGERPRINT
@@ -19,6 +19,7 @@
 #include "define_multimodal.h"
 #include "dfx_hisysevent.h"
 #include "event_dispatch_handler.h"
+#include "event_stage_tracer.h"
 #include "input_device_manager.h"
 #include "input_event_data_transformation.h"
 #include "input_event_handler.h"
@@ -45,6 +46,7 @@ const std::string DEFAULT_KEYEVENT_INTERCEPT_WHITELIST = "2722;41;40;0;22;17;16;
 void EventInterceptorHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::INTERCEPT);
     if (TouchPadKnuckleDoubleClickHandle(keyEvent)) {
         return;
     }
@@ -92,6 +94,7 @@ bool EventInterceptorHandler::KeyInterceptByHostOSWhiteList(int32_t keyCode)
 void EventInterceptorHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::INTERCEPT);
     if (OnHandleEvent(pointerEvent)) {
         BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_STOP);
         MMI_HILOGD("Interception is succeeded");
@@ -106,6 +109,7 @@ void EventInterceptorHandler::HandlePointerEvent(const std::shared_ptr<PointerEv
 void EventInterceptorHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::INTERCEPT);
     if (OnHandleEvent(pointerEvent)) {
         BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_STOP);
         MMI_HILOGD("Interception is succeeded");
@@ -268,8 +272,7 @@ bool EventInterceptorHandler::InterceptorCollection::HandleEvent(std::shared_ptr
             DfxHisysevent::KEY_ERROR_CODE::INVALID_PARAMETER);
         return false;
     }
-    std::shared_ptr<InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(keyItems.front().GetDeviceId());
-    CHKPF(inputDevice);
+    int32_t deviceId = keyItems.front().GetDeviceId();
     uint32_t capKeyboard = CapabilityToTags(InputDeviceCapability::INPUT_DEV_CAP_KEYBOARD);
     for (const auto &interceptor : interceptors_) {
         MMI_HILOGD("The eventType:%{public}d, deviceTags:%{public}d",
@@ -278,7 +281,7 @@ bool EventInterceptorHandler::InterceptorCollection::HandleEvent(std::shared_ptr
             MMI_HILOGD("Interceptor cap does not have keyboard");
             continue;
         }
-        if (!inputDevice->HasCapability(interceptor.deviceTags_)) {
+        if (!INPUT_DEV_MGR->HasCapability(deviceId, interceptor.deviceTags_)) {
             continue;
         }
         auto session = interceptor.session_;
@@ -317,8 +320,7 @@ bool EventInterceptorHandler::InterceptorCollection::HandleEvent(std::shared_ptr
         MMI_HILOGE("GetPointerItem:%{public}d fail", pointerId);
         return false;
     }
-    std::shared_ptr<InputDevice> inputDevice = INPUT_DEV_MGR->GetInputDevice(pointerItem.GetDeviceId(), false);
-    CHKPF(inputDevice);
+    int32_t deviceId = pointerItem.GetDeviceId();
     uint32_t capPointer = CapabilityToTags(InputDeviceCapability::INPUT_DEV_CAP_POINTER);
     uint32_t capTouch = CapabilityToTags(InputDeviceCapability::INPUT_DEV_CAP_TOUCH);
     for (const auto &interceptor : interceptors_) {
@@ -332,7 +334,7 @@ bool EventInterceptorHandler::InterceptorCollection::HandleEvent(std::shared_ptr
             continue;
         }
 #ifndef OHOS_BUILD_EMULATOR
-        if (!inputDevice->HasCapability(interceptor.deviceTags_)) {
+        if (!INPUT_DEV_MGR->HasCapability(deviceId, interceptor.deviceTags_, false)) {
             continue;
         }
 #endif // OHOS_BUILD_EMULATOR
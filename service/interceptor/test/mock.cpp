@@ -39,7 +39,7 @@ void InputDeviceManager::Detach(std::shared_ptr<IDeviceObserver> observer)
 void InputDeviceManager::NotifyPointerDevice(bool hasPointerDevice, bool isVisible, bool isHotPlug)
 {}
 
-std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
+std::shared_ptr<const InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
 {
     if (DfsMessageParcel::messageParcel == nullptr) {
         return nullptr;
@@ -47,6 +47,12 @@ std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId
     return DfsMessageParcel::messageParcel->GetInputDevice(deviceId, checked);
 }
 
+bool InputDeviceManager::HasCapability(int32_t deviceId, uint32_t deviceTags, bool checked) const
+{
+    auto inputDevice = GetInputDevice(deviceId, checked);
+    return (inputDevice != nullptr) && inputDevice->HasCapability(deviceTags);
+}
+
 void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> key, HandlerType handlerType)
 {}
 
@@ -15,20 +15,41 @@
 
 #ifndef JOYSTICK_EVENT_PROCESSOR_H
 #define JOYSTICK_EVENT_PROCESSOR_H
+#include <array>
 #include <map>
 
 #include <libinput.h>
 
+#include "device_config_file_parser.h"
 #include "key_event.h"
 #include "pointer_event.h"
 
 namespace OHOS {
 namespace MMI {
 class JoystickEventProcessor final {
+    enum class AxisKind {
+        STICK,
+        TRIGGER,
+        HAT,
+    };
+
     struct AxisInfo {
-        std::string name;
+        enum libinput_joystick_axis_source source;
+        const char *name;
         PointerEvent::AxisType axisType;
-        std::function<double(const struct libinput_event_joystick_axis_abs_info&)> normalize;
+        AxisKind kind;
+        // Index of the other axis of the same stick, used by the radial deadzone; AXIS_COUNT if none.
+        size_t pairIndex;
+    };
+
+    struct AxisState {
+        JoystickAxisCalibration calibration {};
+        double flat { 0.0 };
+        double value { 0.0 };
+        double filtered { 0.0 };
+        double reported { 0.0 };
+        bool isPending { false };
+        bool isReported { false };
     };
 
 public:
@@ -37,6 +58,7 @@ public:
     DISALLOW_COPY_AND_MOVE(JoystickEventProcessor);
 
     int32_t GetDeviceId() const;
+    void SetConfig(const JoystickConfig &config);
     std::shared_ptr<KeyEvent> OnButtonEvent(struct libinput_event *event);
     std::shared_ptr<PointerEvent> OnAxisEvent(struct libinput_event *event);
     void CheckIntention(std::shared_ptr<PointerEvent> pointerEvent,
@@ -52,106 +74,46 @@ private:
     std::shared_ptr<KeyEvent> FormatButtonEvent(const KeyEvent::KeyItem &button);
     std::shared_ptr<KeyEvent> CleanUpKeyEvent();
     std::string DumpJoystickAxisEvent(std::shared_ptr<PointerEvent> pointerEvent) const;
+    void UpdateAxis(size_t index, const struct libinput_event_joystick_axis_abs_info &axis);
+    bool FilterAxes();
+    double ApplyDeadzone(size_t index) const;
+    bool ShouldReport(size_t index, double value) const;
     static double Normalize(const struct libinput_event_joystick_axis_abs_info &axis, double low, double high);
+    static double ScaleDeadzone(double value, double deadzone);
 
 private:
+    static constexpr size_t AXIS_COUNT { 9 };
+    static constexpr size_t AXIS_X { 0 };
+    static constexpr size_t AXIS_Y { 1 };
+    static constexpr size_t AXIS_Z { 2 };
+    static constexpr size_t AXIS_RZ { 3 };
+
+    // Ordered by axis source, state of the axes is kept in arrays indexed the same way.
+    static constexpr std::array<AxisInfo, AXIS_COUNT> AXES {{
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_X, "X", PointerEvent::AXIS_TYPE_ABS_X, AxisKind::STICK, AXIS_Y },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_Y, "Y", PointerEvent::AXIS_TYPE_ABS_Y, AxisKind::STICK, AXIS_X },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_Z, "Z", PointerEvent::AXIS_TYPE_ABS_Z, AxisKind::STICK, AXIS_RZ },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_RZ, "RZ", PointerEvent::AXIS_TYPE_ABS_RZ, AxisKind::STICK, AXIS_Z },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_THROTTLE, "THROTTLE", PointerEvent::AXIS_TYPE_ABS_THROTTLE,
+            AxisKind::TRIGGER, AXIS_COUNT },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_GAS, "GAS", PointerEvent::AXIS_TYPE_ABS_GAS, AxisKind::TRIGGER,
+            AXIS_COUNT },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_BRAKE, "BRAKE", PointerEvent::AXIS_TYPE_ABS_BRAKE, AxisKind::TRIGGER,
+            AXIS_COUNT },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_HAT0X, "HAT0X", PointerEvent::AXIS_TYPE_ABS_HAT0X, AxisKind::HAT,
+            AXIS_COUNT },
+        { LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_HAT0Y, "HAT0Y", PointerEvent::AXIS_TYPE_ABS_HAT0Y, AxisKind::HAT,
+            AXIS_COUNT },
+    }};
+
     const int32_t deviceId_ { -1 };
     std::set<int32_t> pressedButtons_;
     std::shared_ptr<PointerEvent> pointerEvent_ { nullptr };
     std::shared_ptr<KeyEvent> keyEvent_ { nullptr };
-
-    const std::map<enum libinput_joystick_axis_source, AxisInfo> axesMap_ {
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_X,
-            AxisInfo {
-                .name = "X",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_X,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, -1.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_Y,
-            AxisInfo {
-                .name = "Y",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_Y,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, -1.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_Z,
-            AxisInfo {
-                .name = "Z",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_Z,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, -1.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_RZ,
-            AxisInfo {
-                .name = "RZ",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_RZ,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, -1.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_GAS,
-            AxisInfo {
-                .name = "GAS",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_GAS,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, 0.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_BRAKE,
-            AxisInfo {
-                .name = "BRAKE",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_BRAKE,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, 0.0, 1.0);
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_HAT0X,
-            AxisInfo {
-                .name = "HAT0X",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_HAT0X,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return axis.value;
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_HAT0Y,
-            AxisInfo {
-                .name = "HAT0Y",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_HAT0Y,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return axis.value;
-                }
-            },
-        },
-        {
-            LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_THROTTLE,
-            AxisInfo {
-                .name = "THROTTLE",
-                .axisType = PointerEvent::AXIS_TYPE_ABS_THROTTLE,
-                .normalize = [](const struct libinput_event_joystick_axis_abs_info &axis) {
-                    return JoystickEventProcessor::Normalize(axis, 0.0, 1.0);
-                }
-            },
-        },
-    };
+    double axialDeadzone_ { 0.0 };
+    double radialDeadzone_ { 0.0 };
+    double changeThreshold_ { 0.0 };
+    std::array<AxisState, AXIS_COUNT> axes_ {};
 };
 
 inline int32_t JoystickEventProcessor::GetDeviceId() const
@@ -61,7 +61,9 @@ std::shared_ptr<JoystickEventProcessor> JoystickEventNormalize::GetProcessor(str
         return iter->second;
     }
     auto deviceId = INPUT_DEV_MGR->FindInputDeviceId(inputDev);
-    auto [iter, _] = processors_.emplace(inputDev, std::make_shared<JoystickEventProcessor>(deviceId));
+    auto processor = std::make_shared<JoystickEventProcessor>(deviceId);
+    processor->SetConfig(DeviceConfigManagement().GetJoystickConfig(inputDev));
+    auto [iter, _] = processors_.emplace(inputDev, processor);
     return iter->second;
 }
 
@@ -15,6 +15,7 @@
 
 #include "joystick_event_processor.h"
 
+#include <cmath>
 #include <iomanip>
 
 #include "key_map_manager.h"
@@ -31,10 +32,36 @@ namespace MMI {
 namespace {
 constexpr int32_t DEFAULT_POINTER_ID { 0 };
 constexpr double THRESHOLD { 0.01 };
+constexpr double DEFAULT_AXIAL_DEADZONE { 0.0 };
+constexpr double DEFAULT_RADIAL_DEADZONE { 0.0 };
+constexpr double DEFAULT_CHANGE_THRESHOLD { 0.01 };
+constexpr double MAX_DEADZONE { 0.9 };
+constexpr double MAX_CHANGE_THRESHOLD { 0.5 };
+constexpr double HALF { 0.5 };
+
+double ConfigValue(double value, double defaultValue, double maxValue)
+{
+    return (value < 0.0 ? defaultValue : std::min(value, maxValue));
+}
 } // namespace
 
 JoystickEventProcessor::JoystickEventProcessor(int32_t deviceId)
-    : deviceId_(deviceId) {}
+    : deviceId_(deviceId), axialDeadzone_(DEFAULT_AXIAL_DEADZONE), radialDeadzone_(DEFAULT_RADIAL_DEADZONE),
+      changeThreshold_(DEFAULT_CHANGE_THRESHOLD) {}
+
+void JoystickEventProcessor::SetConfig(const JoystickConfig &config)
+{
+    axialDeadzone_ = ConfigValue(config.axialDeadzone, DEFAULT_AXIAL_DEADZONE, MAX_DEADZONE);
+    radialDeadzone_ = ConfigValue(config.radialDeadzone, DEFAULT_RADIAL_DEADZONE, MAX_DEADZONE);
+    changeThreshold_ = ConfigValue(config.changeThreshold, DEFAULT_CHANGE_THRESHOLD, MAX_CHANGE_THRESHOLD);
+    for (size_t index = 0; index < AXES.size(); ++index) {
+        auto iter = config.calibrations.find(AXES[index].name);
+        axes_[index].calibration = (iter != config.calibrations.cend() ? iter->second : JoystickAxisCalibration {});
+    }
+    MMI_HILOGI("Joystick(%{public}d) axial deadzone:%{public}.3f, radial deadzone:%{public}.3f, "
+        "change threshold:%{public}.3f, %{public}zu calibrated axes", deviceId_, axialDeadzone_, radialDeadzone_,
+        changeThreshold_, config.calibrations.size());
+}
 
 std::shared_ptr<KeyEvent> JoystickEventProcessor::OnButtonEvent(struct libinput_event *event)
 {
@@ -76,18 +103,27 @@ std::shared_ptr<PointerEvent> JoystickEventProcessor::OnAxisEvent(struct libinpu
         pointerItem.SetDeviceId(deviceId_);
         pointerEvent_->AddPointerItem(pointerItem);
     }
+    for (size_t index = 0; index < AXES.size(); ++index) {
+        if (libinput_event_get_joystick_axis_value_is_changed(rawAxisEvent, AXES[index].source)) {
+            auto rawAxisInfo = libinput_event_get_joystick_axis_abs_info(rawAxisEvent, AXES[index].source);
+            CHKPC(rawAxisInfo);
+            UpdateAxis(index, *rawAxisInfo);
+        }
+    }
+    if (!FilterAxes()) {
+        MMI_HILOGD("No joystick axis changed beyond the deadzones and change threshold");
+        return nullptr;
+    }
     int64_t time = GetSysClockTime();
     pointerEvent_->SetActionTime(time);
     pointerEvent_->SetActionStartTime(time);
     pointerEvent_->SetTargetDisplayId(-1);
 
-    for (const auto &item : axesMap_) {
-        if (libinput_event_get_joystick_axis_value_is_changed(rawAxisEvent, item.first)) {
-            auto rawAxisInfo = libinput_event_get_joystick_axis_abs_info(rawAxisEvent, item.first);
-            CHKPC(rawAxisInfo);
-            pointerEvent_->SetAxisValue(item.second.axisType, item.second.normalize(*rawAxisInfo));
+    for (size_t index = 0; index < AXES.size(); ++index) {
+        if (axes_[index].isReported) {
+            pointerEvent_->SetAxisValue(AXES[index].axisType, axes_[index].reported);
         } else {
-            pointerEvent_->ClearAxisStatus(item.second.axisType);
+            pointerEvent_->ClearAxisStatus(AXES[index].axisType);
         }
     }
     pointerEvent_->UpdateId();
@@ -241,7 +277,7 @@ std::string JoystickEventProcessor::DumpJoystickAxisEvent(std::shared_ptr<Pointe
 
     sAxes << "No:" << pointerEvent->GetId();
 
-    for (const auto &[_, axisInfo] : axesMap_) {
+    for (const auto &axisInfo : AXES) {
         sAxes << "," << axisInfo.name << ":" << std::fixed << std::setprecision(precision)
             << pointerEvent->GetAxisValue(axisInfo.axisType);
         if (pointerEvent->HasAxis(axisInfo.axisType)) {
@@ -265,5 +301,97 @@ double JoystickEventProcessor::Normalize(
     double norm = (value - axis.minimum) / (axis.maximum - axis.minimum);
     return (low + (high - low) * norm);
 }
+
+void JoystickEventProcessor::UpdateAxis(size_t index, const struct libinput_event_joystick_axis_abs_info &axis)
+{
+    auto &state = axes_[index];
+    state.isPending = true;
+    if (AXES[index].kind == AxisKind::HAT) {
+        state.value = static_cast<double>(axis.value);
+        return;
+    }
+    auto calibrated = axis;
+    if (state.calibration.isValid) {
+        calibrated.minimum = static_cast<decltype(calibrated.minimum)>(state.calibration.minimum);
+        calibrated.maximum = static_cast<decltype(calibrated.maximum)>(state.calibration.maximum);
+    }
+    double range = static_cast<double>(calibrated.maximum) - static_cast<double>(calibrated.minimum);
+    if (AXES[index].kind == AxisKind::STICK) {
+        state.flat = (range > 0.0 ? static_cast<double>(axis.flat) / (range * HALF) : 0.0);
+        state.value = Normalize(calibrated, -1.0, 1.0);
+    } else {
+        state.flat = (range > 0.0 ? static_cast<double>(axis.flat) / range : 0.0);
+        state.value = Normalize(calibrated, 0.0, 1.0);
+    }
+}
+
+bool JoystickEventProcessor::FilterAxes()
+{
+    // The radial deadzone couples both axes of a stick, so moving one may change the value of the other.
+    for (size_t index = 0; index < AXES.size(); ++index) {
+        if ((AXES[index].pairIndex < AXIS_COUNT) && axes_[AXES[index].pairIndex].isPending) {
+            axes_[index].isPending = true;
+        }
+    }
+    bool hasChange = false;
+    for (size_t index = 0; index < AXES.size(); ++index) {
+        auto &state = axes_[index];
+        state.isReported = false;
+        if (!state.isPending) {
+            continue;
+        }
+        state.isPending = false;
+        state.filtered = ApplyDeadzone(index);
+        if (ShouldReport(index, state.filtered)) {
+            state.reported = state.filtered;
+            state.isReported = true;
+            hasChange = true;
+        }
+    }
+    return hasChange;
+}
+
+double JoystickEventProcessor::ApplyDeadzone(size_t index) const
+{
+    const auto &axis = AXES[index];
+    const auto &state = axes_[index];
+    if (axis.kind == AxisKind::HAT) {
+        return state.value;
+    }
+    double value = ScaleDeadzone(state.value, std::max(axialDeadzone_, state.flat));
+    if ((axis.kind != AxisKind::STICK) || (axis.pairIndex >= AXIS_COUNT) || (radialDeadzone_ <= 0.0)) {
+        return value;
+    }
+    const auto &pair = axes_[axis.pairIndex];
+    double pairValue = ScaleDeadzone(pair.value, std::max(axialDeadzone_, pair.flat));
+    double magnitude = std::hypot(value, pairValue);
+    if (magnitude <= radialDeadzone_) {
+        return 0.0;
+    }
+    double scaled = (std::min(magnitude, 1.0) - radialDeadzone_) / (1.0 - radialDeadzone_);
+    return (value * scaled / magnitude);
+}
+
+bool JoystickEventProcessor::ShouldReport(size_t index, double value) const
+{
+    double reported = axes_[index].reported;
+    if (value == reported) {
+        return false;
+    }
+    if (AXES[index].kind == AxisKind::HAT) {
+        return true;
+    }
+    // Rest and full deflection are always reported, so sub-threshold steps never leave the axis short of them.
+    return ((std::abs(value - reported) >= changeThreshold_) || (value == 0.0) || (std::abs(value) >= 1.0));
+}
+
+double JoystickEventProcessor::ScaleDeadzone(double value, double deadzone)
+{
+    double magnitude = std::abs(value);
+    if (magnitude <= deadzone) {
+        return 0.0;
+    }
+    return std::copysign((std::min(magnitude, 1.0) - deadzone) / (1.0 - deadzone), value);
+}
 } // namespace MMI
 } // namespace OHOS
@@ -13,6 +13,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include <gtest/gtest.h>
 
 #include "joystick_event_processor.h"
@@ -78,6 +82,43 @@ namespace OHOS {
 namespace MMI {
 namespace {
 using namespace testing::ext;
+constexpr int32_t AXIS_MIN { -32768 };
+constexpr int32_t AXIS_MAX { 32767 };
+constexpr int32_t SAMPLE_INTERVAL_MS { 4 };
+constexpr int32_t N_REST_SAMPLES { 500 };
+constexpr int32_t N_RAMP_SAMPLES { 150 };
+constexpr int32_t N_HOLD_SAMPLES { 500 };
+constexpr double HOLD_DEFLECTION { 0.6 };
+constexpr double REST_NOISE { 0.03 };
+constexpr double MOTION_NOISE { 0.005 };
+constexpr uint32_t NOISE_SEED { 20250101 };
+
+struct libinput_event_joystick_axis_abs_info MakeStickSample(double deflection)
+{
+    struct libinput_event_joystick_axis_abs_info axis {};
+    double half = (static_cast<double>(AXIS_MAX) - static_cast<double>(AXIS_MIN)) / 2.0;
+    double center = (static_cast<double>(AXIS_MAX) + static_cast<double>(AXIS_MIN)) / 2.0;
+    axis.value = static_cast<decltype(axis.value)>(std::lround(center + std::clamp(deflection, -1.0, 1.0) * half));
+    axis.minimum = AXIS_MIN;
+    axis.maximum = AXIS_MAX;
+    return axis;
+}
+
+// Noise-free stick position along the X axis of a trace: rest, push out, hold, release.
+std::vector<double> MakeStickTrace()
+{
+    std::vector<double> trace;
+    trace.insert(trace.end(), N_REST_SAMPLES, 0.0);
+    for (int32_t index = 1; index <= N_RAMP_SAMPLES; ++index) {
+        trace.push_back(HOLD_DEFLECTION * index / N_RAMP_SAMPLES);
+    }
+    trace.insert(trace.end(), N_HOLD_SAMPLES, HOLD_DEFLECTION);
+    for (int32_t index = N_RAMP_SAMPLES - 1; index >= 0; --index) {
+        trace.push_back(HOLD_DEFLECTION * index / N_RAMP_SAMPLES);
+    }
+    trace.insert(trace.end(), N_REST_SAMPLES, 0.0);
+    return trace;
+}
 } // namespace
 
 class JoystickEventProcessorTest : public testing::Test {
@@ -513,5 +554,111 @@ HWTEST_F(JoystickEventProcessorTest, JoystickEventProcessorTest_Normalize_004, T
     double high = 1.0f;
     ASSERT_EQ(JoystickEvent->Normalize(axis, low, high), 0.5f);
 }
+
+/**
+ * @tc.name: JoystickEventProcessorTest_FilterAxes_001
+ * @tc.desc: Replay a noisy stick trace, noise within the deadzone and below the change threshold is suppressed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(JoystickEventProcessorTest, JoystickEventProcessorTest_FilterAxes_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    JoystickEventProcessor joystick(2);
+    JoystickConfig config;
+    config.radialDeadzone = 0.08;
+    config.changeThreshold = 0.02;
+    joystick.SetConfig(config);
+
+    std::mt19937 engine(NOISE_SEED);
+    std::uniform_real_distribution<double> restNoise(-REST_NOISE, REST_NOISE);
+    std::uniform_real_distribution<double> motionNoise(-MOTION_NOISE, MOTION_NOISE);
+    std::vector<double> trace = MakeStickTrace();
+    int32_t nEvents = 0;
+    int32_t lastReport = -1;
+    int32_t maxGap = 0;
+    for (int32_t index = 0; index < static_cast<int32_t>(trace.size()); ++index) {
+        // Added latency is the gap between consecutive reports while the stick is moving.
+        bool isMoving = (trace[index] != 0.0) && (trace[index] != HOLD_DEFLECTION);
+        if (!isMoving) {
+            lastReport = -1;
+        }
+        auto &noise = (trace[index] == 0.0 ? restNoise : motionNoise);
+        joystick.UpdateAxis(JoystickEventProcessor::AXIS_X, MakeStickSample(trace[index] + noise(engine)));
+        joystick.UpdateAxis(JoystickEventProcessor::AXIS_Y, MakeStickSample(noise(engine)));
+        if (!joystick.FilterAxes()) {
+            continue;
+        }
+        ++nEvents;
+        if (isMoving && (lastReport >= 0)) {
+            maxGap = std::max(maxGap, index - lastReport);
+        }
+        lastReport = (isMoving ? index : -1);
+    }
+    MMI_HILOGI("%{public}zu samples, %{public}d events, worst-case added latency %{public}d ms",
+        trace.size(), nEvents, maxGap * SAMPLE_INTERVAL_MS);
+    EXPECT_LT(nEvents * 4, static_cast<int32_t>(trace.size()));
+    double rampStep = HOLD_DEFLECTION / N_RAMP_SAMPLES;
+    EXPECT_LE(maxGap, static_cast<int32_t>(std::ceil((config.changeThreshold + 2 * MOTION_NOISE) / rampStep)) + 1);
+    EXPECT_EQ(joystick.axes_[JoystickEventProcessor::AXIS_X].reported, 0.0);
+    EXPECT_EQ(joystick.axes_[JoystickEventProcessor::AXIS_Y].reported, 0.0);
+}
+
+/**
+ * @tc.name: JoystickEventProcessorTest_FilterAxes_002
+ * @tc.desc: Axis calibration from the device config overrides the range reported by the device
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(JoystickEventProcessorTest, JoystickEventProcessorTest_FilterAxes_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    JoystickEventProcessor joystick(2);
+    JoystickConfig config;
+    config.calibrations["X"] = JoystickAxisCalibration { .isValid = true, .minimum = -16384, .maximum = 16384 };
+    joystick.SetConfig(config);
+
+    joystick.UpdateAxis(JoystickEventProcessor::AXIS_X, MakeStickSample(0.5));
+    joystick.UpdateAxis(JoystickEventProcessor::AXIS_Y, MakeStickSample(0.5));
+    ASSERT_TRUE(joystick.FilterAxes());
+    EXPECT_NEAR(joystick.axes_[JoystickEventProcessor::AXIS_X].reported, 1.0, 0.001);
+    EXPECT_NEAR(joystick.axes_[JoystickEventProcessor::AXIS_Y].reported, 0.5, 0.001);
+
+    joystick.UpdateAxis(JoystickEventProcessor::AXIS_Y, MakeStickSample(0.505));
+    EXPECT_FALSE(joystick.FilterAxes());
+    joystick.UpdateAxis(JoystickEventProcessor::AXIS_Y, MakeStickSample(1.0));
+    ASSERT_TRUE(joystick.FilterAxes());
+    EXPECT_FALSE(joystick.axes_[JoystickEventProcessor::AXIS_X].isReported);
+    EXPECT_DOUBLE_EQ(joystick.axes_[JoystickEventProcessor::AXIS_Y].reported, 1.0);
+}
+
+/**
+ * @tc.name: JoystickEventProcessorTest_FilterAxes_003
+ * @tc.desc: The flat of a trigger acts as its deadzone and the trigger is rescaled to the full range
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(JoystickEventProcessorTest, JoystickEventProcessorTest_FilterAxes_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    constexpr size_t gasIndex { 5 };
+    JoystickEventProcessor joystick(2);
+    ASSERT_EQ(JoystickEventProcessor::AXES[gasIndex].source, LIBINPUT_JOYSTICK_AXIS_SOURCE_ABS_GAS);
+    struct libinput_event_joystick_axis_abs_info axis {};
+    axis.minimum = 0;
+    axis.maximum = 1000;
+    axis.flat = 100;
+    axis.value = 50;
+    joystick.UpdateAxis(gasIndex, axis);
+    EXPECT_FALSE(joystick.FilterAxes());
+    axis.value = 550;
+    joystick.UpdateAxis(gasIndex, axis);
+    ASSERT_TRUE(joystick.FilterAxes());
+    EXPECT_NEAR(joystick.axes_[gasIndex].reported, 0.5, 0.001);
+    axis.value = 1000;
+    joystick.UpdateAxis(gasIndex, axis);
+    ASSERT_TRUE(joystick.FilterAxes());
+    EXPECT_NEAR(joystick.axes_[gasIndex].reported, 1.0, 0.001);
+}
 } // namespace MMI
 } // namespace OHOS
@@ -23,6 +23,7 @@
 #include "json_parser.h"
 #include "product_name_definition.h"
 #include "event_log_helper.h"
+#include "event_stage_tracer.h"
 #include "gesturesense_wrapper.h"
 #include "input_screen_capture_agent.h"
 #ifdef SHORTCUT_KEY_MANAGER_ENABLED
@@ -110,6 +111,7 @@ static void SensorDataCallbackImpl(SensorEvent *event)
 void KeyCommandHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::KEY_COMMAND);
     if (TouchPadKnuckleDoubleClickHandle(keyEvent)) {
         return;
     }
@@ -140,6 +142,7 @@ void KeyCommandHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 void KeyCommandHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::KEY_COMMAND);
     if (OnHandleEvent(pointerEvent)) {
         if (EventLogHelper::IsBetaVersion() && !pointerEvent->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
             MMI_HILOGD("The pointerEvent start launch an ability, pointAction:%{public}s",
@@ -157,6 +160,7 @@ void KeyCommandHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> p
 void KeyCommandHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::KEY_COMMAND);
     CHKPV(nextHandler_);
     OnHandleTouchEvent(pointerEvent);
     int32_t id = pointerEvent->GetPointerId();
@@ -2514,10 +2518,10 @@ void KeyCommandHandler::LaunchAbility(const Ability &ability, int64_t delay)
     MMI_HILOGW("Start launch ability, bundleName:%{public}s", ability.bundleName.c_str());
     auto begin = std::chrono::high_resolution_clock::now();
     ErrCode err = AAFwk::AbilityManagerClient::GetInstance()->StartAbility(want);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (err != ERR_OK) {
         MMI_HILOGE("LaunchAbility failed, bundleName:%{public}s, err:%{public}d", ability.bundleName.c_str(), err);
@@ -2558,10 +2562,10 @@ void KeyCommandHandler::LaunchAbility(const Ability &ability)
     if (ability.abilityType == EXTENSION_ABILITY) {
         auto begin = std::chrono::high_resolution_clock::now();
         ErrCode err = AAFwk::AbilityManagerClient::GetInstance()->StartExtensionAbility(want, nullptr);
-        auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY, durationMS);
+        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_START_EXT_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
         if (err != ERR_OK) {
             MMI_HILOGE("LaunchAbility failed, bundleName:%{public}s, err:%{public}d", ability.bundleName.c_str(), err);
@@ -2569,10 +2573,10 @@ void KeyCommandHandler::LaunchAbility(const Ability &ability)
     } else {
         auto begin = std::chrono::high_resolution_clock::now();
         ErrCode err = AAFwk::AbilityManagerClient::GetInstance()->StartAbility(want);
-        auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationMS);
+        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
         if (err != ERR_OK) {
             MMI_HILOGE("LaunchAbility failed, bundleName:%{public}s, err:%{public}d", ability.bundleName.c_str(), err);
@@ -19,6 +19,7 @@
 
 #include "param_wrapper.h"
 #include "property_reader.h"
+#include "event_stage_tracer.h"
 #include "input_device_manager.h"
 #include "input_windows_manager.h"
 #include "key_event_normalize.h"
@@ -876,6 +877,9 @@ void LibinputAdapter::OnEventHandler()
     libinput_event *event = nullptr;
     int64_t frameTime = GetSysClockTime();
     while ((event = libinput_get_event(input_))) {
+        if (EventStageTracer::IsEnabled()) {
+            EventStageTracer::MarkRead(libinput_event_get_sensortime(event));
+        }
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
         foldingAreaToast_.FoldingAreaProcess(event);
         libinput_event_type eventType = libinput_event_get_type(event);
@@ -988,6 +992,7 @@ type:%{private}d, accPressure:%{private}f, longAxis:%{private}d, shortAxis:%{pri
         libinput_event_destroy(event);
 #endif // OHOS_BUILD_ENABLE_VKEYBOARD
     }
+    EventStageTracer::EndRead();
     if (event == nullptr) {
         funInputEvent_(nullptr, 0);
     }
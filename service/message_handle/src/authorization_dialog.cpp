@@ -69,10 +69,10 @@ bool AuthorizationDialog::ConnectSystemUi()
     want.SetElementName("com.ohos.sceneboard", "com.ohos.sceneboard.systemdialog");
     auto begin = std::chrono::high_resolution_clock::now();
     ErrCode result = abilityMgr->ConnectAbility(want, dialogConnectionCallback_, INVALID_USERID);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (result != ERR_OK) {
         MMI_HILOGW("ConnectAbility systemui dialog failed, result:%{public}d", result);
@@ -57,10 +57,10 @@ bool InjectNoticeManager::StartNoticeAbility()
     want.SetElementName("com.ohos.powerdialog", "InjectNoticeAbility");
     auto begin = std::chrono::high_resolution_clock::now();
     int32_t result = client->StartAbility(want);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CLIENT_START_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (result != 0) {
         MMI_HILOGW("Start injectNoticeAbility failed, result:%{public}d", result);
@@ -85,10 +85,10 @@ bool InjectNoticeManager::ConnectNoticeSrv()
     want.SetElementName("com.ohos.powerdialog", "InjectNoticeAbility");
     auto begin = std::chrono::high_resolution_clock::now();
     ErrCode result = abilityMgr->ConnectAbility(want, connectionCallback_, INVALID_USERID);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::ABILITY_MGR_CONNECT_ABILITY, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (result != ERR_OK) {
         MMI_HILOGW("Connect InjectNoticeAbility failed, result:%{public}d", result);
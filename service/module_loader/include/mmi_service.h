@@ -34,6 +34,7 @@ namespace MMI {
 #if defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_MONITOR)
 class TouchGestureManager;
 #endif // defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_MONITOR)
+enum class TimeCostSite : int32_t;
 
 struct DeviceConsumer {
     std::string name {};
@@ -197,7 +198,7 @@ public:
     ErrCode SetTouchpadScrollRows(int32_t rows) override;
     ErrCode GetTouchpadScrollRows(int32_t &rows) override;
     ErrCode SkipPointerLayer(bool isSkip) override;
-    void CalculateFuntionRunningTime(std::function<void()> func, const std::string &flag);
+    void CalculateFuntionRunningTime(std::function<void()> func, TimeCostSite site);
     ErrCode SetClientInfo(int32_t pid, uint64_t readThreadId) override;
     ErrCode GetIntervalSinceLastInput(int64_t &timeInterval) override;
 #ifdef OHOS_BUILD_ENABLE_ANCO
@@ -66,6 +66,7 @@
 #include "permission_helper.h"
 #include "pointer_device_manager.h"
 #include "cursor_drawing_component.h"
+#include "scoped_time_cost.h"
 #include "touch_event_normalize.h"
 #if defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_MONITOR)
 #include "touch_gesture_manager.h"
@@ -541,10 +542,10 @@ void MMIService::AddAppDebugListener()
     auto begin = std::chrono::high_resolution_clock::now();
     auto errCode =
         AAFwk::AbilityManagerClient::GetInstance()->RegisterAppDebugListener(appDebugListener_);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (errCode != RET_OK) {
         MMI_HILOGE("Call RegisterAppDebugListener failed, errCode:%{public}d", errCode);
@@ -557,10 +558,10 @@ void MMIService::RemoveAppDebugListener()
     CHKPV(appDebugListener_);
     auto begin = std::chrono::high_resolution_clock::now();
     auto errCode = AAFwk::AbilityManagerClient::GetInstance()->UnregisterAppDebugListener(appDebugListener_);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::REGISTER_APP_DEBUG_LISTENER, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (errCode != RET_OK) {
         MMI_HILOGE("Call UnregisterAppDebugListener failed, errCode:%{public}d", errCode);
@@ -685,10 +686,10 @@ void MMIService::OnConnected(SessionPtr s)
     std::vector<AppExecFwk::RunningProcessInfo> info;
     auto begin = std::chrono::high_resolution_clock::now();
     appMgrClient->GetProcessRunningInfosByUserId(info, userid);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::GET_PROC_RUNNING_INFOS_BY_UID, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::GET_PROC_RUNNING_INFOS_BY_UID, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     for (auto &item : info) {
         if (item.bundleNames.empty()) {
@@ -2273,10 +2274,10 @@ void MMIService::OnAddResSchedSystemAbility(int32_t systemAbilityId, const std::
     auto begin = std::chrono::high_resolution_clock::now();
     ResourceSchedule::ResSchedClient::GetInstance().ReportData(
         ResourceSchedule::ResType::RES_TYPE_KEY_PERF_SCENE, userInteraction, payload);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     sleep(sleepSeconds);
 #ifdef OHOS_BUILD_PC_PRIORITY
@@ -3018,13 +3019,15 @@ void MMIService::OnThread()
             epoll_event event = ev[i];
             if (mmiEd->event_type == EPOLL_EVENT_INPUT) {
                 CalculateFuntionRunningTime([this, &mmiEd] () { libinputAdapter_.EventDispatch(mmiEd->fd); },
-                    "EPOLL_EVENT_INPUT");
+                    TimeCostSite::EPOLL_EVENT_INPUT);
             } else if (mmiEd->event_type == EPOLL_EVENT_SOCKET) {
-                CalculateFuntionRunningTime([this, &event]() { this->OnEpollEvent(event); }, "MMI:EPOLL_EVENT_SOCKET");
+                CalculateFuntionRunningTime([this, &event]() { this->OnEpollEvent(event); },
+                    TimeCostSite::EPOLL_EVENT_SOCKET);
             } else if (mmiEd->event_type == EPOLL_EVENT_SIGNAL) {
                 OnSignalEvent(mmiEd->fd);
             } else if (mmiEd->event_type == EPOLL_EVENT_ETASK) {
-                CalculateFuntionRunningTime([this, &event]() { this->OnDelegateTask(event); }, "MMI:EPOLL_EVENT_ETASK");
+                CalculateFuntionRunningTime([this, &event]() { this->OnDelegateTask(event); },
+                    TimeCostSite::EPOLL_EVENT_ETASK);
             } else {
                 MMI_HILOGW("Unknown epoll event type:%{public}d", mmiEd->event_type);
             }
@@ -4643,13 +4646,18 @@ ErrCode MMIService::TransferBinderClientSrv(const sptr<IRemoteObject> &binderCli
     return ret;
 }
 
-void MMIService::CalculateFuntionRunningTime(std::function<void()> func, const std::string &flag)
+void MMIService::CalculateFuntionRunningTime(std::function<void()> func, TimeCostSite site)
 {
-    std::function<void (void *)> printLog = std::bind(&MMIService::PrintLog, this, flag, THREAD_BLOCK_TIMER_SPAN_S,
-        getpid(), gettid());
-    int32_t id = HiviewDFX::XCollie::GetInstance().SetTimer(flag, THREAD_BLOCK_TIMER_SPAN_S, printLog, nullptr,
-        HiviewDFX::XCOLLIE_FLAG_NOOP);
-    func();
+    int32_t tid = gettid();
+    std::function<void (void *)> printLog = [this, site, tid](void *) {
+        PrintLog(TimeCostStatistics::GetSiteName(site), THREAD_BLOCK_TIMER_SPAN_S, getpid(), tid);
+    };
+    int32_t id = HiviewDFX::XCollie::GetInstance().SetTimer(TimeCostStatistics::GetSiteName(site),
+        THREAD_BLOCK_TIMER_SPAN_S, printLog, nullptr, HiviewDFX::XCOLLIE_FLAG_NOOP);
+    {
+        ScopedTimeCost timeCost(site);
+        func();
+    }
     HiviewDFX::XCollie::GetInstance().CancelTimer(id);
 }
 
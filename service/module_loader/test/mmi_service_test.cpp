@@ -20,6 +20,7 @@
 #include "input_event_handler.h"
 #include "mmi_log.h"
 #include "mmi_service.h"
+#include "scoped_time_cost.h"
 
 #undef MMI_LOG_TAG
 #define MMI_LOG_TAG "MMIServerTest"
@@ -4047,14 +4048,17 @@ HWTEST_F(MMIServerTest, MMIService_CalculateFuntionRunningTime_001, TestSize.Lev
 {
     CALL_TEST_DEBUG;
     MMIService mmiService;
-    std::string flag = "TestCalcFuncTime";
     bool executed = false;
     auto testFunc = [&executed]() {
         usleep(50000);
         executed = true;
     };
-    mmiService.CalculateFuntionRunningTime(testFunc, flag);
+    auto before = TimeCostStatistics::GetSnapshot(TimeCostSite::EPOLL_EVENT_ETASK);
+    mmiService.CalculateFuntionRunningTime(testFunc, TimeCostSite::EPOLL_EVENT_ETASK);
     EXPECT_TRUE(executed);
+    auto after = TimeCostStatistics::GetSnapshot(TimeCostSite::EPOLL_EVENT_ETASK);
+    EXPECT_EQ(after.count, before.count + 1);
+    EXPECT_EQ(after.overtimeCount, before.overtimeCount + 1);
 }
 
 /**
@@ -16,6 +16,7 @@
 #ifndef EVENT_MONITOR_HANDLER_H
 #define EVENT_MONITOR_HANDLER_H
 
+#include <array>
 #include <unordered_set>
 
 #include "gesture_monitor_handler.h"
@@ -152,13 +153,17 @@ private:
 #endif // OHOS_BUILD_ENABLE_TOUCH
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
         void IsSendToClient(const SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent,
-            NetPacket &pkt, std::unordered_set<int32_t> fingerFocusPidSet);
+            NetPacket &pkt, const std::unordered_set<int32_t> &fingerFocusPidSet);
         void Monitor(std::shared_ptr<PointerEvent> pointerEvent);
+        HandleEventType GetRouteMask(std::shared_ptr<PointerEvent> pointerEvent);
+        void CollectPointerRoutes(std::shared_ptr<PointerEvent> pointerEvent, HandleEventType routeMask,
+            std::vector<uint32_t> &candidates);
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
+        void RefreshRoutes();
         void OnSessionLost(SessionPtr session);
         void Dump(int32_t fd, const std::vector<std::string> &args);
-        bool CheckIfNeedSendToClient(SessionHandler monitor, std::shared_ptr<PointerEvent> pointerEvent,
-            std::unordered_set<int32_t> fingerFocusPidSet);
+        bool CheckIfNeedSendToClient(const SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent,
+            const std::unordered_set<int32_t> &fingerFocusPidSet);
         bool IsPinch(std::shared_ptr<PointerEvent> pointerEvent);
         bool IsRotate(std::shared_ptr<PointerEvent> pointerEvent);
         bool IsThreeFingersSwipe(std::shared_ptr<PointerEvent> pointerEvent);
@@ -167,12 +172,12 @@ private:
         bool IsThreeFingersTap(std::shared_ptr<PointerEvent> pointerEvent);
 #ifdef OHOS_BUILD_ENABLE_FINGERPRINT
         bool IsFingerprint(std::shared_ptr<PointerEvent> pointerEvent);
-        bool CheckIfNeedSendFingerprintEvent(SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent,
-            std::unordered_set<int32_t> fingerFocusPidSet);
+        bool CheckIfNeedSendFingerprintEvent(const SessionHandler &monitor,
+            std::shared_ptr<PointerEvent> pointerEvent, const std::unordered_set<int32_t> &fingerFocusPidSet);
 #endif // OHOS_BUILD_ENABLE_FINGERPRINT
 #ifdef OHOS_BUILD_ENABLE_X_KEY
         bool IsXKey(std::shared_ptr<PointerEvent> pointerEvent);
-        bool CheckIfNeedSendXkeyEvent(SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent);
+        bool CheckIfNeedSendXkeyEvent(const SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent);
 #endif // OHOS_BUILD_ENABLE_X_KEY
 
         struct ConsumptionState {
@@ -181,8 +186,21 @@ private:
             std::shared_ptr<PointerEvent> lastPointerEvent_ { nullptr };
         };
 
+        static constexpr size_t ROUTE_TYPE_BITS { 32 };
+        // Positions in monitors_ order, grouped by what a monitor subscribes to.
+        struct MonitorRoutes {
+            std::vector<const SessionHandler *> monitors;
+            std::array<std::vector<uint32_t>, ROUTE_TYPE_BITS> types;
+            std::vector<uint32_t> callbacks;
+            std::unordered_map<int32_t, std::vector<uint32_t>> actions;
+        };
+
     private:
         std::set<SessionHandler> monitors_;
+        MonitorRoutes routes_;
+        bool routesDirty_ { true };
+        uint32_t routeRebuildCount_ { 0 };
+        std::vector<uint32_t> routeCandidates_;
         std::map<int32_t, std::set<SessionHandler>> endScreenCaptureMonitors_;
         std::unordered_map<int32_t, ConsumptionState> states_;
         std::vector<int32_t> insertToMonitorsActions_;
@@ -16,6 +16,8 @@
 #ifndef EVENT_PRE_MONITOR_HANDLER_H
 #define EVENT_PRE_MONITOR_HANDLER_H
 
+#include <unordered_map>
+
 #include "i_input_event_collection_handler.h"
 #include "i_input_event_handler.h"
 #include "uds_session.h"
@@ -89,13 +91,17 @@ private:
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
         int32_t AddMonitor(const std::shared_ptr<SessionHandler> monitor, std::vector<int32_t> keys);
         void RemoveMonitor(SessionPtr sess, int32_t handlerId);
-        bool IsEqualsKeys(std::vector<int32_t> newKeys, std::vector<int32_t> oldKeys);
+        bool IsEqualsKeys(const std::vector<int32_t> &newKeys, const std::vector<int32_t> &oldKeys);
+        void UpdateKeyIndex();
 
         void OnSessionLost(SessionPtr session);
         void Dump(int32_t fd, const std::vector<std::string> &args);
 
     private:
         std::map<std::vector<int32_t>, std::list<std::shared_ptr<SessionHandler>>> sessionHandlers_;
+        // Handlers by each key code they registered, kept in the iteration order of sessionHandlers_.
+        std::unordered_map<int32_t, std::vector<std::shared_ptr<SessionHandler>>> keyIndex_;
+        bool keyIndexDirty_ { true };
     };
 
 private:
@@ -14,6 +14,7 @@
  */
  
 #include "bytrace_adapter.h"
+#include "event_stage_tracer.h"
 #include "input_event_data_transformation.h"
 #include "input_event_handler.h"
 #include "util_ex.h"
@@ -35,12 +36,23 @@ constexpr int32_t UNOBSERVED { -1 };
 constexpr int32_t POWER_UID { 5528 };
 constexpr int32_t THREE_FINGERS { 3 };
 constexpr int32_t FOUR_FINGERS { 4 };
+
+constexpr size_t GetRouteBit(HandleEventType eventType)
+{
+    size_t bit = 0;
+    while (eventType > 1U) {
+        eventType >>= 1;
+        ++bit;
+    }
+    return bit;
+}
 } // namespace
 
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
 void EventMonitorHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::MONITOR);
     OnHandleEvent(keyEvent);
     CHKPV(nextHandler_);
     nextHandler_->HandleKeyEvent(keyEvent);
@@ -51,6 +63,7 @@ void EventMonitorHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEven
 void EventMonitorHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::MONITOR);
     if (OnHandleEvent(pointerEvent)) {
         BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_STOP);
         MMI_HILOGD("Monitor is succeeded");
@@ -65,6 +78,7 @@ void EventMonitorHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent>
 void EventMonitorHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::MONITOR);
     if (OnHandleEvent(pointerEvent)) {
         BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_STOP);
         MMI_HILOGD("Monitor is succeeded");
@@ -235,10 +249,6 @@ void EventMonitorHandler::SessionHandler::SendToClient(std::shared_ptr<KeyEvent>
 {
     CHKPV(keyEvent);
     CHKPV(session_);
-    if (InputEventDataTransformation::KeyEventToNetPacket(keyEvent, pkt) != RET_OK) {
-        MMI_HILOGE("Packet key event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
-        return;
-    }
     if (!session_->SendMsg(pkt)) {
         MMI_HILOGE("Send message failed, errCode:%{public}d", MSG_SEND_FAIL);
     }
@@ -284,6 +294,7 @@ int32_t EventMonitorHandler::MonitorCollection::AddMonitor(const SessionHandler&
         }
     }
     auto [sIter, isOk] = monitors_.insert(monitor);
+    routesDirty_ = true;
     if (!isOk) {
         MMI_HILOGE("Failed to add monitor");
         return RET_ERR;
@@ -308,6 +319,7 @@ int32_t EventMonitorHandler::MonitorCollection::UpdateEventTypeMonitor(const std
 
     monitors_.erase(iter);
     auto [sIter, isOk] = monitors_.insert(handler);
+    routesDirty_ = true;
     if (!isOk) {
         if (isFound) {
             MMI_HILOGE("Internal error: monitor has been removed");
@@ -328,6 +340,7 @@ int32_t EventMonitorHandler::MonitorCollection::UpdateActionsTypeMonitor(const s
         }
         monitors_.erase(iter);
         auto [sIter, isOk] = monitors_.insert(monitor);
+        routesDirty_ = true;
         if (!isOk && isFound) {
             MMI_HILOGE("Internal error: monitor has been removed");
             return RET_ERR;
@@ -367,6 +380,7 @@ void EventMonitorHandler::MonitorCollection::RemoveMonitor(const SessionHandler&
         handler(gestureHandler);
     }
     monitors_.erase(iter);
+    routesDirty_ = true;
     if (monitor.session_) {
         int32_t pid = monitor.session_->GetPid();
         auto it = endScreenCaptureMonitors_.find(pid);
@@ -436,10 +450,14 @@ bool EventMonitorHandler::MonitorCollection::HandleEvent(std::shared_ptr<KeyEven
         MMI_HILOGE("Packet write key event failed");
         return false;
     }
-    for (const auto &mon : monitors_) {
-        if ((mon.eventType_ & HANDLE_EVENT_TYPE_KEY) != HANDLE_EVENT_TYPE_KEY) {
-            continue;
-        }
+    // Marshalled once, every monitor receives the same bytes.
+    if (InputEventDataTransformation::KeyEventToNetPacket(keyEvent, pkt) != RET_OK) {
+        MMI_HILOGE("Packet key event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
+        return false;
+    }
+    RefreshRoutes();
+    for (uint32_t index : routes_.types[GetRouteBit(HANDLE_EVENT_TYPE_KEY)]) {
+        const SessionHandler &mon = *routes_.monitors[index];
         if (!keyEvent->GetFourceMonitorFlag()) {
             mon.SendToClient(keyEvent, pkt);
         } else if (mon.session_ != nullptr && mon.session_->GetUid() == POWER_UID) {
@@ -517,6 +535,7 @@ void EventMonitorHandler::MonitorCollection::RemoveScreenCaptureMonitor(SessionP
             monitors_.erase(it);
         }
     }
+    routesDirty_ = true;
     endScreenCaptureMonitors_.emplace(pid, monitorSet);
 }
 
@@ -532,6 +551,7 @@ void EventMonitorHandler::MonitorCollection::RecoveryScreenCaptureMonitor(Sessio
             SessionHandler screenCaptureMointor(monitor);
             monitors_.insert(screenCaptureMointor);
         }
+        routesDirty_ = true;
         endScreenCaptureMonitors_.erase(it);
     }
 }
@@ -590,7 +610,7 @@ void EventMonitorHandler::MonitorCollection::UpdateConsumptionState(std::shared_
 
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
 void EventMonitorHandler::MonitorCollection::IsSendToClient(const SessionHandler &monitor,
-    std::shared_ptr<PointerEvent> pointerEvent, NetPacket &pkt, std::unordered_set<int32_t> fingerFocusPidSet)
+    std::shared_ptr<PointerEvent> pointerEvent, NetPacket &pkt, const std::unordered_set<int32_t> &fingerFocusPidSet)
 {
     if (monitor.Expect(pointerEvent)) {
         if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_SWIPE_BEGIN ||
@@ -636,18 +656,25 @@ void EventMonitorHandler::MonitorCollection::Monitor(std::shared_ptr<PointerEven
     pointerEvent->GetPointerItem(pointerId, pointerItem);
     int32_t displayX = pointerItem.GetDisplayX();
     int32_t displayY = pointerItem.GetDisplayY();
-    int32_t displayId = pointerEvent->GetTargetDisplayId();
+    RefreshRoutes();
+    HandleEventType routeMask = GetRouteMask(pointerEvent);
     std::unordered_set<int32_t> fingerFocusPidSet;
-    for (const auto &monitor : monitors_) {
-        CHKPC(monitor.session_);
-        if ((monitor.eventType_ & HANDLE_EVENT_TYPE_FINGERPRINT) == HANDLE_EVENT_TYPE_FINGERPRINT &&
-            monitor.session_->GetPid() == WIN_MGR->GetPidByDisplayIdAndWindowId(displayId,
-                WIN_MGR->GetFocusWindowId())) {
-            fingerFocusPidSet.insert(monitor.session_->GetPid());
+#ifdef OHOS_BUILD_ENABLE_FINGERPRINT
+    if (routeMask == HANDLE_EVENT_TYPE_FINGERPRINT &&
+        pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_FINGERPRINT_SLIDE) {
+        int32_t focusPid = WIN_MGR->GetPidByDisplayIdAndWindowId(pointerEvent->GetTargetDisplayId(),
+            WIN_MGR->GetFocusWindowId());
+        for (uint32_t index : routes_.types[GetRouteBit(HANDLE_EVENT_TYPE_FINGERPRINT)]) {
+            const SessionHandler &monitor = *routes_.monitors[index];
+            if (monitor.session_ != nullptr && monitor.session_->GetPid() == focusPid) {
+                fingerFocusPidSet.insert(focusPid);
+            }
         }
     }
-    for (const auto &monitor : monitors_) {
-        IsSendToClient(monitor, pointerEvent, pkt, fingerFocusPidSet);
+#endif // OHOS_BUILD_ENABLE_FINGERPRINT
+    CollectPointerRoutes(pointerEvent, routeMask, routeCandidates_);
+    for (uint32_t index : routeCandidates_) {
+        IsSendToClient(*routes_.monitors[index], pointerEvent, pkt, fingerFocusPidSet);
         PointerEvent::PointerItem pointerItem1;
         pointerEvent->GetPointerItem(pointerId, pointerItem1);
         int32_t displayX1 = pointerItem1.GetDisplayX();
@@ -676,8 +703,100 @@ void EventMonitorHandler::MonitorCollection::Monitor(std::shared_ptr<PointerEven
         }
     }
 }
+
+HandleEventType EventMonitorHandler::MonitorCollection::GetRouteMask(std::shared_ptr<PointerEvent> pointerEvent)
+{
+    CHKPR(pointerEvent, HANDLE_EVENT_TYPE_NONE);
+    if (GestureMonitorHandler::IsTouchGestureEvent(pointerEvent->GetPointerAction())) {
+        return HANDLE_EVENT_TYPE_TOUCH_GESTURE;
+    }
+#ifdef OHOS_BUILD_ENABLE_FINGERPRINT
+    if (IsFingerprint(pointerEvent)) {
+        return HANDLE_EVENT_TYPE_FINGERPRINT;
+    }
+#endif // OHOS_BUILD_ENABLE_FINGERPRINT
+    // Every event type that CheckIfNeedSendToClient accepts for this event.
+    HandleEventType routeMask = HANDLE_EVENT_TYPE_POINTER | HANDLE_EVENT_TYPE_TOUCH_GESTURE |
+        HANDLE_EVENT_TYPE_SWIPEINWARD;
+    if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_TOUCHSCREEN) {
+        routeMask |= HANDLE_EVENT_TYPE_TOUCH;
+    } else if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
+        routeMask |= HANDLE_EVENT_TYPE_MOUSE;
+    }
+    if (IsPinch(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_PINCH;
+    }
+    if (IsThreeFingersSwipe(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_THREEFINGERSSWIP;
+    }
+    if (IsFourFingersSwipe(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_FOURFINGERSSWIP;
+    }
+    if (IsRotate(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_ROTATE;
+    }
+    if (IsThreeFingersTap(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_THREEFINGERSTAP;
+    }
+#ifdef OHOS_BUILD_ENABLE_X_KEY
+    if (IsXKey(pointerEvent)) {
+        routeMask |= HANDLE_EVENT_TYPE_X_KEY;
+    }
+#endif // OHOS_BUILD_ENABLE_X_KEY
+    return routeMask;
+}
+
+void EventMonitorHandler::MonitorCollection::CollectPointerRoutes(std::shared_ptr<PointerEvent> pointerEvent,
+    HandleEventType routeMask, std::vector<uint32_t> &candidates)
+{
+    candidates.clear();
+    CHKPV(pointerEvent);
+    for (size_t bit = 0; bit < ROUTE_TYPE_BITS; ++bit) {
+        if ((routeMask & (1U << bit)) != 0) {
+            candidates.insert(candidates.end(), routes_.types[bit].begin(), routes_.types[bit].end());
+        }
+    }
+    candidates.insert(candidates.end(), routes_.callbacks.begin(), routes_.callbacks.end());
+    auto iter = routes_.actions.find(pointerEvent->GetPointerAction());
+    if (iter != routes_.actions.end()) {
+        candidates.insert(candidates.end(), iter->second.begin(), iter->second.end());
+    }
+    // Monitors are visited in the same order as monitors_ and only once.
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+}
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
 
+void EventMonitorHandler::MonitorCollection::RefreshRoutes()
+{
+    if (!routesDirty_ && routes_.monitors.size() == monitors_.size()) {
+        return;
+    }
+    MonitorRoutes routes;
+    uint32_t index = 0;
+    for (const auto &monitor : monitors_) {
+        routes.monitors.push_back(&monitor);
+        for (size_t bit = 0; bit < ROUTE_TYPE_BITS; ++bit) {
+            if ((monitor.eventType_ & (1U << bit)) != 0) {
+                routes.types[bit].push_back(index);
+            }
+        }
+        if (monitor.callback_) {
+            routes.callbacks.push_back(index);
+        }
+        for (int32_t action : monitor.actionsType_) {
+            auto &bucket = routes.actions[action];
+            if (bucket.empty() || bucket.back() != index) {
+                bucket.push_back(index);
+            }
+        }
+        ++index;
+    }
+    routes_ = std::move(routes);
+    routesDirty_ = false;
+    ++routeRebuildCount_;
+}
+
 bool EventMonitorHandler::MonitorCollection::IsPinch(std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPF(pointerEvent);
@@ -760,8 +879,8 @@ bool EventMonitorHandler::MonitorCollection::IsFingerprint(std::shared_ptr<Point
     return false;
 }
 
-bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendFingerprintEvent(
-    SessionHandler &monitor, std::shared_ptr<PointerEvent> pointerEvent, std::unordered_set<int32_t> fingerFocusPidSet)
+bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendFingerprintEvent(const SessionHandler &monitor,
+    std::shared_ptr<PointerEvent> pointerEvent, const std::unordered_set<int32_t> &fingerFocusPidSet)
 {
     if ((monitor.eventType_ & HANDLE_EVENT_TYPE_FINGERPRINT) == HANDLE_EVENT_TYPE_FINGERPRINT) {
         if (pointerEvent->GetPointerAction() != PointerEvent::POINTER_ACTION_FINGERPRINT_SLIDE) {
@@ -797,7 +916,7 @@ bool EventMonitorHandler::MonitorCollection::IsXKey(std::shared_ptr<PointerEvent
     return false;
 }
 
-bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendXkeyEvent(SessionHandler &monitor,
+bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendXkeyEvent(const SessionHandler &monitor,
     std::shared_ptr<PointerEvent> pointerEvent)
 {
     if ((monitor.eventType_ & HANDLE_EVENT_TYPE_X_KEY) == HANDLE_EVENT_TYPE_X_KEY && IsXKey(pointerEvent)) {
@@ -807,8 +926,8 @@ bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendXkeyEvent(SessionHan
 }
 #endif // OHOS_BUILD_ENABLE_X_KEY
 
-bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendToClient(
-    SessionHandler monitor, std::shared_ptr<PointerEvent> pointerEvent, std::unordered_set<int32_t> fingerFocusPidSet)
+bool EventMonitorHandler::MonitorCollection::CheckIfNeedSendToClient(const SessionHandler &monitor,
+    std::shared_ptr<PointerEvent> pointerEvent, const std::unordered_set<int32_t> &fingerFocusPidSet)
 {
     CHKPF(pointerEvent);
 #ifdef OHOS_BUILD_ENABLE_FINGERPRINT
@@ -863,6 +982,7 @@ void EventMonitorHandler::MonitorCollection::OnSessionLost(SessionPtr session)
             cItr = monitors_.erase(cItr);
         }
     }
+    routesDirty_ = true;
     CHKPV(session);
     int32_t pid = session->GetPid();
     auto it = endScreenCaptureMonitors_.find(pid);
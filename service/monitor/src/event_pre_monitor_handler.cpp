@@ -137,14 +137,9 @@ void EventPreMonitorHandler::SessionHandler::SendToClient(
 {
     CHKPV(keyEvent);
     CHKPV(session_);
-    pkt.Clean();
-    if (InputEventDataTransformation::KeyEventToNetPacket(keyEvent, pkt) != RET_OK) {
-        MMI_HILOGE("Packet key event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
-        return;
-    }
-    int32_t fd = session_->GetFd();
-    pkt << fd << handlerId;
-    if (!session_->SendMsg(pkt)) {
+    // The event is shared by all receivers, only the trailing fd and handler id differ per session.
+    int32_t suffix[] = { session_->GetFd(), handlerId };
+    if (!session_->SendMsg(pkt, reinterpret_cast<const char *>(suffix), sizeof(suffix))) {
         MMI_HILOGE("Send message failed, errCode:%{public}d", MSG_SEND_FAIL);
     }
 }
@@ -158,6 +153,7 @@ int32_t EventPreMonitorHandler::MonitorCollection::AddMonitor(
             INVALID_MONITOR_MON);
         return RET_ERR;
     }
+    keyIndexDirty_ = true;
     for (auto &iter : sessionHandlers_) {
         if (IsEqualsKeys(keys, iter.first)) {
             iter.second.push_back(monitor);
@@ -170,7 +166,8 @@ int32_t EventPreMonitorHandler::MonitorCollection::AddMonitor(
     return RET_OK;
 }
 
-bool EventPreMonitorHandler::MonitorCollection::IsEqualsKeys(std::vector<int32_t> newKeys, std::vector<int32_t> oldKeys)
+bool EventPreMonitorHandler::MonitorCollection::IsEqualsKeys(const std::vector<int32_t> &newKeys,
+    const std::vector<int32_t> &oldKeys)
 {
     if (newKeys.size() != oldKeys.size()) {
         MMI_HILOGE("The size of preKeys is not match");
@@ -190,6 +187,7 @@ bool EventPreMonitorHandler::MonitorCollection::IsEqualsKeys(std::vector<int32_t
 
 void EventPreMonitorHandler::MonitorCollection::RemoveMonitor(SessionPtr sess, int32_t handlerId)
 {
+    keyIndexDirty_ = true;
     for (auto iter = sessionHandlers_.begin(); iter != sessionHandlers_.end();) {
         auto &sessionHandlers = iter->second;
         for (auto it = sessionHandlers.begin(); it != sessionHandlers.end();) {
@@ -213,26 +211,43 @@ bool EventPreMonitorHandler::MonitorCollection::HandleEvent(std::shared_ptr<KeyE
 {
     CHKPF(keyEvent);
     MMI_HILOGD("Handle KeyEvent");
+    UpdateKeyIndex();
+    auto iter = keyIndex_.find(keyEvent->GetKeyCode());
+    if (iter == keyIndex_.end()) {
+        return false;
+    }
     NetPacket pkt(MmiMessageId::ON_PRE_KEY_EVENT);
-    if (pkt.ChkRWError()) {
-        MMI_HILOGE("Packet write key event failed");
+    if (InputEventDataTransformation::KeyEventToNetPacket(keyEvent, pkt) != RET_OK) {
+        MMI_HILOGE("Packet key event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
         return false;
     }
-    for (auto iter = sessionHandlers_.begin(); iter != sessionHandlers_.end(); iter++) {
-        auto &sessionHandlers = iter->second;
-        for (auto it = sessionHandlers.begin(); it != sessionHandlers.end(); it++) {
-            CHKPC(*it);
-            auto keys = (*it)->keys_;
-            auto keyIter = std::find(keys.begin(), keys.end(), keyEvent->GetKeyCode());
-            if (keyIter != keys.end()) {
-                (*it)->SendToClient(keyEvent, pkt, (*it)->handlerId_);
-            }
-        }
+    for (const auto &handler : iter->second) {
+        handler->SendToClient(keyEvent, pkt, handler->handlerId_);
     }
     return false;
 }
 #endif // OHOS_BUILD_ENABLE_KEYBOARD
 
+void EventPreMonitorHandler::MonitorCollection::UpdateKeyIndex()
+{
+    if (!keyIndexDirty_) {
+        return;
+    }
+    keyIndex_.clear();
+    for (const auto &[keys, handlers] : sessionHandlers_) {
+        for (const auto &handler : handlers) {
+            CHKPC(handler);
+            std::vector<int32_t> keyCodes = handler->keys_;
+            std::sort(keyCodes.begin(), keyCodes.end());
+            keyCodes.erase(std::unique(keyCodes.begin(), keyCodes.end()), keyCodes.end());
+            for (int32_t keyCode : keyCodes) {
+                keyIndex_[keyCode].push_back(handler);
+            }
+        }
+    }
+    keyIndexDirty_ = false;
+}
+
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
 bool EventPreMonitorHandler::MonitorCollection::HandleEvent(std::shared_ptr<PointerEvent> pointerEvent)
 {
@@ -243,6 +258,7 @@ bool EventPreMonitorHandler::MonitorCollection::HandleEvent(std::shared_ptr<Poin
 void EventPreMonitorHandler::MonitorCollection::OnSessionLost(SessionPtr session)
 {
     CALL_INFO_TRACE;
+    keyIndexDirty_ = true;
     for (auto iter = sessionHandlers_.begin(); iter != sessionHandlers_.end();) {
         auto &handlers = iter->second;
         for (auto inner = handlers.begin(); inner != handlers.end();) {
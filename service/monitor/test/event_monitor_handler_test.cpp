@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <fstream>
 
 #include <gtest/gtest.h>
@@ -22,6 +23,9 @@
 #include "input_event_handler.h"
 #include "mmi_log.h"
 
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventMonitorHandlerTest"
+
 namespace OHOS {
 namespace MMI {
 namespace {
@@ -40,6 +44,49 @@ constexpr int32_t UNOBSERVED { -1 };
 constexpr int32_t ACTIVE_EVENT { 2 };
 constexpr int32_t THREE_FINGERS { 3 };
 constexpr int32_t FOUR_FINGERS { 4 };
+constexpr int32_t ROUTE_MONITOR_COUNT { 50 };
+const std::vector<HandleEventType> ROUTE_EVENT_TYPES {
+    HANDLE_EVENT_TYPE_KEY, HANDLE_EVENT_TYPE_POINTER, HANDLE_EVENT_TYPE_TOUCH, HANDLE_EVENT_TYPE_MOUSE,
+    HANDLE_EVENT_TYPE_PINCH, HANDLE_EVENT_TYPE_THREEFINGERSSWIP, HANDLE_EVENT_TYPE_FOURFINGERSSWIP,
+    HANDLE_EVENT_TYPE_ROTATE, HANDLE_EVENT_TYPE_THREEFINGERSTAP, HANDLE_EVENT_TYPE_SWIPEINWARD,
+    HANDLE_EVENT_TYPE_KEY | HANDLE_EVENT_TYPE_MOUSE, HANDLE_EVENT_TYPE_TOUCH | HANDLE_EVENT_TYPE_PINCH,
+    HANDLE_EVENT_TYPE_TOUCH_GESTURE, HANDLE_EVENT_TYPE_NONE,
+};
+
+struct RouteEvent {
+    int32_t sourceType;
+    int32_t pointerAction;
+    int32_t fingerCount;
+};
+
+const std::vector<RouteEvent> ROUTE_EVENTS {
+    { PointerEvent::SOURCE_TYPE_TOUCHSCREEN, PointerEvent::POINTER_ACTION_DOWN, 1 },
+    { PointerEvent::SOURCE_TYPE_TOUCHSCREEN, PointerEvent::POINTER_ACTION_MOVE, 1 },
+    { PointerEvent::SOURCE_TYPE_TOUCHSCREEN, PointerEvent::POINTER_ACTION_UP, 1 },
+    { PointerEvent::SOURCE_TYPE_TOUCHSCREEN, PointerEvent::TOUCH_ACTION_SWIPE_UP, THREE_FINGERS },
+    { PointerEvent::SOURCE_TYPE_TOUCHSCREEN, PointerEvent::TOUCH_ACTION_PINCH_OPENED, FOUR_FINGERS },
+    { PointerEvent::SOURCE_TYPE_MOUSE, PointerEvent::POINTER_ACTION_MOVE, 0 },
+    { PointerEvent::SOURCE_TYPE_MOUSE, PointerEvent::POINTER_ACTION_AXIS_BEGIN, 0 },
+    { PointerEvent::SOURCE_TYPE_MOUSE, PointerEvent::POINTER_ACTION_ROTATE_UPDATE, 0 },
+    { PointerEvent::SOURCE_TYPE_TOUCHPAD, PointerEvent::POINTER_ACTION_SWIPE_UPDATE, THREE_FINGERS },
+    { PointerEvent::SOURCE_TYPE_TOUCHPAD, PointerEvent::POINTER_ACTION_SWIPE_UPDATE, FOUR_FINGERS },
+    { PointerEvent::SOURCE_TYPE_TOUCHPAD, PointerEvent::POINTER_ACTION_TRIPTAP, THREE_FINGERS },
+    { PointerEvent::SOURCE_TYPE_TOUCHPAD, PointerEvent::POINTER_ACTION_AXIS_UPDATE, 2 },
+};
+
+std::shared_ptr<PointerEvent> CreateRouteEvent(const RouteEvent &routeEvent)
+{
+    auto pointerEvent = PointerEvent::Create();
+    CHKPP(pointerEvent);
+    pointerEvent->SetSourceType(routeEvent.sourceType);
+    pointerEvent->SetPointerAction(routeEvent.pointerAction);
+    pointerEvent->SetFingerCount(routeEvent.fingerCount);
+    pointerEvent->SetPointerId(0);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    pointerEvent->AddPointerItem(item);
+    return pointerEvent;
+}
 } // namespace
 
 class EventMonitorHandlerTest : public testing::Test {
@@ -1795,5 +1842,140 @@ HWTEST_F(EventMonitorHandlerTest, EventMonitorHandlerTest_ProcessScreenCapture_0
     eventMonitorHandler.ProcessScreenCapture(pid, isStart);
 }
 #endif // PLAYER_FRAMEWORK_EXISTS
+
+static void AddRouteMonitors(EventMonitorHandler::MonitorCollection &monitorCollection)
+{
+    for (int32_t i = 0; i < ROUTE_MONITOR_COUNT; ++i) {
+        SessionPtr session = std::make_shared<UDSSession>(PROGRAM_NAME, g_moduleType, g_writeFd, UID_ROOT, g_pid);
+        HandleEventType eventType = ROUTE_EVENT_TYPES[i % ROUTE_EVENT_TYPES.size()];
+        if (eventType == HANDLE_EVENT_TYPE_NONE) {
+            std::vector<int32_t> actionsType { PointerEvent::POINTER_ACTION_DOWN, PointerEvent::POINTER_ACTION_UP };
+            monitorCollection.monitors_.emplace(InputHandlerType::MONITOR, eventType, session, actionsType);
+        } else {
+            monitorCollection.monitors_.emplace(InputHandlerType::MONITOR, eventType, session,
+                TOUCH_GESTURE_TYPE_ALL, THREE_FINGERS);
+        }
+    }
+    std::shared_ptr<IInputEventHandler::IInputEventConsumer> callback = std::make_shared<MyInputEventConsumer>();
+    SessionPtr noSession = nullptr;
+    monitorCollection.monitors_.emplace(InputHandlerType::MONITOR, HANDLE_EVENT_TYPE_KEY, noSession,
+        std::vector<int32_t>(), callback);
+}
+
+/**
+ * @tc.name: EventMonitorHandlerTest_RouteIndex_001
+ * @tc.desc: Verify the route index reaches every monitor the full monitor walk would deliver the event to
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventMonitorHandlerTest, EventMonitorHandlerTest_RouteIndex_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventMonitorHandler::MonitorCollection monitorCollection;
+    AddRouteMonitors(monitorCollection);
+    std::unordered_set<int32_t> fingerFocusPidSet;
+    auto isDelivered = [&](const EventMonitorHandler::SessionHandler &monitor,
+        std::shared_ptr<PointerEvent> pointerEvent) {
+        if (monitor.Expect(pointerEvent) && ((monitor.session_ != nullptr &&
+            monitorCollection.CheckIfNeedSendToClient(monitor, pointerEvent, fingerFocusPidSet)) ||
+            monitor.callback_ != nullptr)) {
+            return true;
+        }
+        return monitor.session_ != nullptr && std::find(monitor.actionsType_.begin(), monitor.actionsType_.end(),
+            pointerEvent->GetPointerAction()) != monitor.actionsType_.end();
+    };
+    auto checkRoutes = [&]() {
+        size_t visited = 0;
+        for (const auto &routeEvent : ROUTE_EVENTS) {
+            auto pointerEvent = CreateRouteEvent(routeEvent);
+            ASSERT_NE(pointerEvent, nullptr);
+            monitorCollection.RefreshRoutes();
+            std::vector<uint32_t> candidates;
+            monitorCollection.CollectPointerRoutes(pointerEvent, monitorCollection.GetRouteMask(pointerEvent),
+                candidates);
+            std::set<const EventMonitorHandler::SessionHandler *> routed;
+            for (uint32_t index : candidates) {
+                ASSERT_LT(index, monitorCollection.monitors_.size());
+                routed.insert(monitorCollection.routes_.monitors[index]);
+            }
+            for (const auto &monitor : monitorCollection.monitors_) {
+                if (isDelivered(monitor, pointerEvent)) {
+                    EXPECT_TRUE(routed.count(&monitor) != 0) << "source:" << routeEvent.sourceType <<
+                        " action:" << routeEvent.pointerAction << " eventType:" << monitor.eventType_;
+                }
+            }
+            visited += candidates.size();
+        }
+        EXPECT_LT(visited, monitorCollection.monitors_.size() * ROUTE_EVENTS.size());
+    };
+    checkRoutes();
+
+    auto iter = monitorCollection.monitors_.begin();
+    std::advance(iter, ROUTE_MONITOR_COUNT / 2);
+    SessionPtr lostSession = iter->session_;
+    monitorCollection.OnSessionLost(lostSession);
+    EventMonitorHandler::SessionHandler removed = *monitorCollection.monitors_.begin();
+    removed.eventType_ = HANDLE_EVENT_TYPE_NONE;
+    monitorCollection.RemoveMonitor(removed);
+    checkRoutes();
+    for (const auto *monitor : monitorCollection.routes_.monitors) {
+        EXPECT_NE(monitor->session_, lostSession);
+    }
+}
+
+/**
+ * @tc.name: EventMonitorHandlerTest_RouteIndex_002
+ * @tc.desc: Verify the route buckets hold exactly the subscribed monitors and are rebuilt only after a change
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventMonitorHandlerTest, EventMonitorHandlerTest_RouteIndex_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventMonitorHandler::MonitorCollection monitorCollection;
+    AddRouteMonitors(monitorCollection);
+    monitorCollection.RefreshRoutes();
+    EXPECT_EQ(monitorCollection.routeRebuildCount_, 1U);
+    const auto &routes = monitorCollection.routes_;
+    ASSERT_EQ(routes.monitors.size(), monitorCollection.monitors_.size());
+    uint32_t index = 0;
+    for (const auto &monitor : monitorCollection.monitors_) {
+        EXPECT_EQ(routes.monitors[index], &monitor);
+        for (size_t bit = 0; bit < EventMonitorHandler::MonitorCollection::ROUTE_TYPE_BITS; ++bit) {
+            bool subscribed = (monitor.eventType_ & (1U << bit)) != 0;
+            const auto &bucket = routes.types[bit];
+            EXPECT_EQ(std::find(bucket.begin(), bucket.end(), index) != bucket.end(), subscribed);
+        }
+        bool hasCallback = (monitor.callback_ != nullptr);
+        EXPECT_EQ(std::find(routes.callbacks.begin(), routes.callbacks.end(), index) != routes.callbacks.end(),
+            hasCallback);
+        for (int32_t action : monitor.actionsType_) {
+            auto iter = routes.actions.find(action);
+            ASSERT_NE(iter, routes.actions.end());
+            EXPECT_EQ(std::count(iter->second.begin(), iter->second.end(), index), 1);
+        }
+        ++index;
+    }
+
+    std::vector<uint32_t> candidates;
+    for (const auto &routeEvent : ROUTE_EVENTS) {
+        auto pointerEvent = CreateRouteEvent(routeEvent);
+        ASSERT_NE(pointerEvent, nullptr);
+        monitorCollection.RefreshRoutes();
+        monitorCollection.CollectPointerRoutes(pointerEvent, monitorCollection.GetRouteMask(pointerEvent),
+            candidates);
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+        EXPECT_EQ(std::adjacent_find(candidates.begin(), candidates.end()), candidates.end());
+    }
+    EXPECT_EQ(monitorCollection.routeRebuildCount_, 1U);
+
+    EventMonitorHandler::SessionHandler removed = *monitorCollection.monitors_.begin();
+    removed.eventType_ = HANDLE_EVENT_TYPE_NONE;
+    monitorCollection.RemoveMonitor(removed);
+    monitorCollection.RefreshRoutes();
+    monitorCollection.RefreshRoutes();
+    EXPECT_EQ(monitorCollection.routeRebuildCount_, 2U);
+    EXPECT_EQ(monitorCollection.routes_.monitors.size(), monitorCollection.monitors_.size());
+}
 } // namespace MMI
 } // namespace OHOS
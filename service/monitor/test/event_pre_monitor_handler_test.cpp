@@ -653,5 +653,88 @@ HWTEST_F(EventPreMonitorHandlerTest, EventPreMonitorHandlerTest_HandleEvent_002,
     ASSERT_FALSE(ret);
 }
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
+
+/**
+ * @tc.name: EventPreMonitorHandlerTest_UpdateKeyIndex_001
+ * @tc.desc: Verify overlapping key registrations are indexed once per handler and key code
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventPreMonitorHandlerTest, EventPreMonitorHandlerTest_UpdateKeyIndex_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventPreMonitorHandler::MonitorCollection monitorCollection;
+    HandleEventType eventType = HANDLE_EVENT_TYPE_PRE_KEY;
+    SessionPtr session1 = std::make_shared<UDSSession>(PROGRAM_NAME, g_moduleType, g_writeFd, UID_ROOT, g_pid);
+    SessionPtr session2 = std::make_shared<UDSSession>(PROGRAM_NAME, g_moduleType, g_writeFd, UID_ROOT, g_pid);
+    std::vector<int32_t> keys1 = {1, 2, 3};
+    std::vector<int32_t> keys2 = {2, 4, 4};
+    std::vector<int32_t> keys3 = {3, 2, 1};
+    auto handler1 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session1, 1, eventType, keys1);
+    auto handler2 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session2, 2, eventType, keys2);
+    auto handler3 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session2, 3, eventType, keys3);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler1, keys1), RET_OK);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler2, keys2), RET_OK);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler3, keys3), RET_OK);
+    EXPECT_EQ(monitorCollection.sessionHandlers_.size(), 2);
+
+    monitorCollection.UpdateKeyIndex();
+    EXPECT_EQ(monitorCollection.keyIndex_[1].size(), 2);
+    EXPECT_EQ(monitorCollection.keyIndex_[2].size(), 3);
+    EXPECT_EQ(monitorCollection.keyIndex_[3].size(), 2);
+    ASSERT_EQ(monitorCollection.keyIndex_[4].size(), 1);
+    EXPECT_EQ(monitorCollection.keyIndex_[4].front(), handler2);
+    EXPECT_EQ(monitorCollection.keyIndex_.count(5), 0);
+
+#ifdef OHOS_BUILD_ENABLE_KEYBOARD
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(2);
+    EXPECT_FALSE(monitorCollection.HandleEvent(keyEvent));
+    keyEvent->SetKeyCode(5);
+    EXPECT_FALSE(monitorCollection.HandleEvent(keyEvent));
+#endif // OHOS_BUILD_ENABLE_KEYBOARD
+}
+
+/**
+ * @tc.name: EventPreMonitorHandlerTest_UpdateKeyIndex_002
+ * @tc.desc: Verify removed handlers and lost sessions leave the key index
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventPreMonitorHandlerTest, EventPreMonitorHandlerTest_UpdateKeyIndex_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EventPreMonitorHandler::MonitorCollection monitorCollection;
+    HandleEventType eventType = HANDLE_EVENT_TYPE_PRE_KEY;
+    SessionPtr session1 = std::make_shared<UDSSession>(PROGRAM_NAME, g_moduleType, g_writeFd, UID_ROOT, g_pid);
+    SessionPtr session2 = std::make_shared<UDSSession>(PROGRAM_NAME, g_moduleType, g_writeFd, UID_ROOT, g_pid);
+    std::vector<int32_t> keys1 = {1, 2};
+    std::vector<int32_t> keys2 = {2, 3};
+    auto handler1 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session1, 1, eventType, keys1);
+    auto handler2 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session2, 2, eventType, keys2);
+    auto handler3 = std::make_shared<EventPreMonitorHandler::SessionHandler>(session2, 3, eventType, keys1);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler1, keys1), RET_OK);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler2, keys2), RET_OK);
+    EXPECT_EQ(monitorCollection.AddMonitor(handler3, keys1), RET_OK);
+    monitorCollection.UpdateKeyIndex();
+    EXPECT_EQ(monitorCollection.keyIndex_[2].size(), 3);
+
+    monitorCollection.OnSessionLost(session1);
+    monitorCollection.UpdateKeyIndex();
+    ASSERT_EQ(monitorCollection.keyIndex_[1].size(), 1);
+    EXPECT_EQ(monitorCollection.keyIndex_[1].front(), handler3);
+    EXPECT_EQ(monitorCollection.keyIndex_[2].size(), 2);
+
+    monitorCollection.RemoveMonitor(session2, 2);
+    monitorCollection.UpdateKeyIndex();
+    EXPECT_EQ(monitorCollection.keyIndex_.count(3), 0);
+    EXPECT_EQ(monitorCollection.keyIndex_[2].size(), 1);
+
+    monitorCollection.RemoveMonitor(session2, 3);
+    monitorCollection.UpdateKeyIndex();
+    EXPECT_TRUE(monitorCollection.keyIndex_.empty());
+    EXPECT_TRUE(monitorCollection.sessionHandlers_.empty());
+}
 } // namespace MMI
 } // namespace OHOS
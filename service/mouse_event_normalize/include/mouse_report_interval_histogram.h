@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOUSE_REPORT_INTERVAL_HISTOGRAM_H
+#define MOUSE_REPORT_INTERVAL_HISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+
+namespace OHOS {
+namespace MMI {
+/**
+ * Histogram of the interval between consecutive reports of one mouse. Intervals below FINE_LIMIT_MS get a bucket
+ * per millisecond, intervals below STEP_LIMIT_MS a bucket per STEP_MS, and everything above shares the last
+ * bucket. Gaps of IDLE_GAP_MS or more separate two movements and are not counted.
+ */
+class MouseReportIntervalHistogram final {
+public:
+    static constexpr int64_t FINE_LIMIT_MS { 20 };
+    static constexpr int64_t STEP_LIMIT_MS { 40 };
+    static constexpr int64_t STEP_MS { 5 };
+    static constexpr int64_t IDLE_GAP_MS { 5000 };
+    static constexpr size_t BUCKET_COUNT { FINE_LIMIT_MS + (STEP_LIMIT_MS - FINE_LIMIT_MS) / STEP_MS + 1 };
+
+    static constexpr size_t GetBucket(int64_t intervalMs)
+    {
+        if (intervalMs < FINE_LIMIT_MS) {
+            return static_cast<size_t>(intervalMs);
+        }
+        if (intervalMs < STEP_LIMIT_MS) {
+            return static_cast<size_t>(FINE_LIMIT_MS + (intervalMs - FINE_LIMIT_MS) / STEP_MS);
+        }
+        return BUCKET_COUNT - 1;
+    }
+
+    // Counts the interval since the previous report, returns false if there was nothing to count.
+    bool Record(int64_t timeUs)
+    {
+        int64_t lastTimeUs = lastTimeUs_;
+        lastTimeUs_ = timeUs;
+        if (lastTimeUs < 0) {
+            return false;
+        }
+        int64_t intervalMs = (timeUs - lastTimeUs) / US_PER_MS;
+        if ((intervalMs < 0) || (intervalMs >= IDLE_GAP_MS)) {
+            return false;
+        }
+        ++counts_[GetBucket(intervalMs)];
+        ++total_;
+        return true;
+    }
+
+    void Clear()
+    {
+        counts_.fill(0);
+        total_ = 0;
+    }
+
+    uint32_t GetCount(size_t bucket) const
+    {
+        return (bucket < BUCKET_COUNT ? counts_[bucket] : 0);
+    }
+
+    uint32_t GetTotal() const
+    {
+        return total_;
+    }
+
+private:
+    static constexpr int64_t US_PER_MS { 1000 };
+
+    std::array<uint32_t, BUCKET_COUNT> counts_ {};
+    uint32_t total_ { 0 };
+    int64_t lastTimeUs_ { -1 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // MOUSE_REPORT_INTERVAL_HISTOGRAM_H
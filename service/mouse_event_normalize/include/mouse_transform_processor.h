@@ -19,6 +19,7 @@
 #include "aggregator.h"
 #include "device_type_definition.h"
 #include "libinput.h"
+#include "mouse_report_interval_histogram.h"
 #include "timer_manager.h"
 #include "pointer_event.h"
 #include "touchpad_control_display_gain.h"
@@ -36,12 +37,14 @@ extern "C" {
     int32_t HandleMotionAccelerateMouse(const Offset* offset, bool mode, double* abs_x, double* abs_y,
         int32_t speed, int32_t deviceType);
     int32_t HandleMotionAccelerateTouchpad(const Offset* offset, bool mode, double* abs_x, double* abs_y,
-        int32_t speed, int32_t deviceType);
+        int32_t speed, int32_t deviceType, int32_t deviceId);
     int32_t HandleAxisAccelerateTouchpad(bool mode, double* abs_axis, int32_t deviceType);
     int32_t HandleMotionDynamicAccelerateMouse(const Offset* offset, bool mode, double* abs_x, double* abs_y,
         int32_t speed, uint64_t delta_time, double display_ppi, double factor);
     int32_t HandleMotionDynamicAccelerateTouchpad(const Offset* offset, bool mode, double* abs_x, double* abs_y,
-        int32_t speed, double display_size, double touchpad_size, double touchpad_ppi, int32_t frequency);
+        int32_t speed, double display_size, double touchpad_size, double touchpad_ppi, int32_t frequency,
+        int32_t deviceId);
+    void RemoveAccelerateCarry(int32_t deviceId);
 }
 
 namespace MMI {
@@ -128,10 +131,11 @@ private:
     void CalculateOffset(const OLD::DisplayInfo* displayInfo, Offset &offset);
     bool IsWindowRotation(const OLD::DisplayInfo* displayInfo);
     Direction GetDisplayDirection(const OLD::DisplayInfo *displayInfo);
-    void HandleReportMouseResponseTime(std::string &connectType, std::map<long long, int32_t> &curMap);
+    void HandleReportMouseResponseTime();
     void CalculateMouseResponseTimeProbability(struct libinput_event *event);
-    std::map<std::string, std::map<long long, int32_t>> mouseResponseMap = {};
-    std::map<std::string, std::chrono::time_point<std::chrono::steady_clock>> mouseMap = {};
+    void RecordReportInterval(int64_t timeUs);
+    void OnReportTimer();
+    void StopReportTimer();
 #ifdef OHOS_BUILD_ENABLE_POINTER_DRAWING
     void HandleMotionMoveMouse(int32_t offsetX, int32_t offsetY);
     void HandlePostMoveMouse(PointerEvent::PointerItem &pointerItem);
@@ -184,6 +188,9 @@ private:
     static int32_t scrollSwitchPid_;
     std::shared_ptr<PointerEvent> pointerEvent_ { nullptr };
     int32_t timerId_ { -1 };
+    int32_t reportTimerId_ { -1 };
+    int32_t busType_ { -1 };
+    MouseReportIntervalHistogram reportIntervals_;
     int32_t buttonId_ { -1 };
     uint32_t pressedButton_ { 0 };
     bool isPressed_ { false };
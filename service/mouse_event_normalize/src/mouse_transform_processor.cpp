@@ -69,10 +69,8 @@ constexpr int32_t FOLDABLE_DEVICE { 2 };
 constexpr int32_t WAIT_TIME_FOR_BUTTON_UP { 35 };
 constexpr int32_t ANGLE_90 { 90 };
 constexpr int32_t ANGLE_360 { 360 };
-constexpr int32_t FINE_CALCULATE { 20 };
-constexpr int32_t STEP_CALCULATE { 40 };
-constexpr int32_t STOP_CALCULATE { 5000 };
-constexpr int32_t CALCULATE_STEP { 5 };
+constexpr int32_t REPORT_RESPONSE_TIME_INTERVAL_MS { 30000 };
+constexpr long RESPONSE_TIME_PER_MILLE { 1000 };
 constexpr float MM_TO_INCH { 25.4f };
 constexpr int32_t SCREEN_DIAGONAL_0 { 0 };
 constexpr int32_t SCREEN_DIAGONAL_8 { 8 };
@@ -110,6 +108,7 @@ MouseTransformProcessor::~MouseTransformProcessor()
     if (TimerMgr->IsExist(timerId_)) {
         TimerMgr->RemoveTimer(timerId_);
     }
+    StopReportTimer();
 }
 
 std::shared_ptr<PointerEvent> MouseTransformProcessor::GetPointerEvent() const
@@ -285,13 +284,13 @@ int32_t MouseTransformProcessor::UpdateTouchpadMoveLocation(const OLD::DisplayIn
         MMI_HILOGW("displayinfo get failed, use default acclerate. width:%{public}d height:%{public}d",
             displayInfo->width, displayInfo->height);
         ret = HandleMotionAccelerateTouchpad(&offset, WIN_MGR->GetMouseIsCaptureMode(),
-            &abs_x, &abs_y, GetTouchpadSpeed(), deviceType);
+            &abs_x, &abs_y, GetTouchpadSpeed(), deviceType, deviceId_);
         return ret;
     } else if (PRODUCT_TYPE == DEVICE_TYPE_FOLD_PC && devName == "input_mt_wrapper") {
         deviceType = static_cast<int32_t>(DeviceType::DEVICE_FOLD_PC_VIRT);
         pointerEvent_->AddFlag(InputEvent::EVENT_FLAG_VIRTUAL_TOUCHPAD_POINTER);
         ret = HandleMotionAccelerateTouchpad(&offset, WIN_MGR->GetMouseIsCaptureMode(),
-            &abs_x, &abs_y, GetTouchpadSpeed(), deviceType);
+            &abs_x, &abs_y, GetTouchpadSpeed(), deviceType, deviceId_);
         return ret;
     } else {
         pointerEvent_->AddFlag(InputEvent::EVENT_FLAG_TOUCHPAD_POINTER);
@@ -317,7 +316,7 @@ int32_t MouseTransformProcessor::UpdateTouchpadMoveLocation(const OLD::DisplayIn
         }
         UpdateTouchpadCDG(touchpadPPi, touchpadSize, frequency);
         ret = HandleMotionDynamicAccelerateTouchpad(&offset, WIN_MGR->GetMouseIsCaptureMode(),
-            &abs_x, &abs_y, GetTouchpadSpeed(), displaySize, touchpadSize, touchpadPPi, frequency);
+            &abs_x, &abs_y, GetTouchpadSpeed(), displaySize, touchpadSize, touchpadPPi, frequency, deviceId_);
         return ret;
     }
 }
@@ -325,92 +324,91 @@ int32_t MouseTransformProcessor::UpdateTouchpadMoveLocation(const OLD::DisplayIn
 void MouseTransformProcessor::CalculateMouseResponseTimeProbability(struct libinput_event *event)
 {
     CHKPV(event);
-    struct libinput_device *dev = libinput_event_get_device(event);
-    CHKPV(dev);
-    const std::string mouseName = libinput_device_get_name(dev);
-    const int32_t devType = static_cast<int32_t>(libinput_device_get_id_bustype(dev));
-    MMI_HILOGI("mouseName:%{public}s, devType:%{public}d", mouseName.c_str(), devType);
-    if (devType != BUS_USB && devType != BUS_BLUETOOTH) {
+    if (busType_ < 0) {
+        struct libinput_device *dev = libinput_event_get_device(event);
+        CHKPV(dev);
+        busType_ = static_cast<int32_t>(libinput_device_get_id_bustype(dev));
+    }
+    if (busType_ != BUS_USB && busType_ != BUS_BLUETOOTH) {
         return;
     }
-    std::string connectType = devType == BUS_USB ? "USB" : "BLUETOOTH";
-    auto curMouseTimeMap = mouseMap.find(mouseName);
-    if (curMouseTimeMap == mouseMap.end()) {
-        mouseMap[mouseName] = std::chrono::steady_clock::now();
-        mouseResponseMap[mouseName] = {};
-    } else {
-        std::chrono::time_point<std::chrono::steady_clock> curTime = std::chrono::steady_clock::now();
-        long long gap =
-            std::chrono::duration_cast<std::chrono::milliseconds>(curTime - curMouseTimeMap->second).count();
-        mouseMap[mouseName] = curTime;
-        std::map<long long, int32_t> &curMap = mouseResponseMap.find(mouseName)->second;
-
-        if (gap < FINE_CALCULATE) {
-            auto curMapIt = curMap.try_emplace(gap, 1);
-            if (!curMapIt.second) {
-                curMapIt.first->second += 1;
-            }
-        } else if (gap >= FINE_CALCULATE && gap < STEP_CALCULATE) {
-            long long tempNum = gap - gap % CALCULATE_STEP;
-            auto curMapIt = curMap.try_emplace(tempNum, 1);
-            if (!curMapIt.second) {
-                curMapIt.first->second += 1;
-            }
-        } else if (gap >= STEP_CALCULATE && gap < STOP_CALCULATE) {
-            auto curMapIt = curMap.try_emplace(STEP_CALCULATE, 1);
-            if (!curMapIt.second) {
-                curMapIt.first->second += 1;
-            }
-        } else if (gap > STOP_CALCULATE) {
-            HandleReportMouseResponseTime(connectType, curMap);
-            mouseResponseMap.erase(mouseName);
-            mouseMap.erase(mouseName);
-        }
+    RecordReportInterval(GetSysClockTime());
+}
+
+void MouseTransformProcessor::RecordReportInterval(int64_t timeUs)
+{
+    if (!reportIntervals_.Record(timeUs) || (reportTimerId_ >= 0)) {
+        return;
+    }
+    std::weak_ptr<MouseTransformProcessor> weakProcessor = weak_from_this();
+    reportTimerId_ = TimerMgr->AddLongTimer(REPORT_RESPONSE_TIME_INTERVAL_MS, 1, [weakProcessor]() {
+        auto processor = weakProcessor.lock();
+        CHKPV(processor);
+        processor->OnReportTimer();
+    }, "MouseResponseTimeReport");
+    if (reportTimerId_ < 0) {
+        MMI_HILOGE("Add timer for reporting mouse response time failed");
     }
 }
 
-void MouseTransformProcessor::HandleReportMouseResponseTime(
-    std::string &connectType, std::map<long long, int32_t> &curMap)
+void MouseTransformProcessor::OnReportTimer()
 {
-    long total = 0;
-    for (const auto &[key, value] : curMap) {
-        total += value;
+    reportTimerId_ = -1;
+    HandleReportMouseResponseTime();
+}
+
+void MouseTransformProcessor::StopReportTimer()
+{
+    if (reportTimerId_ >= 0) {
+        TimerMgr->RemoveTimer(reportTimerId_);
+        reportTimerId_ = -1;
     }
+}
+
+void MouseTransformProcessor::HandleReportMouseResponseTime()
+{
+    long total = static_cast<long>(reportIntervals_.GetTotal());
     if (total <= 0) {
         MMI_HILOGD("mouse not move");
         return;
     }
+    auto ratio = [this, total](int64_t intervalMs) -> long {
+        return static_cast<long>(reportIntervals_.GetCount(MouseReportIntervalHistogram::GetBucket(intervalMs))) *
+            RESPONSE_TIME_PER_MILLE / total;
+    };
+    std::string connectType = (busType_ == BUS_USB ? "USB" : "BLUETOOTH");
     int32_t ret = HiSysEventWrite(
         OHOS::HiviewDFX::HiSysEvent::Domain::MULTI_MODAL_INPUT,
         "COLLECT_MOUSE_RESPONSE_TIME",
         OHOS::HiviewDFX::HiSysEvent::EventType::STATISTIC,
         "MOUSE_CONNECT_TYPE", connectType,
         "MOVING_TOTAL", total,
-        "1ms", curMap.find(1)->second / total,
-        "2ms", curMap.find(2)->second / total,
-        "3ms", curMap.find(3)->second / total,
-        "4ms", curMap.find(4)->second / total,
-        "5ms", curMap.find(5)->second / total,
-        "6ms", curMap.find(6)->second / total,
-        "7ms", curMap.find(7)->second / total,
-        "8ms", curMap.find(8)->second / total,
-        "9ms", curMap.find(9)->second / total,
-        "10ms", curMap.find(10)->second / total,
-        "11ms", curMap.find(11)->second / total,
-        "12ms", curMap.find(12)->second / total,
-        "13ms", curMap.find(13)->second / total,
-        "14ms", curMap.find(14)->second / total,
-        "15ms", curMap.find(15)->second / total,
-        "16ms", curMap.find(16)->second / total,
-        "17ms", curMap.find(17)->second / total,
-        "18ms", curMap.find(18)->second / total,
-        "19ms", curMap.find(19)->second / total,
-        "20ms", curMap.find(FINE_CALCULATE)->second / total,
-        "25ms", curMap.find(25)->second / total,
-        "30ms", curMap.find(30)->second / total,
-        "35ms", curMap.find(35)->second / total,
-        "40ms", curMap.find(STEP_CALCULATE)->second / total,
-        "MSG", "collectiong mouse response time probability");
+        "1ms", ratio(1),
+        "2ms", ratio(2),
+        "3ms", ratio(3),
+        "4ms", ratio(4),
+        "5ms", ratio(5),
+        "6ms", ratio(6),
+        "7ms", ratio(7),
+        "8ms", ratio(8),
+        "9ms", ratio(9),
+        "10ms", ratio(10),
+        "11ms", ratio(11),
+        "12ms", ratio(12),
+        "13ms", ratio(13),
+        "14ms", ratio(14),
+        "15ms", ratio(15),
+        "16ms", ratio(16),
+        "17ms", ratio(17),
+        "18ms", ratio(18),
+        "19ms", ratio(19),
+        "20ms", ratio(MouseReportIntervalHistogram::FINE_LIMIT_MS),
+        "25ms", ratio(25),
+        "30ms", ratio(30),
+        "35ms", ratio(35),
+        "40ms", ratio(MouseReportIntervalHistogram::STEP_LIMIT_MS),
+        "MSG", "collectiong mouse response time probability in per mille");
+    reportIntervals_.Clear();
     if (ret != RET_OK) {
         MMI_HILOGE("Mouse write failed , ret:%{public}d", ret);
     }
@@ -1609,7 +1607,11 @@ int32_t MouseTransformProcessor::SetMouseAccelerateMotionSwitch(bool enable)
 }
 
 void MouseTransformProcessor::OnDeviceRemoved()
-{}
+{
+    StopReportTimer();
+    HandleReportMouseResponseTime();
+    RemoveAccelerateCarry(deviceId_);
+}
 
 #ifdef OHOS_BUILD_MOUSE_REPORTING_RATE
 void MouseTransformProcessor::HandleFilterMouseEvent(Offset* offset)
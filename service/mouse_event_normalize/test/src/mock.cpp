@@ -25,7 +25,7 @@ int32_t HandleMotionAccelerateMouse(const Offset* offset, bool mode, double* abs
 }
  
 int32_t HandleMotionAccelerateTouchpad(const Offset* offset, bool mode, double* abs_x, double* abs_y,
-    int32_t speed, int32_t deviceType)
+    int32_t speed, int32_t deviceType, int32_t deviceId)
 {
     return 0;
 }
@@ -42,9 +42,14 @@ int32_t HandleMotionDynamicAccelerateMouse(const Offset* offset, bool mode, doub
 }
  
 int32_t HandleMotionDynamicAccelerateTouchpad(const Offset* offset, bool mode, double* abs_x, double* abs_y,
-    int32_t speed, double display_size, double touchpad_size, double touchpad_ppi, int32_t frequency)
+    int32_t speed, double display_size, double touchpad_size, double touchpad_ppi, int32_t frequency,
+    int32_t deviceId)
 {
     return 0;
 }
+ 
+void RemoveAccelerateCarry(int32_t deviceId)
+{
+}
 }
 } // namespace OHOS
\ No newline at end of file
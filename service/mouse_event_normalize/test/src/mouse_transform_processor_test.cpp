@@ -26,6 +26,7 @@
 #include "input_windows_manager.h"
 #include "i_input_windows_manager.h"
 #include "libinput_wrapper.h"
+#include "linux/input.h"
 #include "multimodal_input_preferences_manager.h"
 
 namespace OHOS {
@@ -36,6 +37,8 @@ using namespace testing;
 constexpr int32_t BTN_RIGHT_MENUE_CODE = 0x118;
 constexpr int32_t HARD_PC_PRO_DEVICE_WIDTH = 2880;
 constexpr int32_t HARD_PC_PRO_DEVICE_HEIGHT = 1920;
+constexpr int64_t US_PER_MS = 1000;
+constexpr int64_t REPORT_INTERVAL_US = 8 * US_PER_MS;
 }
 class MockPreferenceManager : public MultiModalInputPreferencesManager {
 public:
@@ -1659,5 +1662,87 @@ HWTEST_F(MouseTransformProcessorTest, MouseTransformProcessorTest_HandleTouchpad
     processor.HandleTouchpadRightButton(data, evenType, button);
     ASSERT_EQ (button, 0);
 }
+
+/**
+ * @tc.name: MouseTransformProcessorTest_MouseReportIntervalHistogram_001
+ * @tc.desc: Test the bucket boundaries of the mouse report interval histogram
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseTransformProcessorTest, MouseTransformProcessorTest_MouseReportIntervalHistogram_001, TestSize.Level1)
+{
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(0), 0);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(19), 19);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(20), 20);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(24), 20);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(25), 21);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(39), 23);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(40), MouseReportIntervalHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(MouseReportIntervalHistogram::GetBucket(4999), MouseReportIntervalHistogram::BUCKET_COUNT - 1);
+
+    MouseReportIntervalHistogram histogram;
+    EXPECT_FALSE(histogram.Record(0));
+    EXPECT_TRUE(histogram.Record(REPORT_INTERVAL_US));
+    EXPECT_TRUE(histogram.Record(REPORT_INTERVAL_US + REPORT_INTERVAL_US - 1));
+    EXPECT_FALSE(histogram.Record(REPORT_INTERVAL_US * 2 + MouseReportIntervalHistogram::IDLE_GAP_MS * US_PER_MS));
+    EXPECT_FALSE(histogram.Record(0));
+    EXPECT_EQ(histogram.GetCount(8), 1);
+    EXPECT_EQ(histogram.GetCount(7), 1);
+    EXPECT_EQ(histogram.GetCount(MouseReportIntervalHistogram::BUCKET_COUNT), 0);
+    EXPECT_EQ(histogram.GetTotal(), 2);
+    histogram.Clear();
+    EXPECT_EQ(histogram.GetTotal(), 0);
+    EXPECT_EQ(histogram.GetCount(8), 0);
+}
+
+/**
+ * @tc.name: MouseTransformProcessorTest_RecordReportInterval_001
+ * @tc.desc: Test that report intervals are reported once per timer period
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseTransformProcessorTest, MouseTransformProcessorTest_RecordReportInterval_001, TestSize.Level1)
+{
+    auto processor = std::make_shared<MouseTransformProcessor>(1);
+    processor->busType_ = BUS_USB;
+    processor->RecordReportInterval(0);
+    EXPECT_EQ(processor->reportTimerId_, -1);
+    processor->RecordReportInterval(REPORT_INTERVAL_US);
+    int32_t timerId = processor->reportTimerId_;
+    ASSERT_GE(timerId, 0);
+    EXPECT_TRUE(TimerMgr->IsExist(timerId));
+    processor->RecordReportInterval(REPORT_INTERVAL_US * 2);
+    EXPECT_EQ(processor->reportTimerId_, timerId);
+    EXPECT_EQ(processor->reportIntervals_.GetTotal(), 2);
+
+    TimerMgr->RemoveTimer(timerId);
+    processor->OnReportTimer();
+    EXPECT_EQ(processor->reportTimerId_, -1);
+    EXPECT_EQ(processor->reportIntervals_.GetTotal(), 0);
+    processor->RecordReportInterval(REPORT_INTERVAL_US * 3);
+    EXPECT_GE(processor->reportTimerId_, 0);
+    EXPECT_EQ(processor->reportIntervals_.GetTotal(), 1);
+    processor->StopReportTimer();
+}
+
+/**
+ * @tc.name: MouseTransformProcessorTest_OnDeviceRemoved_001
+ * @tc.desc: Test that removing the device flushes the histogram and stops the report timer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MouseTransformProcessorTest, MouseTransformProcessorTest_OnDeviceRemoved_001, TestSize.Level1)
+{
+    auto processor = std::make_shared<MouseTransformProcessor>(1);
+    processor->busType_ = BUS_BLUETOOTH;
+    processor->RecordReportInterval(0);
+    processor->RecordReportInterval(REPORT_INTERVAL_US);
+    int32_t timerId = processor->reportTimerId_;
+    ASSERT_GE(timerId, 0);
+    processor->OnDeviceRemoved();
+    EXPECT_FALSE(TimerMgr->IsExist(timerId));
+    EXPECT_EQ(processor->reportTimerId_, -1);
+    EXPECT_EQ(processor->reportIntervals_.GetTotal(), 0);
+}
+}
 }
-}
\ No newline at end of file
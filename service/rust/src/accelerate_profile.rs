@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! Pointer acceleration profiles.
+//!
+//! A profile holds one piecewise linear curve per speed level. The curves are checked when they are loaded and
+//! every one is precomputed into a dense table that maps the quantized input speed to the segment it falls in, so
+//! evaluating a sample is a table read plus at most a couple of comparisons instead of a scan over the segments.
+//!
+//! Profiles can be overridden by a text file of the form
+//!
+//! ```text
+//! # comment
+//! version 1
+//! <mouse|touchpad|axis> <device type> <speed level> <speed>:<slope>:<diff num> ...
+//! ```
+//!
+//! where every line describes the curve of one speed level. The levels of a profile start at 1 and are contiguous,
+//! and a profile with a single level applies to every speed setting.
+
+use crate::CurveItem;
+
+/// Version of the profile file format understood by [`parse_profiles`].
+pub const ACCELERATE_PROFILE_VERSION: u32 = 1;
+const MAX_SEGMENT_COUNT: usize = 64;
+const MAX_TABLE_LEN: usize = 4096;
+
+/// Kind of motion a profile accelerates.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum ProfileClass {
+    Mouse,
+    Touchpad,
+    Axis,
+}
+
+impl ProfileClass {
+    fn from_name(name: &str) -> Option<ProfileClass> {
+        match name {
+            "mouse" => Some(ProfileClass::Mouse),
+            "touchpad" => Some(ProfileClass::Touchpad),
+            "axis" => Some(ProfileClass::Axis),
+            _ => None,
+        }
+    }
+}
+
+/// Curve of one speed level together with its segment lookup table.
+pub struct GainTable {
+    speeds: Vec<f64>,
+    slopes: Vec<f64>,
+    diff_nums: Vec<f64>,
+    inv_step: f64,
+    first_segments: Vec<u8>,
+}
+
+impl GainTable {
+    /// Validates the curve and precomputes its lookup table. The table step is half the narrowest segment, so a
+    /// bucket never spans more than one breakpoint.
+    pub fn new(item: &CurveItem) -> Result<GainTable, String> {
+        let count = item.speeds.len();
+        if count == 0 || count > MAX_SEGMENT_COUNT {
+            return Err(format!("invalid segment count {}", count));
+        }
+        if item.slopes.len() != count || item.diff_nums.len() != count {
+            return Err(format!("speeds, slopes and diff nums differ in length ({}, {}, {})",
+                count, item.slopes.len(), item.diff_nums.len()));
+        }
+        if item.slopes.iter().chain(item.diff_nums.iter()).any(|value| !value.is_finite()) {
+            return Err(String::from("slope or diff num is not finite"));
+        }
+        let mut min_gap = f64::INFINITY;
+        let mut last_speed = 0.0;
+        for &speed in item.speeds.iter() {
+            if !speed.is_finite() || speed <= last_speed {
+                return Err(format!("speed {} does not follow {}", speed, last_speed));
+            }
+            min_gap = min_gap.min(speed - last_speed);
+            last_speed = speed;
+        }
+        let step = min_gap / 2.0;
+        let len = (last_speed / step).ceil() + 2.0;
+        if len > MAX_TABLE_LEN as f64 {
+            return Err(format!("breakpoints too dense, the table would need {} entries", len));
+        }
+        // Each bucket starts at the segment of the bucket before it, which keeps the lookup exact even when the
+        // quantized index rounds up across a bucket boundary.
+        let first_segments = (0..len as usize).map(|bucket| {
+            let start = (bucket as f64 - 1.0) * step;
+            item.speeds.iter().position(|&speed| speed >= start).unwrap_or(count - 1) as u8
+        }).collect();
+        Ok(GainTable {
+            speeds: item.speeds.clone(),
+            slopes: item.slopes.clone(),
+            diff_nums: item.diff_nums.clone(),
+            inv_step: 1.0 / step,
+            first_segments,
+        })
+    }
+
+    /// Index of the first segment whose upper speed is not below `num`, or of the last segment.
+    fn segment(&self, num: f64) -> usize {
+        let last = self.speeds.len() - 1;
+        let bucket = ((num * self.inv_step) as usize).min(self.first_segments.len() - 1);
+        let mut index = self.first_segments[bucket] as usize;
+        while index < last && num > self.speeds[index] {
+            index += 1;
+        }
+        index
+    }
+
+    /// Gain applied to both components of a relative motion of speed `vin`.
+    pub fn motion_gain(&self, vin: f64) -> f64 {
+        let index = self.segment(vin.abs());
+        (self.slopes[index] * vin + self.diff_nums[index]) / vin
+    }
+
+    /// Accelerated magnitude of an axis motion of magnitude `num`.
+    pub fn axis_value(&self, num: f64) -> f64 {
+        let index = self.segment(num);
+        self.slopes[index] * num + self.diff_nums[index]
+    }
+}
+
+/// Gain tables of one device type, one per speed level.
+pub struct AccelerateProfile {
+    levels: Vec<GainTable>,
+}
+
+impl AccelerateProfile {
+    /// Builds a profile from curves ordered by speed level.
+    pub fn new(items: &[CurveItem]) -> Result<AccelerateProfile, String> {
+        if items.is_empty() {
+            return Err(String::from("profile has no speed level"));
+        }
+        let mut levels = Vec::with_capacity(items.len());
+        for (index, item) in items.iter().enumerate() {
+            levels.push(GainTable::new(item).map_err(|err| format!("speed level {}: {}", index + 1, err))?);
+        }
+        Ok(AccelerateProfile { levels })
+    }
+
+    /// Table of the 1-based speed level, None if the profile has no such level.
+    pub fn level(&self, speed: i32) -> Option<&GainTable> {
+        if self.levels.len() == 1 {
+            return self.levels.first();
+        }
+        let index = usize::try_from(speed).ok()?.checked_sub(1)?;
+        self.levels.get(index)
+    }
+
+    /// Number of speed levels.
+    #[cfg(test)]
+    pub fn level_count(&self) -> usize {
+        self.levels.len()
+    }
+}
+
+/// Profiles keyed by class and device type.
+#[derive(Default)]
+pub struct AccelerateProfiles {
+    profiles: Vec<(ProfileClass, i32, AccelerateProfile)>,
+}
+
+impl AccelerateProfiles {
+    /// Adds a profile, replacing any profile of the same class and device type.
+    pub fn insert(&mut self, class: ProfileClass, device_type: i32, profile: AccelerateProfile) {
+        self.profiles.retain(|(c, t, _)| *c != class || *t != device_type);
+        self.profiles.push((class, device_type, profile));
+    }
+
+    /// Profile of the class and device type.
+    pub fn get(&self, class: ProfileClass, device_type: i32) -> Option<&AccelerateProfile> {
+        self.profiles.iter().find(|(c, t, _)| *c == class && *t == device_type).map(|(_, _, profile)| profile)
+    }
+
+    /// Moves every profile of `other` into this set, replacing profiles it already holds.
+    pub fn merge(&mut self, other: AccelerateProfiles) {
+        for (class, device_type, profile) in other.profiles {
+            self.insert(class, device_type, profile);
+        }
+    }
+
+    /// Number of profiles.
+    #[cfg(test)]
+    pub fn len(&self) -> usize {
+        self.profiles.len()
+    }
+
+    /// Whether the set holds no profile.
+    #[cfg(test)]
+    pub fn is_empty(&self) -> bool {
+        self.profiles.is_empty()
+    }
+}
+
+fn parse_number<T: std::str::FromStr>(token: Option<&str>, what: &str) -> Result<T, String> {
+    let token = token.ok_or_else(|| format!("missing {}", what))?;
+    token.parse::<T>().map_err(|_| format!("invalid {} '{}'", what, token))
+}
+
+fn parse_curve<'a>(tokens: impl Iterator<Item = &'a str>) -> Result<CurveItem, String> {
+    let mut item = CurveItem { speeds: Vec::new(), slopes: Vec::new(), diff_nums: Vec::new() };
+    for token in tokens {
+        let mut fields = token.split(':');
+        item.speeds.push(parse_number(fields.next(), "speed")?);
+        item.slopes.push(parse_number(fields.next(), "slope")?);
+        item.diff_nums.push(parse_number(fields.next(), "diff num")?);
+        if fields.next().is_some() {
+            return Err(format!("invalid segment '{}'", token));
+        }
+    }
+    Ok(item)
+}
+
+/// Parses and validates a profile file. Any error rejects the whole file.
+pub fn parse_profiles(text: &str) -> Result<AccelerateProfiles, String> {
+    let mut version = None;
+    let mut curves: Vec<(ProfileClass, i32, Vec<CurveItem>)> = Vec::new();
+    for (index, line) in text.lines().enumerate() {
+        let line = line.split('#').next().unwrap_or_default().trim();
+        if line.is_empty() {
+            continue;
+        }
+        let err_at = |err: String| format!("line {}: {}", index + 1, err);
+        let mut tokens = line.split_whitespace();
+        let head = tokens.next().unwrap_or_default();
+        if version.is_none() {
+            if head != "version" {
+                return Err(err_at(String::from("the file must start with its version")));
+            }
+            let value: u32 = parse_number(tokens.next(), "version").map_err(err_at)?;
+            if value != ACCELERATE_PROFILE_VERSION {
+                return Err(err_at(format!("unsupported version {}", value)));
+            }
+            version = Some(value);
+            continue;
+        }
+        let class = ProfileClass::from_name(head).ok_or_else(|| err_at(format!("unknown class '{}'", head)))?;
+        let device_type: i32 = parse_number(tokens.next(), "device type").map_err(err_at)?;
+        let level: usize = parse_number(tokens.next(), "speed level").map_err(err_at)?;
+        let item = parse_curve(tokens).map_err(err_at)?;
+        let position = curves.iter().position(|(c, t, _)| *c == class && *t == device_type);
+        let items = match position {
+            Some(position) => &mut curves[position].2,
+            None => {
+                curves.push((class, device_type, Vec::new()));
+                &mut curves.last_mut().unwrap().2
+            }
+        };
+        if level != items.len() + 1 {
+            return Err(err_at(format!("speed level {} follows level {}", level, items.len())));
+        }
+        items.push(item);
+    }
+    if version.is_none() {
+        return Err(String::from("the file has no version"));
+    }
+    let mut profiles = AccelerateProfiles::default();
+    for (class, device_type, items) in curves {
+        let profile = AccelerateProfile::new(&items)
+            .map_err(|err| format!("{:?} profile of device type {}: {}", class, device_type, err))?;
+        profiles.insert(class, device_type, profile);
+    }
+    Ok(profiles)
+}
+
+/// Reads and parses a profile file.
+pub fn load_profiles(path: &str) -> Result<AccelerateProfiles, String> {
+    let text = std::fs::read_to_string(path).map_err(|err| format!("{}: {}", path, err))?;
+    parse_profiles(&text)
+}
+
+#[test]
+fn test_gain_table_segments()
+{
+    let item = CurveItem {
+        speeds: vec![8.0, 32.0, 128.0],
+        slopes: vec![0.16, 0.30, 0.56],
+        diff_nums: vec![0.0, -1.12, -9.44],
+    };
+    let table = GainTable::new(&item).unwrap();
+    assert_eq!(table.segment(0.0), 0);
+    assert_eq!(table.segment(8.0), 0);
+    assert_eq!(table.segment(f64::from_bits(8.0f64.to_bits() + 1)), 1);
+    assert_eq!(table.segment(32.0), 1);
+    assert_eq!(table.segment(127.9), 2);
+    assert_eq!(table.segment(1.0e9), 2);
+    assert_eq!(table.segment(f64::INFINITY), 2);
+}
+
+#[test]
+fn test_gain_table_invalid_curves()
+{
+    let curve = |speeds: Vec<f64>, slopes: Vec<f64>, diff_nums: Vec<f64>| CurveItem { speeds, slopes, diff_nums };
+    assert!(GainTable::new(&curve(vec![], vec![], vec![])).is_err());
+    assert!(GainTable::new(&curve(vec![1.0, 2.0], vec![1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![2.0, 1.0], vec![1.0, 1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![1.0, 1.0], vec![1.0, 1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![-1.0, 1.0], vec![1.0, 1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![1.0, f64::NAN], vec![1.0, 1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![1.0, 2.0], vec![1.0, f64::INFINITY], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![0.001, 1000.0], vec![1.0, 1.0], vec![0.0, 0.0])).is_err());
+    assert!(GainTable::new(&curve(vec![1.0, 2.0], vec![1.0, 1.0], vec![0.0, 0.0])).is_ok());
+}
+
+#[test]
+fn test_parse_profiles()
+{
+    let text = "# tuned curves\n\
+        version 1\n\
+        mouse 1 1 8.0:0.2:0.0 128.0:0.5:-2.4\n\
+        mouse 1 2 8.0:0.4:0.0 128.0:1.0:-4.8  # second level\n\
+        axis 3 1 1.0:2.0:0.0\n";
+    let profiles = parse_profiles(text).unwrap();
+    assert_eq!(profiles.len(), 2);
+    let mouse = profiles.get(ProfileClass::Mouse, 1).unwrap();
+    assert_eq!(mouse.level_count(), 2);
+    assert!(mouse.level(0).is_none());
+    assert!(mouse.level(3).is_none());
+    assert_eq!(mouse.level(2).unwrap().motion_gain(4.0), 0.4);
+    let axis = profiles.get(ProfileClass::Axis, 3).unwrap();
+    assert_eq!(axis.level(7).unwrap().axis_value(2.0), 4.0);
+    assert!(profiles.get(ProfileClass::Touchpad, 1).is_none());
+}
+
+#[test]
+fn test_parse_profiles_rejects_invalid_files()
+{
+    let invalid = [
+        "",
+        "mouse 1 1 8.0:0.2:0.0\n",
+        "version 2\nmouse 1 1 8.0:0.2:0.0\n",
+        "version 1\nversion 1\n",
+        "version 1\npen 1 1 8.0:0.2:0.0\n",
+        "version 1\nmouse 1 2 8.0:0.2:0.0\n",
+        "version 1\nmouse 1 1 8.0:0.2:0.0\nmouse 1 1 8.0:0.2:0.0\n",
+        "version 1\nmouse 1 1\n",
+        "version 1\nmouse 1 1 8.0:0.2\n",
+        "version 1\nmouse 1 1 8.0:0.2:0.0:1.0\n",
+        "version 1\nmouse x 1 8.0:0.2:0.0\n",
+        "version 1\nmouse 1 1 32.0:0.2:0.0 8.0:0.3:0.0\n",
+    ];
+    for text in invalid.iter() {
+        assert!(parse_profiles(text).is_err(), "accepted {:?}", text);
+    }
+    assert!(load_profiles("/nonexistent/pointer_acceleration_profiles.cfg").is_err());
+}
@@ -25,6 +25,7 @@
 #include "dfx_hisysevent.h"
 #include "display_event_monitor.h"
 #include "event_log_helper.h"
+#include "event_stage_tracer.h"
 #include "input_event_data_transformation.h"
 #include "input_event_handler.h"
 #include "key_auto_repeat.h"
@@ -65,6 +66,7 @@ const char* SETTINGS_DATA_EXT_URI {
 void KeySubscriberHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::SUBSCRIBER);
     if (OnSubscribeKeyEvent(keyEvent)) {
         if (DISPLAY_MONITOR->GetScreenStatus() == EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_OFF) {
             auto monitorHandler = InputHandler->GetMonitorHandler();
@@ -103,6 +105,7 @@ void KeySubscriberHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEve
 void KeySubscriberHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::SUBSCRIBER);
     CHKPV(nextHandler_);
     nextHandler_->HandlePointerEvent(pointerEvent);
 }
@@ -112,6 +115,7 @@ void KeySubscriberHandler::HandlePointerEvent(const std::shared_ptr<PointerEvent
 void KeySubscriberHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::SUBSCRIBER);
     TABLET_SCRIBER_HANDLER->HandleTabletEvent(pointerEvent);
     CHKPV(nextHandler_);
     nextHandler_->HandleTouchEvent(pointerEvent);
@@ -609,19 +613,19 @@ bool KeySubscriberHandler::HandleRingMute(std::shared_ptr<KeyEvent> keyEvent)
             }
             auto begin = std::chrono::high_resolution_clock::now();
             callManagerClientPtr->Init(OHOS::TELEPHONY_CALL_MANAGER_SYS_ABILITY_ID);
-            auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+            auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
                 std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-            DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_INIT, durationMS);
+            DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_INIT, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
         }
         if (!DEVICE_MONITOR->GetHasHandleRingMute()) {
             auto begin = std::chrono::high_resolution_clock::now();
             ret = callManagerClientPtr->MuteRinger();
-            auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+            auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
                 std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-            DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_MUTE_RINGER, durationMS);
+            DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_MUTE_RINGER, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
             if (ret != ERR_OK) {
                 MMI_HILOGE("Set mute fail, ret:%{public}d", ret);
@@ -1533,10 +1537,10 @@ void KeySubscriberHandler::HangUpCallProcess()
     int32_t ret = -1;
     auto begin = std::chrono::high_resolution_clock::now();
     ret = callManagerClientPtr->HangUpCall(0);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
     std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_HANG_UP_CALL, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_HANG_UP_CALL, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (ret != ERR_OK) {
         MMI_HILOGE("HangUpCall fail, ret:%{public}d", ret);
@@ -1558,10 +1562,10 @@ void KeySubscriberHandler::RejectCallProcess()
     int32_t ret = -1;
     auto begin = std::chrono::high_resolution_clock::now();
     ret = callManagerClientPtr->RejectCall(0, false, u"");
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
     std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_REJECT_CALL, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::TELEPHONY_CALL_MGR_REJECT_CALL, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (ret != ERR_OK) {
         MMI_HILOGE("RejectCall fail, ret:%{public}d", ret);
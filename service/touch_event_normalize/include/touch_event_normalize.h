@@ -16,7 +16,9 @@
 #ifndef TOUCH_EVENT_NORMALIZE_H
 #define TOUCH_EVENT_NORMALIZE_H
 
+#include <array>
 #include <map>
+#include <unordered_map>
 
 #include "singleton.h"
 
@@ -31,7 +33,7 @@ private:
     public:
         InputDeviceObserver() = default;
         ~InputDeviceObserver() override = default;
-        void OnDeviceAdded(int32_t deviceId) override {}
+        void OnDeviceAdded(int32_t deviceId) override;
         void OnDeviceRemoved(int32_t deviceId) override;
         void UpdatePointerDevice(bool hasPointerDevice, bool isVisible, bool isHotPlug) override {}
     };
@@ -77,16 +79,38 @@ public:
     int32_t GetTouchpadThreeFingersTapSwitch(bool &switchFlag) const;
 
 private:
+    enum ProcessorSlot : size_t {
+        SLOT_DEFAULT = 0,
+        SLOT_TOUCH_PAD,
+        SLOT_REMOTE_CONTROL,
+        SLOT_COUNT,
+    };
+
+    // Per-device state, created when the device is plugged and released when it is removed.
+    struct DeviceContext {
+        int32_t deviceId { -1 };
+        struct libinput_device *device { nullptr };
+        std::array<std::shared_ptr<TransformProcessor>, SLOT_COUNT> processors;
+    };
+
     std::shared_ptr<TransformProcessor> MakeTransformProcessor(
         int32_t deviceId, DeviceType deviceType) const;
+    static ProcessorSlot GetProcessorSlot(DeviceType deviceType);
+    DeviceContext* GetDeviceContext(struct libinput_device *device);
+    DeviceContext* AddDeviceContext(int32_t deviceId, struct libinput_device *device);
+    static void ReleaseProcessors(DeviceContext &context);
     void SetUpDeviceObserver();
     void TearDownDeviceObserver();
+    void OnDeviceAdded(int32_t deviceId);
     void OnDeviceRemoved(int32_t deviceId);
 
 private:
-    std::map<int32_t, std::shared_ptr<TransformProcessor>> processors_;
-    std::map<int32_t, std::shared_ptr<TransformProcessor>> touchpad_processors_;
-    std::map<int32_t, std::shared_ptr<TransformProcessor>> remote_control_processors_;
+    std::map<int32_t, DeviceContext> deviceContexts_;
+    std::unordered_map<struct libinput_device*, DeviceContext*> deviceIndex_;
+    // Devices sending events before they are registered, moved to deviceContexts_ once they get an id.
+    std::unordered_map<struct libinput_device*, DeviceContext> unboundContexts_;
+    struct libinput_device *lastDevice_ { nullptr };
+    DeviceContext *lastContext_ { nullptr };
     std::shared_ptr<IDeviceObserver> inputDevObserver_;
 };
 
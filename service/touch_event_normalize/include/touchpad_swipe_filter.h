@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TOUCHPAD_SWIPE_FILTER_H
+#define TOUCHPAD_SWIPE_FILTER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace MMI {
+struct Coords {
+    int32_t x;
+    int32_t y;
+    Coords operator+(const Coords& other) const
+    {
+        Coords result{this->x, this->y};
+        result += other;
+        return result;
+    }
+    Coords operator-(const Coords& other) const
+    {
+        Coords result{this->x, this->y};
+        result -= other;
+        return result;
+    }
+    Coords& operator+=(const Coords& other)
+    {
+        this->x += other.x;
+        this->y += other.y;
+        return *this;
+    }
+    Coords& operator-=(const Coords& other)
+    {
+        this->x -= other.x;
+        this->y -= other.y;
+        return *this;
+    }
+    Coords& operator/=(const int32_t& divisor)
+    {
+        if (divisor == 0) {
+            return *this;
+        }
+        this->x /= divisor;
+        this->y /= divisor;
+        return *this;
+    }
+};
+
+struct SwipeFilterConfig {
+    // Off by default: at rest minCutoff adds about 80 ms of lag. Dropped fingers are compensated either way.
+    bool enabled { false };
+    // Cutoff frequency (Hz) applied when the finger is at rest. Lower means less jitter, more lag.
+    double minCutoff { 1.5 };
+    // Cutoff increase per device unit/s of speed. Higher means less lag during fast swipes.
+    double beta { 0.01 };
+    // Cutoff frequency (Hz) used to smooth the speed estimate itself.
+    double derivateCutoff { 1.0 };
+};
+
+/**
+ * One Euro filter: a first-order low pass filter whose cutoff frequency adapts to the
+ * estimated speed of the signal, trading jitter at low speed for latency at high speed.
+ */
+class OneEuroFilter final {
+public:
+    void Reset();
+    double Filter(double value, double dtSec, const SwipeFilterConfig &config);
+    double GetLastCutoff() const { return lastCutoff_; }
+
+private:
+    static double Alpha(double cutoff, double dtSec);
+
+    bool initialized_ { false };
+    double lastValue_ { 0.0 };
+    double lastDerivate_ { 0.0 };
+    double lastCutoff_ { 0.0 };
+};
+
+/**
+ * Per-finger velocity-adaptive smoothing for multi-finger touchpad swipes.
+ * All state lives in fixed-size arrays so a gesture never allocates.
+ */
+class TouchPadSwipeFilter final {
+public:
+    static constexpr int32_t MAX_FINGERS { 5 };
+    static constexpr size_t HISTORY_CAPACITY { 8 };
+
+    void SetConfig(const SwipeFilterConfig &config);
+    const SwipeFilterConfig& GetConfig() const { return config_; }
+    void Reset();
+    /**
+     * Filters one gesture frame in place. A finger reporting (0, 0) is treated as dropped for
+     * this frame; its position is estimated from the motion of the other fingers.
+     */
+    void Filter(int64_t timeUs, Coords *fingerCoords, int32_t fingerCount);
+    // Estimated delay (us) the filter added to the last frame, averaged over the tracked fingers.
+    int64_t GetAddedLatencyUs() const { return addedLatencyUs_; }
+    int32_t GetDroppedFingerCount() const { return droppedFingers_; }
+
+private:
+    struct Sample {
+        int64_t timeUs { 0 };
+        Coords coords { 0, 0 };
+    };
+
+    struct FingerHistory {
+        std::array<Sample, HISTORY_CAPACITY> ring {};
+        size_t head { 0 };
+        size_t size { 0 };
+
+        void Clear()
+        {
+            head = 0;
+            size = 0;
+        }
+
+        void Push(const Sample &sample)
+        {
+            head = (head + 1) % HISTORY_CAPACITY;
+            ring[head] = sample;
+            if (size < HISTORY_CAPACITY) {
+                ++size;
+            }
+        }
+
+        // idx 0 is the latest sample.
+        const Sample& At(size_t idx) const
+        {
+            return ring[(head + HISTORY_CAPACITY - idx) % HISTORY_CAPACITY];
+        }
+    };
+
+    struct FingerState {
+        OneEuroFilter filterX;
+        OneEuroFilter filterY;
+        FingerHistory history;
+    };
+
+    bool GetFingerVelocity(const FingerState &finger, double &vx, double &vy) const;
+    Coords EstimateDroppedFinger(const FingerState &finger, int64_t timeUs, bool hasGroupVelocity,
+        double groupVx, double groupVy) const;
+
+    SwipeFilterConfig config_;
+    std::array<FingerState, MAX_FINGERS> fingers_ {};
+    int64_t lastTimeUs_ { -1 };
+    int64_t addedLatencyUs_ { 0 };
+    int32_t droppedFingers_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // TOUCHPAD_SWIPE_FILTER_H
@@ -16,11 +16,11 @@
 #ifndef TOUCHPAD_TRANSFORM_PROCESSOR_H
 #define TOUCHPAD_TRANSFORM_PROCESSOR_H
 
-#include <deque>
 #include <mutex>
 
 #include "aggregator.h"
 #include "timer_manager.h"
+#include "touchpad_swipe_filter.h"
 #include "transform_processor.h"
 
 namespace OHOS {
@@ -32,44 +32,6 @@ enum class MulFingersTap : int32_t {
     QUINT_TAP = 5,
 };
 
-struct Coords {
-    int32_t x;
-    int32_t y;
-    Coords operator+(const Coords& other) const
-    {
-        Coords result{this->x, this->y};
-        result += other;
-        return result;
-    }
-    Coords operator-(const Coords& other) const
-    {
-        Coords result{this->x, this->y};
-        result -= other;
-        return result;
-    }
-    Coords& operator+=(const Coords& other)
-    {
-        this->x += other.x;
-        this->y += other.y;
-        return *this;
-    }
-    Coords& operator-=(const Coords& other)
-    {
-        this->x -= other.x;
-        this->y -= other.y;
-        return *this;
-    }
-    Coords& operator/=(const int32_t& divisor)
-    {
-        if (divisor == 0) {
-            return *this;
-        }
-        this->x /= divisor;
-        this->y /= divisor;
-        return *this;
-    }
-};
-
 class MultiFingersTapHandler final {
     DECLARE_DELAYED_SINGLETON(MultiFingersTapHandler);
 
@@ -124,6 +86,7 @@ public:
     static void GetTouchpadDoubleTapAndDragState(bool &switchFlag);
     static int32_t SetTouchpadScrollRows(int32_t rows);
     static int32_t GetTouchpadScrollRows();
+    void SetSwipeFilterConfig(const SwipeFilterConfig &config);
 
 private:
     static int32_t PutConfigDataToDatabase(std::string &key, bool value);
@@ -136,7 +99,7 @@ private:
     void SetActionPointerItem(int64_t time);
     int32_t SetTouchPadSwipeData(struct libinput_event *event, int32_t action);
     int32_t AddItemForEventWhileSetSwipeData(int64_t time, libinput_event_gesture *gesture, int32_t fingerCount);
-    void SmoothMultifingerSwipeData(std::vector<Coords>& fingerCoords, const int32_t fingerCount);
+    void SmoothMultifingerSwipeData(int64_t timeUs, Coords *fingerCoords, const int32_t fingerCount);
     int32_t OnEventTouchPadSwipeBegin(struct libinput_event *event);
     int32_t OnEventTouchPadSwipeUpdate(struct libinput_event *event);
     int32_t OnEventTouchPadSwipeEnd(struct libinput_event *event);
@@ -158,7 +121,7 @@ private:
     bool isRotateGesture_ { false };
     double rotateAngle_ { 0.0 };
     std::shared_ptr<PointerEvent> pointerEvent_ { nullptr };
-    std::vector<std::deque<Coords>> swipeHistory_;
+    TouchPadSwipeFilter swipeFilter_;
     std::vector<std::pair<int32_t, int32_t>> vecToolType_;
     Aggregator aggregator_ {
             [](int32_t intervalMs, int32_t repeatCount, std::function<void()> callback) -> int32_t {
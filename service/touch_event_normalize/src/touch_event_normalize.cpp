@@ -37,6 +37,11 @@
 
 namespace OHOS {
 namespace MMI {
+void TouchEventNormalize::InputDeviceObserver::OnDeviceAdded(int32_t deviceId)
+{
+    TOUCH_EVENT_HDR->OnDeviceAdded(deviceId);
+}
+
 void TouchEventNormalize::InputDeviceObserver::OnDeviceRemoved(int32_t deviceId)
 {
     TOUCH_EVENT_HDR->OnDeviceRemoved(deviceId);
@@ -57,43 +62,88 @@ std::shared_ptr<PointerEvent> TouchEventNormalize::OnLibInput(struct libinput_ev
     CHKPP(event);
     auto device = libinput_event_get_device(event);
     CHKPP(device);
-    std::shared_ptr<TransformProcessor> processor{ nullptr };
-    auto deviceId = INPUT_DEV_MGR->FindInputDeviceId(device);
-    if (deviceType == TouchEventNormalize::DeviceType::TOUCH_PAD) {
-        if (auto it = touchpad_processors_.find(deviceId); it != touchpad_processors_.end()) {
-            processor = it->second;
-        } else {
-            processor = MakeTransformProcessor(deviceId, deviceType);
-            CHKPP(processor);
-            auto [tIter, isOk] = touchpad_processors_.emplace(deviceId, processor);
-            if (!isOk) {
-                MMI_HILOGE("Duplicate device record:%{public}d", deviceId);
-            }
+    DeviceContext *context = GetDeviceContext(device);
+    CHKPP(context);
+    auto &processor = context->processors[GetProcessorSlot(deviceType)];
+    if (processor == nullptr) {
+        processor = MakeTransformProcessor(context->deviceId, deviceType);
+        CHKPP(processor);
+    }
+    return processor->OnEvent(event);
+}
+
+TouchEventNormalize::ProcessorSlot TouchEventNormalize::GetProcessorSlot(DeviceType deviceType)
+{
+    switch (deviceType) {
+        case DeviceType::TOUCH_PAD: {
+            return SLOT_TOUCH_PAD;
         }
-    } else if (deviceType == TouchEventNormalize::DeviceType::REMOTE_CONTROL) {
-        if (auto it = remote_control_processors_.find(deviceId); it != remote_control_processors_.end()) {
-            processor = it->second;
-        } else {
-            processor = MakeTransformProcessor(deviceId, deviceType);
-            CHKPP(processor);
-            auto [tIter, isOk] = remote_control_processors_.emplace(deviceId, processor);
-            if (!isOk) {
-                MMI_HILOGE("Duplicate device record:%{public}d", deviceId);
-            }
+        case DeviceType::REMOTE_CONTROL: {
+            return SLOT_REMOTE_CONTROL;
         }
+        default: {
+            return SLOT_DEFAULT;
+        }
+    }
+}
+
+TouchEventNormalize::DeviceContext* TouchEventNormalize::GetDeviceContext(struct libinput_device *device)
+{
+    if ((device == lastDevice_) && (lastContext_ != nullptr)) {
+        return lastContext_;
+    }
+    DeviceContext *context { nullptr };
+    if (auto iter = deviceIndex_.find(device); iter != deviceIndex_.end()) {
+        context = iter->second;
     } else {
-        if (auto it = processors_.find(deviceId); it != processors_.end()) {
-            processor = it->second;
-        } else {
-            processor = MakeTransformProcessor(deviceId, deviceType);
-            CHKPP(processor);
-            auto [tIter, isOk] = processors_.emplace(deviceId, processor);
-            if (!isOk) {
-                MMI_HILOGE("Duplicate device record:%{public}d", deviceId);
-            }
+        // Device events may arrive before the hotplug notification has reached us.
+        int32_t deviceId = INPUT_DEV_MGR->FindInputDeviceId(device);
+        if (deviceId < 0) {
+            // Kept per device and not cached, so the device is looked up again until it is registered.
+            DeviceContext &unbound = unboundContexts_[device];
+            unbound.device = device;
+            return &unbound;
+        }
+        context = AddDeviceContext(deviceId, device);
+    }
+    lastDevice_ = device;
+    lastContext_ = context;
+    return context;
+}
+
+TouchEventNormalize::DeviceContext* TouchEventNormalize::AddDeviceContext(int32_t deviceId,
+    struct libinput_device *device)
+{
+    auto &context = deviceContexts_[deviceId];
+    if ((context.device != nullptr) && (context.device != device)) {
+        MMI_HILOGW("Device(%{public}d) rebound to another libinput device", deviceId);
+        deviceIndex_.erase(context.device);
+        if (lastDevice_ == context.device) {
+            lastDevice_ = nullptr;
+            lastContext_ = nullptr;
+        }
+    }
+    context.deviceId = deviceId;
+    context.device = device;
+    deviceIndex_[device] = &context;
+    if (auto iter = unboundContexts_.find(device); iter != unboundContexts_.end()) {
+        // Processors made before the device was registered carry no device id, let them be made again.
+        ReleaseProcessors(iter->second);
+        unboundContexts_.erase(iter);
+    }
+    return &context;
+}
+
+void TouchEventNormalize::ReleaseProcessors(DeviceContext &context)
+{
+    auto processors = std::move(context.processors);
+    for (auto &processor : processors) {
+        if (processor != nullptr) {
+            MMI_HILOGI("Clear processor attached to device(%{public}d)", context.deviceId);
+            processor->OnDeviceRemoved();
+            processor.reset();
         }
     }
-    return processor->OnEvent(event);
 }
 
 #ifndef OHOS_BUILD_ENABLE_WATCH
@@ -157,10 +207,11 @@ std::shared_ptr<TransformProcessor> TouchEventNormalize::MakeTransformProcessor(
 std::shared_ptr<PointerEvent> TouchEventNormalize::GetPointerEvent(int32_t deviceId)
 {
     CALL_DEBUG_ENTER;
-    auto iter = processors_.find(deviceId);
-    if (iter != processors_.end()) {
-        CHKPP(iter->second);
-        return iter->second->GetPointerEvent();
+    auto iter = deviceContexts_.find(deviceId);
+    if (iter != deviceContexts_.end()) {
+        auto &processor = iter->second.processors[SLOT_DEFAULT];
+        CHKPP(processor);
+        return processor->GetPointerEvent();
     }
     return nullptr;
 }
@@ -243,32 +294,43 @@ void TouchEventNormalize::TearDownDeviceObserver()
     }
 }
 
+void TouchEventNormalize::OnDeviceAdded(int32_t deviceId)
+{
+    struct libinput_device *device = INPUT_DEV_MGR->GetLibinputDevice(deviceId);
+    if (device == nullptr) {
+        return;
+    }
+    AddDeviceContext(deviceId, device);
+}
+
 void TouchEventNormalize::OnDeviceRemoved(int32_t deviceId)
 {
-    if (auto iter = processors_.find(deviceId); iter != processors_.end()) {
-        MMI_HILOGI("Clear processor attached to device(%{public}d)", deviceId);
-        auto processor = iter->second;
-        processors_.erase(iter);
-        if (processor != nullptr) {
-            processor->OnDeviceRemoved();
+    auto iter = deviceContexts_.find(deviceId);
+    if (iter == deviceContexts_.end()) {
+        // A device removed before it got an id cannot be told apart, drop every unbound context. Contexts of
+        // devices still present are made again on their next event.
+        auto unbound = std::move(unboundContexts_);
+        unboundContexts_.clear();
+        for (auto &[device, context] : unbound) {
+            ReleaseProcessors(context);
         }
+        return;
     }
-    if (auto iter = touchpad_processors_.find(deviceId); iter != touchpad_processors_.end()) {
-        MMI_HILOGI("Clear touchpad processor attached to device(%{public}d)", deviceId);
-        auto processor = iter->second;
-        touchpad_processors_.erase(iter);
-        if (processor != nullptr) {
-            processor->OnDeviceRemoved();
-        }
+    // Unlink the context before tearing the processors down, so nothing can reach them afterwards.
+    DeviceContext *context = &iter->second;
+    if (auto idxIter = deviceIndex_.find(context->device);
+        (idxIter != deviceIndex_.end()) && (idxIter->second == context)) {
+        deviceIndex_.erase(idxIter);
     }
-    if (auto iter = remote_control_processors_.find(deviceId); iter != remote_control_processors_.end()) {
-        MMI_HILOGI("Clear remote-control processor attached to device(%{public}d)", deviceId);
-        auto processor = iter->second;
-        remote_control_processors_.erase(iter);
-        if (processor != nullptr) {
-            processor->OnDeviceRemoved();
-        }
+    if (auto unboundIter = unboundContexts_.find(context->device); unboundIter != unboundContexts_.end()) {
+        ReleaseProcessors(unboundIter->second);
+        unboundContexts_.erase(unboundIter);
     }
+    lastDevice_ = nullptr;
+    lastContext_ = nullptr;
+    DeviceContext removed = std::move(*context);
+    deviceContexts_.erase(iter);
+    ReleaseProcessors(removed);
 }
 } // namespace MMI
 } // namespace OHOS
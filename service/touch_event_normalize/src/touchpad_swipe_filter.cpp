@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "touchpad_swipe_filter.h"
+
+#include <cmath>
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr double PI { 3.14159265358979323846 };
+constexpr double US_PER_SEC { 1000000.0 };
+constexpr int64_t MIN_FRAME_INTERVAL_US { 1000 };
+constexpr int64_t DEFAULT_FRAME_INTERVAL_US { 8000 };
+constexpr double MIN_CUTOFF_HZ { 0.01 };
+
+inline bool IsMissing(const Coords &coords)
+{
+    return (coords.x == 0 && coords.y == 0);
+}
+} // namespace
+
+void OneEuroFilter::Reset()
+{
+    initialized_ = false;
+    lastValue_ = 0.0;
+    lastDerivate_ = 0.0;
+    lastCutoff_ = 0.0;
+}
+
+double OneEuroFilter::Alpha(double cutoff, double dtSec)
+{
+    double tau = 1.0 / (2.0 * PI * cutoff);
+    return 1.0 / (1.0 + tau / dtSec);
+}
+
+double OneEuroFilter::Filter(double value, double dtSec, const SwipeFilterConfig &config)
+{
+    if (!initialized_) {
+        initialized_ = true;
+        lastValue_ = value;
+        lastDerivate_ = 0.0;
+        lastCutoff_ = std::fmax(config.minCutoff, MIN_CUTOFF_HZ);
+        return value;
+    }
+    double derivate = (value - lastValue_) / dtSec;
+    double derivateAlpha = Alpha(std::fmax(config.derivateCutoff, MIN_CUTOFF_HZ), dtSec);
+    lastDerivate_ += derivateAlpha * (derivate - lastDerivate_);
+    lastCutoff_ = std::fmax(config.minCutoff + config.beta * std::fabs(lastDerivate_), MIN_CUTOFF_HZ);
+    lastValue_ += Alpha(lastCutoff_, dtSec) * (value - lastValue_);
+    return lastValue_;
+}
+
+void TouchPadSwipeFilter::SetConfig(const SwipeFilterConfig &config)
+{
+    config_ = config;
+    Reset();
+}
+
+void TouchPadSwipeFilter::Reset()
+{
+    for (auto &finger : fingers_) {
+        finger.filterX.Reset();
+        finger.filterY.Reset();
+        finger.history.Clear();
+    }
+    lastTimeUs_ = -1;
+    addedLatencyUs_ = 0;
+    droppedFingers_ = 0;
+}
+
+bool TouchPadSwipeFilter::GetFingerVelocity(const FingerState &finger, double &vx, double &vy) const
+{
+    if (finger.history.size < 2) {
+        return false;
+    }
+    const Sample &latest = finger.history.At(0);
+    const Sample &oldest = finger.history.At(finger.history.size - 1);
+    int64_t dt = latest.timeUs - oldest.timeUs;
+    if (dt <= 0) {
+        return false;
+    }
+    vx = static_cast<double>(latest.coords.x - oldest.coords.x) / dt;
+    vy = static_cast<double>(latest.coords.y - oldest.coords.y) / dt;
+    return true;
+}
+
+Coords TouchPadSwipeFilter::EstimateDroppedFinger(const FingerState &finger, int64_t timeUs,
+    bool hasGroupVelocity, double groupVx, double groupVy) const
+{
+    const Sample &latest = finger.history.At(0);
+    double vx = groupVx;
+    double vy = groupVy;
+    if (!hasGroupVelocity && !GetFingerVelocity(finger, vx, vy)) {
+        return latest.coords;
+    }
+    int64_t dt = timeUs - latest.timeUs;
+    if (dt <= 0) {
+        return latest.coords;
+    }
+    return Coords {
+        latest.coords.x + static_cast<int32_t>(std::lround(vx * dt)),
+        latest.coords.y + static_cast<int32_t>(std::lround(vy * dt))
+    };
+}
+
+void TouchPadSwipeFilter::Filter(int64_t timeUs, Coords *fingerCoords, int32_t fingerCount)
+{
+    if (fingerCoords == nullptr || fingerCount <= 0) {
+        return;
+    }
+    if (fingerCount > MAX_FINGERS) {
+        fingerCount = MAX_FINGERS;
+    }
+    int64_t intervalUs = (lastTimeUs_ < 0) ? DEFAULT_FRAME_INTERVAL_US : (timeUs - lastTimeUs_);
+    if (intervalUs < MIN_FRAME_INTERVAL_US) {
+        intervalUs = MIN_FRAME_INTERVAL_US;
+    }
+    lastTimeUs_ = timeUs;
+    double dtSec = static_cast<double>(intervalUs) / US_PER_SEC;
+
+    // In a swipe all fingers travel together, so the fingers that did report this frame tell
+    // where the dropped ones most likely are.
+    double groupVx = 0.0;
+    double groupVy = 0.0;
+    int32_t velocityCount = 0;
+    Coords centroid { 0, 0 };
+    int32_t presentCount = 0;
+    for (int32_t i = 0; i < fingerCount; ++i) {
+        if (IsMissing(fingerCoords[i])) {
+            continue;
+        }
+        centroid += fingerCoords[i];
+        ++presentCount;
+        const FingerHistory &history = fingers_[i].history;
+        if (history.size == 0) {
+            continue;
+        }
+        int64_t dt = timeUs - history.At(0).timeUs;
+        if (dt > 0) {
+            groupVx += static_cast<double>(fingerCoords[i].x - history.At(0).coords.x) / dt;
+            groupVy += static_cast<double>(fingerCoords[i].y - history.At(0).coords.y) / dt;
+            ++velocityCount;
+        }
+    }
+    if (velocityCount > 0) {
+        groupVx /= velocityCount;
+        groupVy /= velocityCount;
+    }
+    centroid /= presentCount;
+
+    droppedFingers_ = 0;
+    int64_t latencySumUs = 0;
+    int32_t latencyCount = 0;
+    for (int32_t i = 0; i < fingerCount; ++i) {
+        FingerState &finger = fingers_[i];
+        if (IsMissing(fingerCoords[i])) {
+            ++droppedFingers_;
+            if (finger.history.size > 0) {
+                fingerCoords[i] = EstimateDroppedFinger(finger, timeUs, velocityCount > 0, groupVx, groupVy);
+            } else if (presentCount > 0) {
+                fingerCoords[i] = centroid;
+            } else {
+                continue;
+            }
+        }
+        if (config_.enabled) {
+            fingerCoords[i].x = static_cast<int32_t>(std::lround(
+                finger.filterX.Filter(fingerCoords[i].x, dtSec, config_)));
+            fingerCoords[i].y = static_cast<int32_t>(std::lround(
+                finger.filterY.Filter(fingerCoords[i].y, dtSec, config_)));
+            double cutoff = std::fmin(finger.filterX.GetLastCutoff(), finger.filterY.GetLastCutoff());
+            latencySumUs += static_cast<int64_t>(US_PER_SEC / (2.0 * PI * cutoff));
+            ++latencyCount;
+        }
+        finger.history.Push(Sample { timeUs, fingerCoords[i] });
+    }
+    addedLatencyUs_ = (latencyCount > 0) ? (latencySumUs / latencyCount) : 0;
+}
+} // namespace MMI
+} // namespace OHOS
@@ -22,6 +22,7 @@
 #include "i_input_windows_manager.h"
 #include "i_preference_manager.h"
 #include "mouse_device_state.h"
+#include "parameters.h"
 
 #undef MMI_LOG_DOMAIN
 #define MMI_LOG_DOMAIN MMI_LOG_DISPATCH
@@ -42,15 +43,35 @@ constexpr int32_t MIN_ROWS { 1 };
 constexpr int32_t MAX_ROWS { 100 };
 constexpr int32_t DEFAULT_ROWS { 3 };
 constexpr int32_t MAX_N_POINTER_ITEMS { 10 };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr double SWIPE_FILTER_PARAM_SCALE { 1000.0 };
 
 const char* TOUCHPAD_FILE_NAME = "touchpad_settings.xml";
 std::string g_threeFingerTapKey = "touchpadThreeFingerTap";
+
+// Products opt in to swipe smoothing. The tuning parameters are given in thousandths.
+SwipeFilterConfig LoadSwipeFilterConfig()
+{
+    SwipeFilterConfig config;
+    config.enabled = system::GetBoolParameter("const.multimodalinput.touchpad_swipe_filter", config.enabled);
+    config.minCutoff = system::GetIntParameter("const.multimodalinput.touchpad_swipe_filter_min_cutoff",
+        static_cast<int32_t>(config.minCutoff * SWIPE_FILTER_PARAM_SCALE)) / SWIPE_FILTER_PARAM_SCALE;
+    config.beta = system::GetIntParameter("const.multimodalinput.touchpad_swipe_filter_beta",
+        static_cast<int32_t>(config.beta * SWIPE_FILTER_PARAM_SCALE)) / SWIPE_FILTER_PARAM_SCALE;
+    if ((config.minCutoff <= 0.0) || (config.beta < 0.0)) {
+        MMI_HILOGE("Invalid swipe filter tuning, minCutoff:%{public}f, beta:%{public}f", config.minCutoff, config.beta);
+        config = SwipeFilterConfig {};
+    }
+    MMI_HILOGI("Touchpad swipe filter %{public}s", (config.enabled ? "on" : "off"));
+    return config;
+}
 } // namespace
 
 TouchPadTransformProcessor::TouchPadTransformProcessor(int32_t deviceId)
     : deviceId_(deviceId)
 {
     InitToolType();
+    SetSwipeFilterConfig(LoadSwipeFilterConfig());
 }
 
 int32_t TouchPadTransformProcessor::OnEventTouchPadDown(struct libinput_event *event)
@@ -376,11 +397,13 @@ int32_t TouchPadTransformProcessor::SetTouchPadSwipeData(struct libinput_event *
         return RET_ERR;
     }
 
+    if (action == PointerEvent::POINTER_ACTION_SWIPE_BEGIN) {
+        swipeFilter_.Reset();
+    }
     AddItemForEventWhileSetSwipeData(time, gesture, fingerCount);
     
     if (action == PointerEvent::POINTER_ACTION_SWIPE_BEGIN) {
         MMI_HILOGE("Start report for POINTER_ACTION_SWIPE_BEGIN");
-        swipeHistory_.clear();
         DfxHisysevent::StatisticTouchpadGesture(pointerEvent_);
     }
 
@@ -395,14 +418,14 @@ int32_t TouchPadTransformProcessor::AddItemForEventWhileSetSwipeData(int64_t tim
         return RET_ERR;
     }
     Coords avgCoord {0, 0};
-    std::vector<Coords> fingerCoords(FINGER_COUNT_MAX, avgCoord);
+    Coords fingerCoords[FINGER_COUNT_MAX] {};
     int32_t action = pointerEvent_->GetPointerAction();
     for (int32_t i = 0; i < fingerCount; ++i) {
         fingerCoords[i].x = libinput_event_gesture_get_device_coords_x(gesture, i);
         fingerCoords[i].y = libinput_event_gesture_get_device_coords_y(gesture, i);
     }
-    if (action == PointerEvent::POINTER_ACTION_SWIPE_UPDATE) {
-        SmoothMultifingerSwipeData(fingerCoords, fingerCount);
+    if (action == PointerEvent::POINTER_ACTION_SWIPE_BEGIN || action == PointerEvent::POINTER_ACTION_SWIPE_UPDATE) {
+        SmoothMultifingerSwipeData(time * US_PER_MS, fingerCoords, fingerCount);
     }
     for (int32_t i = 0; i < fingerCount; ++i) {
         avgCoord += fingerCoords[i];
@@ -433,50 +456,21 @@ int32_t TouchPadTransformProcessor::AddItemForEventWhileSetSwipeData(int64_t tim
     return RET_OK;
 }
 
-void TouchPadTransformProcessor::SmoothMultifingerSwipeData(std::vector<Coords>& fingerCoords,
+void TouchPadTransformProcessor::SmoothMultifingerSwipeData(int64_t timeUs, Coords *fingerCoords,
                                                             const int32_t fingerCount)
 {
-    bool isMissing = false;
-    Coords coordDelta {0, 0};
-    int32_t historyFingerCount = 0;
-    for (int32_t i = 0; i < fingerCount; ++i) {
-        if (static_cast<int32_t>(swipeHistory_.size()) <= i) {
-            swipeHistory_.emplace_back(std::deque<Coords>());
-        }
-        if (fingerCoords[i].x == 0 && fingerCoords[i].y == 0) {
-            isMissing = true;
-            continue;
-        }
-        swipeHistory_[i].push_back(fingerCoords[i]);
-        if (static_cast<int32_t>(swipeHistory_[i].size()) > fingerCount) {
-            swipeHistory_[i].pop_front();
-        }
-    }
-    if (!isMissing) {
-        return;
-    }
-    for (int32_t i = 0; i < fingerCount; ++i) {
-        int32_t historySize = static_cast<int32_t>(swipeHistory_[i].size()) - 1;
-        if (historySize > 0) {
-            coordDelta += swipeHistory_[i][historySize] - swipeHistory_[i][0];
-            historyFingerCount += historySize;
-        }
-    }
-    if (historyFingerCount > 0) {
-        coordDelta /= historyFingerCount;
-    }
-    for (int32_t i = 0; i < fingerCount; ++i) {
-        if (fingerCoords[i].x == 0 && fingerCoords[i].y == 0) {
-            bool isEmpty = swipeHistory_[i].empty();
-            fingerCoords[i] = isEmpty ? coordDelta : (swipeHistory_[i].back() + coordDelta);
-            swipeHistory_[i].push_back(fingerCoords[i]);
-        }
-        if (static_cast<int32_t>(swipeHistory_[i].size()) > fingerCount) {
-            swipeHistory_[i].pop_front();
-        }
+    swipeFilter_.Filter(timeUs, fingerCoords, fingerCount);
+    if (swipeFilter_.GetDroppedFingerCount() > 0) {
+        MMI_HILOGD("Compensated %{public}d dropped fingers, filter latency:%{public}" PRId64 "us",
+            swipeFilter_.GetDroppedFingerCount(), swipeFilter_.GetAddedLatencyUs());
     }
 }
 
+void TouchPadTransformProcessor::SetSwipeFilterConfig(const SwipeFilterConfig &config)
+{
+    swipeFilter_.SetConfig(config);
+}
+
 int32_t TouchPadTransformProcessor::OnEventTouchPadSwipeBegin(struct libinput_event *event)
 {
     CALL_DEBUG_ENTER;
@@ -13,18 +13,38 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "define_multimodal.h"
 #include "input_device_manager.h"
 #include "touch_event_normalize.h"
+#include "touchpad_transform_processor.h"
 
 #undef MMI_LOG_TAG
 #define MMI_LOG_TAG "TouchEventNormalizeTestWithMock"
 
 namespace OHOS {
 namespace MMI {
+namespace {
 using namespace testing::ext;
+constexpr int32_t FAKE_TIMER_ID { 42 };
+uint8_t g_fakeDevices[10] {};
+
+// Timers handed to an Aggregator instead of TimerMgr, so a test sees which timers are armed and removed.
+struct FakeTimers {
+    std::function<void()> callback;
+    std::vector<int32_t> removed;
+};
+
+struct libinput_device* FakeDevice(int32_t deviceId)
+{
+    return reinterpret_cast<struct libinput_device*>(&g_fakeDevices[deviceId]);
+}
+} // namespace
 
 class TouchEventNormalizeTestWithMock : public testing::Test {
 public:
@@ -135,10 +155,12 @@ HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_001, TestSize.Level1)
     TouchEventNormalize norm;
     int32_t deviceId { 1 };
     auto processor = norm.MakeTransformProcessor(deviceId, TouchEventNormalize::DeviceType::TABLET_TOOL);
-    auto [_, isNew] = norm.processors_.emplace(deviceId, processor);
-    EXPECT_TRUE(isNew);
+    auto context = norm.AddDeviceContext(deviceId, FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    context->processors[TouchEventNormalize::SLOT_DEFAULT] = processor;
     EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(deviceId));
-    EXPECT_TRUE(norm.processors_.find(deviceId) == norm.processors_.end());
+    EXPECT_TRUE(norm.deviceContexts_.find(deviceId) == norm.deviceContexts_.end());
+    EXPECT_TRUE(norm.deviceIndex_.empty());
 }
 
 /**
@@ -155,10 +177,12 @@ HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_002, TestSize.Level1)
     TouchEventNormalize norm;
     int32_t deviceId { 1 };
     auto processor = norm.MakeTransformProcessor(deviceId, TouchEventNormalize::DeviceType::TOUCH_PAD);
-    auto [_, isNew] = norm.touchpad_processors_.emplace(deviceId, processor);
-    EXPECT_TRUE(isNew);
+    auto context = norm.AddDeviceContext(deviceId, FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    context->processors[TouchEventNormalize::SLOT_TOUCH_PAD] = processor;
     EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(deviceId));
-    EXPECT_TRUE(norm.touchpad_processors_.find(deviceId) == norm.touchpad_processors_.end());
+    EXPECT_TRUE(norm.deviceContexts_.find(deviceId) == norm.deviceContexts_.end());
+    EXPECT_TRUE(norm.deviceIndex_.empty());
 }
 
 /**
@@ -175,10 +199,12 @@ HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_003, TestSize.Level1)
     TouchEventNormalize norm;
     int32_t deviceId { 1 };
     auto processor = norm.MakeTransformProcessor(deviceId, TouchEventNormalize::DeviceType::REMOTE_CONTROL);
-    auto [_, isNew] = norm.remote_control_processors_.emplace(deviceId, processor);
-    EXPECT_TRUE(isNew);
+    auto context = norm.AddDeviceContext(deviceId, FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    context->processors[TouchEventNormalize::SLOT_REMOTE_CONTROL] = processor;
     EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(deviceId));
-    EXPECT_TRUE(norm.remote_control_processors_.find(deviceId) == norm.remote_control_processors_.end());
+    EXPECT_TRUE(norm.deviceContexts_.find(deviceId) == norm.deviceContexts_.end());
+    EXPECT_TRUE(norm.deviceIndex_.empty());
 }
 
 /**
@@ -195,16 +221,210 @@ HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_004, TestSize.Level1)
     TouchEventNormalize norm;
     int32_t deviceId { 1 };
     auto processor = norm.MakeTransformProcessor(deviceId, TouchEventNormalize::DeviceType::TABLET_TOOL);
-    auto [_, isNew] = norm.processors_.emplace(deviceId, processor);
-    EXPECT_TRUE(isNew);
+    auto context = norm.AddDeviceContext(deviceId, FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    context->processors[TouchEventNormalize::SLOT_DEFAULT] = processor;
 
     int32_t deviceId1 { 2 };
     EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(deviceId1));
-    auto iter = norm.processors_.find(deviceId);
-    if (iter != norm.processors_.end()) {
-        EXPECT_EQ(iter->second, processor);
+    auto iter = norm.deviceContexts_.find(deviceId);
+    if (iter != norm.deviceContexts_.end()) {
+        EXPECT_EQ(iter->second.processors[TouchEventNormalize::SLOT_DEFAULT], processor);
     }
-    EXPECT_TRUE(iter != norm.processors_.end());
+    EXPECT_TRUE(iter != norm.deviceContexts_.end());
+}
+
+/**
+ * @tc.name: OnDeviceAdded_001
+ * @tc.desc: Test that hotplug establishes the device context used for event routing
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceAdded_001, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+    int32_t deviceId { 3 };
+    EXPECT_CALL(*INPUT_DEV_MGR, GetLibinputDevice(deviceId)).WillOnce(testing::Return(FakeDevice(deviceId)));
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId).Times(testing::Exactly(0));
+
+    TouchEventNormalize norm;
+    norm.OnDeviceAdded(deviceId);
+    auto context = norm.GetDeviceContext(FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    EXPECT_EQ(context->deviceId, deviceId);
+    EXPECT_EQ(norm.GetDeviceContext(FakeDevice(deviceId)), context);
+}
+
+/**
+ * @tc.name: OnDeviceAdded_002
+ * @tc.desc: Test that events from a device not yet announced by hotplug still get a context
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceAdded_002, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+    int32_t deviceId { 4 };
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(deviceId))).WillOnce(testing::Return(deviceId));
+
+    TouchEventNormalize norm;
+    auto context = norm.GetDeviceContext(FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    EXPECT_EQ(context->deviceId, deviceId);
+    EXPECT_EQ(norm.GetDeviceContext(FakeDevice(deviceId)), context);
+}
+
+/**
+ * @tc.name: OnDeviceAdded_003
+ * @tc.desc: Test that devices without an id get contexts of their own, which are rebound once they are registered
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceAdded_003, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+    int32_t firstId { 8 };
+    int32_t secondId { 9 };
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(firstId))).WillRepeatedly(testing::Return(-1));
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(secondId))).WillRepeatedly(testing::Return(-1));
+    EXPECT_CALL(*INPUT_DEV_MGR, GetLibinputDevice(firstId)).WillOnce(testing::Return(FakeDevice(firstId)));
+
+    TouchEventNormalize norm;
+    auto first = norm.GetDeviceContext(FakeDevice(firstId));
+    auto second = norm.GetDeviceContext(FakeDevice(secondId));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(first->deviceId, -1);
+    EXPECT_TRUE(norm.deviceContexts_.empty());
+    EXPECT_EQ(norm.lastContext_, nullptr);
+    first->processors[TouchEventNormalize::SLOT_DEFAULT] =
+        norm.MakeTransformProcessor(first->deviceId, TouchEventNormalize::DeviceType::TOUCH);
+
+    norm.OnDeviceAdded(firstId);
+    auto bound = norm.GetDeviceContext(FakeDevice(firstId));
+    ASSERT_NE(bound, nullptr);
+    EXPECT_EQ(bound->deviceId, firstId);
+    EXPECT_EQ(bound->processors[TouchEventNormalize::SLOT_DEFAULT], nullptr);
+    EXPECT_EQ(norm.unboundContexts_.size(), 1U);
+    EXPECT_TRUE(norm.deviceContexts_.find(-1) == norm.deviceContexts_.end());
+}
+
+/**
+ * @tc.name: OnDeviceRemoved_006
+ * @tc.desc: Test that removing devices leaves no unbound context behind
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_006, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+    int32_t boundId { 10 };
+    int32_t unboundId { 11 };
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(boundId))).WillRepeatedly(testing::Return(boundId));
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(unboundId))).WillRepeatedly(testing::Return(-1));
+
+    TouchEventNormalize norm;
+    auto unbound = norm.GetDeviceContext(FakeDevice(unboundId));
+    ASSERT_NE(unbound, nullptr);
+    unbound->processors[TouchEventNormalize::SLOT_DEFAULT] =
+        norm.MakeTransformProcessor(unbound->deviceId, TouchEventNormalize::DeviceType::TOUCH);
+    ASSERT_EQ(norm.unboundContexts_.size(), 1U);
+    norm.OnDeviceRemoved(-1);
+    EXPECT_TRUE(norm.unboundContexts_.empty());
+
+    ASSERT_NE(norm.GetDeviceContext(FakeDevice(boundId)), nullptr);
+    norm.unboundContexts_[FakeDevice(boundId)].device = FakeDevice(boundId);
+    norm.OnDeviceRemoved(boundId);
+    EXPECT_TRUE(norm.unboundContexts_.empty());
+    EXPECT_TRUE(norm.deviceContexts_.empty());
+    EXPECT_TRUE(norm.deviceIndex_.empty());
+}
+
+/**
+ * @tc.name: OnDeviceRemoved_005
+ * @tc.desc: Test removing a touchpad in the middle of a swipe with a pending aggregator timer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_005, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+    int32_t deviceId { 5 };
+    EXPECT_CALL(*INPUT_DEV_MGR, GetLibinputDevice(deviceId)).WillOnce(testing::Return(FakeDevice(deviceId)));
+    EXPECT_CALL(*INPUT_DEV_MGR, FindInputDeviceId(FakeDevice(deviceId))).WillOnce(testing::Return(deviceId));
+
+    TouchEventNormalize norm;
+    norm.OnDeviceAdded(deviceId);
+    auto context = norm.GetDeviceContext(FakeDevice(deviceId));
+    ASSERT_NE(context, nullptr);
+    auto processor = std::make_shared<TouchPadTransformProcessor>(deviceId);
+    std::weak_ptr<TouchPadTransformProcessor> weakProcessor = processor;
+    context->processors[TouchEventNormalize::SLOT_TOUCH_PAD] = processor;
+    processor->pointerEvent_ = PointerEvent::Create();
+    ASSERT_NE(processor->pointerEvent_, nullptr);
+    processor->pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_SWIPE_UPDATE);
+    auto timers = std::make_shared<FakeTimers>();
+    processor->aggregator_ = Aggregator(
+        [timers](int32_t, int32_t, std::function<void()> callback) -> int32_t {
+            timers->callback = std::move(callback);
+            return FAKE_TIMER_ID;
+        },
+        [](int32_t) -> int32_t {
+            return RET_OK;
+        },
+        [timers](int32_t timerId) -> int32_t {
+            timers->removed.push_back(timerId);
+            return RET_OK;
+        });
+    processor->aggregator_.Record(MMI_LOG_FREEZE, "swipe", "in progress");
+    ASSERT_NE(timers->callback, nullptr);
+    processor.reset();
+
+    EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(deviceId));
+    EXPECT_TRUE(weakProcessor.expired());
+    EXPECT_EQ(norm.lastContext_, nullptr);
+    EXPECT_TRUE(norm.deviceIndex_.empty());
+    // The aggregator timer was armed by the removed processor and must be gone before it can fire into freed memory.
+    EXPECT_NE(std::find(timers->removed.begin(), timers->removed.end(), FAKE_TIMER_ID), timers->removed.end());
+
+    // The same node coming back gets a fresh context and a fresh processor.
+    auto newContext = norm.GetDeviceContext(FakeDevice(deviceId));
+    ASSERT_NE(newContext, nullptr);
+    EXPECT_EQ(newContext->processors[TouchEventNormalize::SLOT_TOUCH_PAD], nullptr);
+}
+
+/**
+ * @tc.name: OnDeviceRemoved_006
+ * @tc.desc: Test removing a device drops the cached routing entry of that device only
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchEventNormalizeTestWithMock, OnDeviceRemoved_006, TestSize.Level1)
+{
+    EXPECT_CALL(*INPUT_DEV_MGR, Attach).Times(testing::Exactly(1));
+    EXPECT_CALL(*INPUT_DEV_MGR, Detach).Times(testing::Exactly(1));
+
+    TouchEventNormalize norm;
+    int32_t touchpadId { 6 };
+    int32_t touchscreenId { 7 };
+    auto touchpadContext = norm.AddDeviceContext(touchpadId, FakeDevice(touchpadId));
+    auto touchscreenContext = norm.AddDeviceContext(touchscreenId, FakeDevice(touchscreenId));
+    ASSERT_NE(touchpadContext, nullptr);
+    ASSERT_NE(touchscreenContext, nullptr);
+    touchpadContext->processors[TouchEventNormalize::SLOT_TOUCH_PAD] =
+        norm.MakeTransformProcessor(touchpadId, TouchEventNormalize::DeviceType::TOUCH_PAD);
+    EXPECT_EQ(norm.GetDeviceContext(FakeDevice(touchscreenId)), touchscreenContext);
+
+    EXPECT_NO_FATAL_FAILURE(norm.OnDeviceRemoved(touchpadId));
+    EXPECT_EQ(norm.GetDeviceContext(FakeDevice(touchscreenId)), touchscreenContext);
+    EXPECT_TRUE(norm.deviceContexts_.find(touchpadId) == norm.deviceContexts_.end());
+    EXPECT_TRUE(norm.deviceIndex_.find(FakeDevice(touchpadId)) == norm.deviceIndex_.end());
 }
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mmi_log.h"
+#include "touchpad_swipe_filter.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "TouchPadSwipeFilterTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t FRAME_INTERVAL_MS { 8 };
+constexpr int64_t US_PER_MS { 1000 };
+constexpr int32_t THREE_FINGERS { 3 };
+constexpr int32_t FOUR_FINGERS { 4 };
+constexpr int32_t FINGER_SPACING { 300 };
+} // namespace
+
+/**
+ * One recorded libinput gesture frame: the values returned by libinput_event_gesture_get_time,
+ * libinput_event_gesture_get_finger_count and libinput_event_gesture_get_device_coords_x/y.
+ * The ground truth is only known for synthetic traces and is used to measure lag.
+ */
+struct SwipeFrame {
+    int64_t timeMs { 0 };
+    int32_t fingerCount { 0 };
+    Coords coords[TouchPadSwipeFilter::MAX_FINGERS] {};
+    Coords truth { 0, 0 };
+};
+
+struct ReplayResult {
+    double rawJitter { 0.0 };
+    double filteredJitter { 0.0 };
+    double meanLag { 0.0 };
+    double maxJump { 0.0 };
+    int64_t meanLatencyUs { 0 };
+};
+
+class SwipeReplayHarness {
+public:
+    static std::vector<SwipeFrame> MakeTrace(int32_t fingerCount, int32_t frames, double speed, double noise,
+        int32_t dropEvery)
+    {
+        std::mt19937 rng(0x5eed);
+        std::normal_distribution<double> jitter(0.0, noise);
+        std::vector<SwipeFrame> trace;
+        double pos = 1000.0;
+        for (int32_t n = 0; n < frames; ++n) {
+            SwipeFrame frame;
+            frame.timeMs = static_cast<int64_t>(n) * FRAME_INTERVAL_MS;
+            frame.fingerCount = fingerCount;
+            // ease-in/ease-out swipe to exercise both slow and fast phases
+            double phase = static_cast<double>(n) / frames;
+            pos += speed * std::sin(phase * M_PI) * FRAME_INTERVAL_MS;
+            frame.truth = Coords { static_cast<int32_t>(pos), 2000 };
+            for (int32_t i = 0; i < fingerCount; ++i) {
+                frame.coords[i].x = static_cast<int32_t>(std::lround(pos + jitter(rng)));
+                frame.coords[i].y = static_cast<int32_t>(std::lround(2000 + i * FINGER_SPACING + jitter(rng)));
+            }
+            if (dropEvery > 0 && n > 0 && (n % dropEvery) == 0) {
+                frame.coords[n % fingerCount] = Coords { 0, 0 };
+            }
+            trace.push_back(frame);
+        }
+        return trace;
+    }
+
+    static ReplayResult Replay(TouchPadSwipeFilter &filter, const std::vector<SwipeFrame> &trace)
+    {
+        ReplayResult result;
+        filter.Reset();
+        std::vector<double> raw;
+        std::vector<double> filtered;
+        double lagSum = 0.0;
+        int64_t latencySumUs = 0;
+        for (const auto &frame : trace) {
+            Coords coords[TouchPadSwipeFilter::MAX_FINGERS] {};
+            for (int32_t i = 0; i < frame.fingerCount; ++i) {
+                coords[i] = frame.coords[i];
+            }
+            raw.push_back(Centroid(coords, frame.fingerCount));
+            filter.Filter(frame.timeMs * US_PER_MS, coords, frame.fingerCount);
+            double out = Centroid(coords, frame.fingerCount);
+            if (!filtered.empty()) {
+                result.maxJump = std::fmax(result.maxJump, std::fabs(out - filtered.back()));
+            }
+            filtered.push_back(out);
+            lagSum += std::fabs(frame.truth.x - out);
+            latencySumUs += filter.GetAddedLatencyUs();
+        }
+        result.rawJitter = Jitter(raw);
+        result.filteredJitter = Jitter(filtered);
+        if (!trace.empty()) {
+            result.meanLag = lagSum / trace.size();
+            result.meanLatencyUs = latencySumUs / static_cast<int64_t>(trace.size());
+        }
+        MMI_HILOGI("Jitter raw:%{public}.2f filtered:%{public}.2f, mean lag:%{public}.2f, max jump:%{public}.2f, "
+            "mean latency:%{public}" PRId64 "us", result.rawJitter, result.filteredJitter, result.meanLag,
+            result.maxJump, result.meanLatencyUs);
+        return result;
+    }
+
+private:
+    static double Centroid(const Coords *coords, int32_t fingerCount)
+    {
+        double sum = 0.0;
+        for (int32_t i = 0; i < fingerCount; ++i) {
+            sum += coords[i].x;
+        }
+        return sum / fingerCount;
+    }
+
+    // RMS of the second difference: zero for constant velocity, grows with frame-to-frame noise.
+    static double Jitter(const std::vector<double> &values)
+    {
+        if (values.size() < 3) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (size_t i = 2; i < values.size(); ++i) {
+            double accel = values[i] - 2.0 * values[i - 1] + values[i - 2];
+            sum += accel * accel;
+        }
+        return std::sqrt(sum / (values.size() - 2));
+    }
+};
+
+class TouchPadSwipeFilterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: TouchPadSwipeFilterTest_Filter_001
+ * @tc.desc: Noisy three finger swipe is smoothed without losing track of the fingers
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchPadSwipeFilterTest, TouchPadSwipeFilterTest_Filter_001, TestSize.Level1)
+{
+    auto trace = SwipeReplayHarness::MakeTrace(THREE_FINGERS, 120, 2.0, 6.0, 0);
+    TouchPadSwipeFilter filter;
+    SwipeFilterConfig config;
+    config.enabled = true;
+    filter.SetConfig(config);
+    ReplayResult result = SwipeReplayHarness::Replay(filter, trace);
+    EXPECT_LT(result.filteredJitter, result.rawJitter * 0.5);
+    EXPECT_LT(result.meanLag, 40.0);
+}
+
+/**
+ * @tc.name: TouchPadSwipeFilterTest_Filter_002
+ * @tc.desc: The filter is off by default, passes coordinates through and reports no latency
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchPadSwipeFilterTest, TouchPadSwipeFilterTest_Filter_002, TestSize.Level1)
+{
+    auto trace = SwipeReplayHarness::MakeTrace(THREE_FINGERS, 60, 2.0, 6.0, 0);
+    TouchPadSwipeFilter filter;
+    EXPECT_FALSE(filter.GetConfig().enabled);
+    ReplayResult result = SwipeReplayHarness::Replay(filter, trace);
+    EXPECT_DOUBLE_EQ(result.filteredJitter, result.rawJitter);
+    EXPECT_EQ(result.meanLatencyUs, 0);
+}
+
+/**
+ * @tc.name: TouchPadSwipeFilterTest_Filter_003
+ * @tc.desc: Dropped finger frames are compensated instead of pulling the centroid towards the origin
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchPadSwipeFilterTest, TouchPadSwipeFilterTest_Filter_003, TestSize.Level1)
+{
+    auto trace = SwipeReplayHarness::MakeTrace(FOUR_FINGERS, 120, 3.0, 0.0, 5);
+    TouchPadSwipeFilter filter;
+    SwipeFilterConfig config;
+    config.enabled = false;
+    filter.SetConfig(config);
+    ReplayResult result = SwipeReplayHarness::Replay(filter, trace);
+    // 3.0 units/ms at 8ms frames: a dropped finger mis-estimated by its full position would jump > 1000.
+    EXPECT_LT(result.maxJump, 3.0 * FRAME_INTERVAL_MS * 2);
+}
+
+/**
+ * @tc.name: TouchPadSwipeFilterTest_Filter_004
+ * @tc.desc: Higher beta trades jitter for lag during fast swipes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchPadSwipeFilterTest, TouchPadSwipeFilterTest_Filter_004, TestSize.Level1)
+{
+    auto trace = SwipeReplayHarness::MakeTrace(THREE_FINGERS, 120, 6.0, 4.0, 7);
+    TouchPadSwipeFilter filter;
+    SwipeFilterConfig smooth;
+    smooth.enabled = true;
+    smooth.beta = 0.0;
+    filter.SetConfig(smooth);
+    ReplayResult smoothResult = SwipeReplayHarness::Replay(filter, trace);
+    SwipeFilterConfig responsive;
+    responsive.enabled = true;
+    responsive.beta = 0.1;
+    filter.SetConfig(responsive);
+    ReplayResult responsiveResult = SwipeReplayHarness::Replay(filter, trace);
+    EXPECT_LT(responsiveResult.meanLag, smoothResult.meanLag);
+    EXPECT_LT(responsiveResult.meanLatencyUs, smoothResult.meanLatencyUs);
+}
+
+/**
+ * @tc.name: TouchPadSwipeFilterTest_Filter_005
+ * @tc.desc: A dropped finger on the very first frame takes the centroid of the other fingers
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchPadSwipeFilterTest, TouchPadSwipeFilterTest_Filter_005, TestSize.Level1)
+{
+    TouchPadSwipeFilter filter;
+    Coords coords[TouchPadSwipeFilter::MAX_FINGERS] { { 100, 100 }, { 0, 0 }, { 300, 300 } };
+    filter.Filter(0, coords, THREE_FINGERS);
+    EXPECT_EQ(filter.GetDroppedFingerCount(), 1);
+    EXPECT_EQ(coords[1].x, 200);
+    EXPECT_EQ(coords[1].y, 200);
+}
+} // namespace MMI
+} // namespace OHOS
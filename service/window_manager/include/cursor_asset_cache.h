@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CURSOR_ASSET_CACHE_H
+#define CURSOR_ASSET_CACHE_H
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+#include "pixel_map.h"
+
+#include "pointer_image_cache.h"
+
+namespace OHOS::MMI {
+// How the SVG asset is recolored while it is decoded; the same file decodes differently in each mode.
+enum class CursorDecodeMode : int32_t {
+    PLAIN = 0,
+    FILL_COLOR = 1,
+    STYLE_COLOR = 2,
+};
+
+struct CursorAssetKey {
+    std::string path;
+    int64_t mtime { 0 };
+    int32_t width { 0 };
+    int32_t height { 0 };
+    uint32_t color { 0 };
+    int32_t style { 0 };
+    CursorDecodeMode mode { CursorDecodeMode::PLAIN };
+
+    bool operator==(const CursorAssetKey &rhs) const
+    {
+        return (mtime == rhs.mtime) && (width == rhs.width) && (height == rhs.height) && (color == rhs.color) &&
+            (style == rhs.style) && (mode == rhs.mode) && (path == rhs.path);
+    }
+};
+
+struct CursorAssetKeyHash {
+    size_t operator()(const CursorAssetKey &key) const
+    {
+        constexpr size_t HASH_SEED { 0x9E3779B9 };
+        size_t hash = std::hash<std::string>()(key.path);
+        for (size_t value : { static_cast<size_t>(key.mtime), static_cast<size_t>(key.width),
+            static_cast<size_t>(key.height), static_cast<size_t>(key.color), static_cast<size_t>(key.style),
+            static_cast<size_t>(key.mode) }) {
+            hash ^= value + HASH_SEED + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+/**
+ * Process wide cache of decoded SVG cursor assets, shared by every display and ScreenPointer. Assets are
+ * addressed by their content (path and modification time) and by how they were decoded, so an asset replaced
+ * on disk is decoded again without explicit invalidation.
+ */
+class CursorAssetCache final {
+public:
+    using AssetPtr = std::shared_ptr<Media::PixelMap>;
+    using Decoder = std::function<AssetPtr(const CursorAssetKey &)>;
+    static constexpr size_t DEFAULT_BUDGET { 8 * 1024 * 1024 };
+
+    static CursorAssetCache &GetInstance();
+    static int64_t GetModifyTime(const std::string &path);
+
+    explicit CursorAssetCache(size_t budget = DEFAULT_BUDGET);
+    ~CursorAssetCache();
+    DISALLOW_COPY_AND_MOVE(CursorAssetCache);
+
+    // Fills in the modification time of key.path and returns the cached asset, decoding it on a miss.
+    AssetPtr Load(CursorAssetKey key, const Decoder &decoder);
+    // Decodes the given assets on a background thread, superseding any prewarm still running.
+    void Prewarm(std::vector<CursorAssetKey> keys, Decoder decoder);
+    // Drops every decoded asset, to be called when the cursor theme changes.
+    void Invalidate();
+    PointerImageCacheStats GetStats() const;
+
+private:
+    void StopPrewarm();
+
+    PointerImageCache<Media::PixelMap, CursorAssetKey, CursorAssetKeyHash> cache_;
+    std::mutex prewarmMutex_;
+    std::thread prewarmThread_;
+    std::atomic<uint64_t> generation_ { 0 };
+};
+
+#define CURSOR_ASSET_CACHE ::OHOS::MMI::CursorAssetCache::GetInstance()
+} // namespace OHOS::MMI
+#endif // CURSOR_ASSET_CACHE_H
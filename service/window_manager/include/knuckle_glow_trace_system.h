@@ -16,8 +16,12 @@
 #ifndef KNUCKLE_GLOW_TRACE_SYSTEM_H
 #define KNUCKLE_GLOW_TRACE_SYSTEM_H
 
-#include "knuckle_divergent_point.h"
-#include "knuckle_glow_point.h"
+#include <random>
+
+#include "pipeline/rs_recording_canvas.h"
+#include "render/rs_pixel_map_util.h"
+
+#include "knuckle_particle_pool.h"
 
 namespace OHOS {
 namespace MMI {
@@ -33,8 +37,16 @@ public:
     void AddGlowPoints(const Rosen::Drawing::Path &path, int64_t timeInterval);
 
 private:
-    std::vector<std::shared_ptr<KnuckleGlowPoint>> glowPoints_;
-    std::vector<std::shared_ptr<KnuckleDivergentPoint>> divergentPoints_;
+    void DrawGlowPoint(Rosen::ExtendRecordingCanvas* canvas, size_t index);
+    void DrawDivergentPoint(Rosen::ExtendRecordingCanvas* canvas, size_t index);
+    int64_t GetMillisTime() const;
+
+    KnuckleParticlePool particles_;
+    std::shared_ptr<OHOS::Media::PixelMap> traceShadow_ { nullptr };
+    OHOS::Rosen::Drawing::Brush glowBrush_;
+    OHOS::Rosen::Drawing::Brush divergentBrush_;
+    Rosen::Drawing::Matrix traceMatrix_;
+    std::default_random_engine randomEngine_;
     int32_t maxDivergenceNum_ { 0 };
 };
 } // namespace MMI
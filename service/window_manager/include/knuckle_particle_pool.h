@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef KNUCKLE_PARTICLE_POOL_H
+#define KNUCKLE_PARTICLE_POOL_H
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace OHOS {
+namespace MMI {
+/**
+ * Simulation state of the knuckle glow trace, kept apart from drawing so it can run without a canvas. Every slot
+ * holds one glow particle and one divergent particle in parallel arrays; a slot is free once the lifespan of its
+ * particle drops below zero, and free slots are refilled lowest index first.
+ */
+class KnuckleParticlePool {
+public:
+    // Samples the stroke at the given distance from its start, false if the distance is off the path.
+    using PathSampler = std::function<bool(float distance, float &pointX, float &pointY)>;
+
+    explicit KnuckleParticlePool(size_t capacity);
+    ~KnuckleParticlePool() = default;
+
+    size_t GetCapacity() const;
+    size_t GetGlowCount() const;
+    size_t GetDivergentCount() const;
+    void Clear();
+    void Update(int64_t nowMillis);
+    void AddGlowPoints(double pathLength, int64_t timeInterval, int64_t nowMillis, const PathSampler &sampler);
+    int32_t ResetDivergentPoints(double pointX, double pointY, int32_t maxDivergenceNum);
+
+    bool IsGlowEnded(size_t index) const;
+    bool IsDivergentEnded(size_t index) const;
+    double GetGlowX(size_t index) const;
+    double GetGlowY(size_t index) const;
+    float GetGlowSize(size_t index) const;
+    double GetDivergentX(size_t index) const;
+    double GetDivergentY(size_t index) const;
+
+private:
+    void ResetGlowPoint(size_t index, double pointX, double pointY, float lifespanOffset, int64_t nowMillis);
+    void ResetDivergentPoint(size_t index, double pointX, double pointY);
+
+    size_t capacity_ { 0 };
+    size_t glowCount_ { 0 };
+    size_t divergentCount_ { 0 };
+
+    std::vector<double> glowX_;
+    std::vector<double> glowY_;
+    std::vector<double> glowLifespan_;
+    std::vector<float> glowSize_;
+    std::vector<int64_t> glowUpdateTime_;
+
+    std::vector<double> divergentX_;
+    std::vector<double> divergentY_;
+    std::vector<double> divergentVelocityX_;
+    std::vector<double> divergentVelocityY_;
+    std::vector<int32_t> divergentLifespan_;
+
+    std::default_random_engine randomEngine_;
+};
+
+inline size_t KnuckleParticlePool::GetCapacity() const
+{
+    return capacity_;
+}
+
+inline size_t KnuckleParticlePool::GetGlowCount() const
+{
+    return glowCount_;
+}
+
+inline size_t KnuckleParticlePool::GetDivergentCount() const
+{
+    return divergentCount_;
+}
+
+inline bool KnuckleParticlePool::IsGlowEnded(size_t index) const
+{
+    return glowLifespan_[index] < 0;
+}
+
+inline bool KnuckleParticlePool::IsDivergentEnded(size_t index) const
+{
+    return divergentLifespan_[index] < 0;
+}
+
+inline double KnuckleParticlePool::GetGlowX(size_t index) const
+{
+    return glowX_[index];
+}
+
+inline double KnuckleParticlePool::GetGlowY(size_t index) const
+{
+    return glowY_[index];
+}
+
+inline float KnuckleParticlePool::GetGlowSize(size_t index) const
+{
+    return glowSize_[index];
+}
+
+inline double KnuckleParticlePool::GetDivergentX(size_t index) const
+{
+    return divergentX_[index];
+}
+
+inline double KnuckleParticlePool::GetDivergentY(size_t index) const
+{
+    return divergentY_[index];
+}
+} // namespace MMI
+} // namespace OHOS
+#endif // KNUCKLE_PARTICLE_POOL_H
@@ -167,6 +167,9 @@ private:
     void DrawManager();
     void FixCursorPosition(int32_t &physicalX, int32_t &physicalY);
     std::shared_ptr<OHOS::Media::PixelMap> LoadCursorSvgWithColor(MOUSE_ICON type, int32_t color);
+    std::shared_ptr<OHOS::Media::PixelMap> DecodeCursorSvg(const CursorAssetKey &key, int32_t color);
+    CursorAssetKey GetCursorAssetKey(MOUSE_ICON type);
+    void PrewarmCursorAssets();
     std::shared_ptr<OHOS::Media::PixelMap> DecodeImageToPixelMap(MOUSE_ICON type);
     void UpdatePointerVisible();
     int32_t UpdateDefaultPointerStyle(int32_t pid, int32_t windowId, PointerStyle style, bool isUiExtension = false);
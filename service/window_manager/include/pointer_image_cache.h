@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_IMAGE_CACHE_H
+#define POINTER_IMAGE_CACHE_H
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS::MMI {
+// Everything a decoded cursor image depends on. Direction and rotation are applied on the canvas when the
+// image is drawn, so one image serves every orientation. The modification time of path makes a file replaced
+// on disk miss the cache.
+struct PointerImageKey {
+    int32_t style { 0 };
+    std::string path;
+    int64_t mtime { 0 };
+    uint32_t color { 0 };
+    uint32_t size { 0 };
+    float dpi { 0.0f };
+    int32_t imageSize { 0 };
+
+    bool operator==(const PointerImageKey &rhs) const
+    {
+        return (style == rhs.style) && (mtime == rhs.mtime) && (color == rhs.color) && (size == rhs.size) &&
+            (std::memcmp(&dpi, &rhs.dpi, sizeof(dpi)) == 0) && (imageSize == rhs.imageSize) && (path == rhs.path);
+    }
+};
+
+struct PointerImageKeyHash {
+    size_t operator()(const PointerImageKey &key) const
+    {
+        constexpr size_t HASH_SEED { 0x9E3779B9 };
+        uint32_t dpiBits = 0;
+        std::memcpy(&dpiBits, &key.dpi, sizeof(dpiBits));
+        size_t hash = std::hash<std::string>()(key.path);
+        for (size_t value : { static_cast<size_t>(key.style), static_cast<size_t>(key.mtime),
+            static_cast<size_t>(key.color), static_cast<size_t>(key.size), static_cast<size_t>(dpiBits),
+            static_cast<size_t>(key.imageSize) }) {
+            hash ^= value + HASH_SEED + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+struct PointerImageCacheStats {
+    size_t entries { 0 };
+    size_t bytes { 0 };
+    size_t budget { 0 };
+    uint64_t hits { 0 };
+    uint64_t misses { 0 };
+    uint64_t evictions { 0 };
+};
+
+/**
+ * Least recently used cache of decoded cursor images, bounded by the memory the images take rather than by
+ * their number. Image only needs GetWidth() and GetHeight(), so the cache can be tested without a renderer.
+ */
+template <typename Image, typename Key = PointerImageKey, typename KeyHash = PointerImageKeyHash>
+class PointerImageCache {
+public:
+    using ImagePtr = std::shared_ptr<Image>;
+    static constexpr size_t BYTES_PER_PIXEL { 4 };
+    static constexpr size_t DEFAULT_BUDGET { 4 * 1024 * 1024 };
+
+    explicit PointerImageCache(size_t budget = DEFAULT_BUDGET) : budget_(budget) {}
+    ~PointerImageCache() = default;
+
+    ImagePtr Find(const Key &key)
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return iter->second->image;
+    }
+
+    void Insert(const Key &key, ImagePtr image)
+    {
+        if (image == nullptr) {
+            return;
+        }
+        size_t bytes = ImageBytes(*image);
+        std::lock_guard<std::mutex> guard(lock_);
+        if (auto iter = index_.find(key); iter != index_.end()) {
+            bytes_ -= iter->second->bytes;
+            entries_.erase(iter->second);
+            index_.erase(iter);
+        }
+        if (bytes > budget_) {
+            return;
+        }
+        while (!entries_.empty() && (bytes_ + bytes > budget_)) {
+            bytes_ -= entries_.back().bytes;
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+            ++evictions_;
+        }
+        entries_.push_front(Entry { key, image, bytes });
+        index_.emplace(key, entries_.begin());
+        bytes_ += bytes;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        entries_.clear();
+        index_.clear();
+        bytes_ = 0;
+    }
+
+    PointerImageCacheStats GetStats() const
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        return PointerImageCacheStats {
+            .entries = entries_.size(),
+            .bytes = bytes_,
+            .budget = budget_,
+            .hits = hits_,
+            .misses = misses_,
+            .evictions = evictions_,
+        };
+    }
+
+private:
+    struct Entry {
+        Key key;
+        ImagePtr image;
+        size_t bytes { 0 };
+    };
+
+    static size_t ImageBytes(Image &image)
+    {
+        size_t width = static_cast<size_t>(std::max(image.GetWidth(), 0));
+        size_t height = static_cast<size_t>(std::max(image.GetHeight(), 0));
+        return width * height * BYTES_PER_PIXEL;
+    }
+
+    mutable std::mutex lock_;
+    size_t budget_ { DEFAULT_BUDGET };
+    size_t bytes_ { 0 };
+    uint64_t hits_ { 0 };
+    uint64_t misses_ { 0 };
+    uint64_t evictions_ { 0 };
+    std::list<Entry> entries_;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index_;
+};
+} // namespace OHOS::MMI
+#endif // POINTER_IMAGE_CACHE_H
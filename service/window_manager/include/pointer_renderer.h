@@ -16,6 +16,8 @@
 #ifndef POINTER_RENDERER_H
 #define POINTER_RENDERER_H
 
+#include "cursor_asset_cache.h"
+#include "pointer_image_cache.h"
 #include "struct_multimodal.h"
 #include "ui/rs_canvas_node.h"
 #include "ui/rs_surface_node.h"
@@ -23,7 +25,6 @@
 namespace OHOS::MMI {
 using image_ptr_t = std::shared_ptr<Rosen::Drawing::Image>;
 using pixelmap_ptr_t = std::shared_ptr<OHOS::Media::PixelMap>;
-constexpr int32_t DEFAULT_IMG_SIZE{ 10 };
 
 class RenderConfig {
 public:
@@ -47,6 +48,8 @@ public:
     std::string ToString() const;
     int32_t GetOffsetX() const;
     int32_t GetOffsetY() const;
+    PointerImageKey GetImageKey() const;
+    CursorAssetKey GetAssetKey() const;
 
     RenderConfig() = default;
     ~RenderConfig() = default;
@@ -70,28 +73,15 @@ public:
     int32_t Render(uint8_t *addr, uint32_t width, uint32_t height, const RenderConfig &cfg);
     int32_t DynamicRender(uint8_t *addr, uint32_t width, uint32_t height, const RenderConfig &cfg);
     image_ptr_t UserIconScale(uint32_t width, uint32_t height, const RenderConfig &cfg);
+    PointerImageCacheStats GetImageCacheStats() const;
 private:
     image_ptr_t LoadPointerImage(const RenderConfig &cfg);
     pixelmap_ptr_t LoadCursorSvgWithColor(const RenderConfig &cfg);
+    pixelmap_ptr_t DecodeCursorSvg(const RenderConfig &cfg);
     image_ptr_t ExtractDrawingImage(pixelmap_ptr_t pixelMap);
     int32_t DrawImage(OHOS::Rosen::Drawing::Canvas &canvas, const RenderConfig &cfg);
-    std::vector<std::tuple<RenderConfig, image_ptr_t>> imgMaps_;
-    image_ptr_t FindImg(const RenderConfig &cfg)
-    {
-        for (auto& data : imgMaps_) {
-            if (std::get<0>(data) == cfg) {
-                return std::get<1>(data);
-            }
-        }
-        return nullptr;
-    }
-    void PushImg(const RenderConfig &cfg, image_ptr_t img)
-    {
-        if (imgMaps_.size() >= DEFAULT_IMG_SIZE) {
-            imgMaps_.erase(imgMaps_.begin());
-        }
-        imgMaps_.push_back({cfg, img});
-    }
+    image_ptr_t LoadCachedPointerImage(const RenderConfig &cfg);
+    PointerImageCache<Rosen::Drawing::Image> imageCache_;
 };
 } // namespace OHOS::MMI
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cursor_asset_cache.h"
+
+#include <sys/stat.h>
+
+#include "mmi_log.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_CURSOR
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "CursorAssetCache"
+
+namespace OHOS::MMI {
+namespace {
+constexpr int64_t NS_PER_SEC { 1000000000 };
+} // namespace
+
+CursorAssetCache &CursorAssetCache::GetInstance()
+{
+    static CursorAssetCache instance;
+    return instance;
+}
+
+int64_t CursorAssetCache::GetModifyTime(const std::string &path)
+{
+    struct stat st {};
+    if (::stat(path.c_str(), &st) != 0) {
+        return -1;
+    }
+    return static_cast<int64_t>(st.st_mtim.tv_sec) * NS_PER_SEC + static_cast<int64_t>(st.st_mtim.tv_nsec);
+}
+
+CursorAssetCache::CursorAssetCache(size_t budget) : cache_(budget) {}
+
+CursorAssetCache::~CursorAssetCache()
+{
+    StopPrewarm();
+}
+
+CursorAssetCache::AssetPtr CursorAssetCache::Load(CursorAssetKey key, const Decoder &decoder)
+{
+    key.mtime = GetModifyTime(key.path);
+    AssetPtr asset = cache_.Find(key);
+    if (asset != nullptr) {
+        return asset;
+    }
+    if (!decoder) {
+        return nullptr;
+    }
+    asset = decoder(key);
+    cache_.Insert(key, asset);
+    return asset;
+}
+
+void CursorAssetCache::Prewarm(std::vector<CursorAssetKey> keys, Decoder decoder)
+{
+    CHKPV(decoder);
+    StopPrewarm();
+    std::lock_guard<std::mutex> guard(prewarmMutex_);
+    uint64_t generation = generation_.load();
+    prewarmThread_ = std::thread([this, keys = std::move(keys), decoder = std::move(decoder), generation] {
+        size_t nDecoded = 0;
+        for (const auto &key : keys) {
+            if (generation_.load() != generation) {
+                MMI_HILOGI("Cursor asset prewarm superseded after %{public}zu assets", nDecoded);
+                return;
+            }
+            if (Load(key, decoder) != nullptr) {
+                ++nDecoded;
+            }
+        }
+        MMI_HILOGI("Prewarmed %{public}zu of %{public}zu cursor assets", nDecoded, keys.size());
+    });
+}
+
+void CursorAssetCache::StopPrewarm()
+{
+    std::lock_guard<std::mutex> guard(prewarmMutex_);
+    ++generation_;
+    if (prewarmThread_.joinable()) {
+        prewarmThread_.join();
+    }
+}
+
+void CursorAssetCache::Invalidate()
+{
+    StopPrewarm();
+    cache_.Clear();
+    MMI_HILOGI("Cursor asset cache invalidated");
+}
+
+PointerImageCacheStats CursorAssetCache::GetStats() const
+{
+    return cache_.GetStats();
+}
+} // namespace OHOS::MMI
@@ -19,6 +19,7 @@
 #include "account_manager.h"
 #include "display_manager_lite.h"
 #include "event_log_helper.h"
+#include "event_stage_tracer.h"
 #include "json_parser.h"
 #include "pixel_map.h"
 #ifndef OHOS_BUILD_ENABLE_WATCH
@@ -668,6 +669,7 @@ std::vector<std::pair<int32_t, TargetInfo>> InputWindowsManager::UpdateTarget(st
         MMI_HILOG_DISPATCHE("keyEvent is nullptr");
         return secSubWindowTargets;
     }
+    EventStageTracer::Mark(keyEvent->GetId(), EventStage::HIT_TEST);
     auto secSubWindows = GetPidAndUpdateTarget(keyEvent);
     for (const auto &item : secSubWindows) {
         int32_t fd = INVALID_FD;
@@ -4738,7 +4740,7 @@ bool InputWindowsManager::IsWriteTablet(PointerEvent::PointerItem &pointerItem)
 {
     if (pointerItem.GetToolType() == PointerEvent::TOOL_TYPE_PEN) {
         static int32_t lastDeviceId = -1;
-        static std::shared_ptr<InputDevice> inputDevice = nullptr;
+        static std::shared_ptr<const InputDevice> inputDevice = nullptr;
         auto nowId = pointerItem.GetDeviceId();
         if (lastDeviceId != nowId) {
             inputDevice = INPUT_DEV_MGR->GetInputDevice(nowId);
@@ -5383,11 +5385,11 @@ int32_t InputWindowsManager::UpdateTouchScreenTarget(std::shared_ptr<PointerEven
                 auto begin = std::chrono::high_resolution_clock::now();
                 OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
                     OHOS::ResourceSchedule::ResType::RES_TYPE_SOCPERF_CUST_ACTION, touchDownBoost, mapPayload);
-                auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+                auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
                     std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
                 DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA,
-                    durationMS);
+                    durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
             } else if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_UP) {
                 constexpr int32_t touchUpBoost = 1007;
@@ -5396,11 +5398,11 @@ int32_t InputWindowsManager::UpdateTouchScreenTarget(std::shared_ptr<PointerEven
                 auto begin = std::chrono::high_resolution_clock::now();
                 OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
                     OHOS::ResourceSchedule::ResType::RES_TYPE_SOCPERF_CUST_ACTION, touchUpBoost, mapPayload);
-                auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+                auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
                     std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
                 DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RESOURCE_SCHEDULE_REPORT_DATA,
-                    durationMS);
+                    durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
             }
         }
@@ -5921,6 +5923,7 @@ int32_t InputWindowsManager::UpdateTargetPointer(std::shared_ptr<PointerEvent> p
 {
     CALL_DEBUG_ENTER;
     CHKPR(pointerEvent, ERROR_NULL_POINTER);
+    EventStageTracer::Mark(pointerEvent->GetId(), EventStage::HIT_TEST);
     auto source = pointerEvent->GetSourceType();
     pointerActionFlag_ = pointerEvent->GetPointerAction();
 #ifdef OHOS_BUILD_ENABLE_ANCO
@@ -7222,10 +7225,10 @@ void InputWindowsManager::SetFoldState()
     BytraceAdapter::StartFoldState(Rosen::DisplayManagerLite::GetInstance().IsFoldable());
     auto begin = std::chrono::high_resolution_clock::now();
     IsFoldable_ = Rosen::DisplayManagerLite::GetInstance().IsFoldable();
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::IS_FOLDABLE, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::IS_FOLDABLE, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     BytraceAdapter::StopFoldState();
 }
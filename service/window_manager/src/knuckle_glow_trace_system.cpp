@@ -16,6 +16,7 @@
 #include "knuckle_glow_trace_system.h"
 
 #include "mmi_log.h"
+#include "platform/ohos/overdraw/rs_overdraw_controller.h"
 
 #undef MMI_LOG_TAG
 #define MMI_LOG_TAG "KnuckleGlowTraceSystem"
@@ -23,87 +24,137 @@
 namespace OHOS {
 namespace MMI {
 namespace {
-constexpr float BASIC_DISTANCE_BETWEEN_POINTS { 5.0f };
+constexpr int32_t SEC_TO_NANOSEC { 1000000000 };
+constexpr int32_t NANOSECOND_TO_MILLISECOND { 1000000 };
+constexpr int32_t GLOW_ARGB_COLOR_ARRAY { 0x11c8ffff };
+constexpr int32_t DIVERGENT_ARGB_COLOR_ARRAY { 0x20c8ffff };
+constexpr float DYNAMIC_EFFECT_SIZE { 0.8f };
+constexpr double HALF { 2.0 };
+
+OHOS::Rosen::Drawing::Brush CreateTraceBrush(int32_t color)
+{
+    OHOS::Rosen::Drawing::Filter filter;
+    OHOS::Rosen::OverdrawColorArray colorArray = {
+        0x00000000,
+        0x00000000,
+        0x00000000,
+        0x00000000,
+        0x00000000,
+        color,
+    };
+    auto protanomalyMat = OHOS::Rosen::Drawing::ColorFilter::CreateOverDrawColorFilter(colorArray.data());
+    filter.SetColorFilter(protanomalyMat);
+    OHOS::Rosen::Drawing::Brush brush;
+    brush.SetFilter(filter);
+    return brush;
+}
 } // namespace
 
 KnuckleGlowTraceSystem::KnuckleGlowTraceSystem(int32_t pointSize, std::shared_ptr<OHOS::Media::PixelMap> pixelMap,
-    int32_t maxDivergenceNum) : maxDivergenceNum_(maxDivergenceNum)
+    int32_t maxDivergenceNum)
+    : particles_(((pixelMap == nullptr) || (pointSize < 0)) ? 0 : static_cast<size_t>(pointSize)),
+      traceShadow_(pixelMap), glowBrush_(CreateTraceBrush(GLOW_ARGB_COLOR_ARRAY)),
+      divergentBrush_(CreateTraceBrush(DIVERGENT_ARGB_COLOR_ARRAY)), randomEngine_(std::random_device()()),
+      maxDivergenceNum_(maxDivergenceNum)
 {
     CALL_DEBUG_ENTER;
     CHKPV(pixelMap);
-    for (int32_t i = 0; i < pointSize; ++i) {
-        divergentPoints_.emplace_back(std::make_shared<KnuckleDivergentPoint>(pixelMap));
-        glowPoints_.emplace_back(std::make_shared<KnuckleGlowPoint>(pixelMap));
-    }
+}
+
+int64_t KnuckleGlowTraceSystem::GetMillisTime() const
+{
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (static_cast<int64_t>(time.tv_sec) * SEC_TO_NANOSEC + time.tv_nsec) / NANOSECOND_TO_MILLISECOND;
 }
 
 void KnuckleGlowTraceSystem::Clear()
 {
     CALL_DEBUG_ENTER;
-    for (const auto &divergentPoint : divergentPoints_) {
-        CHKPC(divergentPoint);
-        divergentPoint->Clear();
-    }
+    particles_.Clear();
 }
 
 void KnuckleGlowTraceSystem::Update()
 {
     CALL_DEBUG_ENTER;
-    for (size_t i = 0; i < glowPoints_.size(); i++) {
-        CHKPC(glowPoints_[i]);
-        CHKPC(divergentPoints_[i]);
-        glowPoints_[i]->Update();
-        divergentPoints_[i]->Update();
-    }
+    particles_.Update(GetMillisTime());
 }
 
 void KnuckleGlowTraceSystem::Draw(Rosen::ExtendRecordingCanvas* canvas)
 {
     CALL_DEBUG_ENTER;
-    for (size_t i = 0; i < glowPoints_.size(); ++i) {
-        std::shared_ptr<KnuckleDivergentPoint> divergentPoint = divergentPoints_[i];
-        std::shared_ptr<KnuckleGlowPoint> glowPoint = glowPoints_[i];
-        if (divergentPoint != nullptr) {
-            divergentPoint->Draw(canvas);
-        }
-        if (glowPoint != nullptr) {
-            glowPoint->Draw(canvas);
-        }
+    CHKPV(canvas);
+    if ((particles_.GetGlowCount() == 0) && (particles_.GetDivergentCount() == 0)) {
+        return;
+    }
+    for (size_t i = 0; i < particles_.GetCapacity(); ++i) {
+        DrawDivergentPoint(canvas, i);
+        DrawGlowPoint(canvas, i);
     }
 }
 
+void KnuckleGlowTraceSystem::DrawGlowPoint(Rosen::ExtendRecordingCanvas* canvas, size_t index)
+{
+    double pointX = particles_.GetGlowX(index);
+    double pointY = particles_.GetGlowY(index);
+    if (particles_.IsGlowEnded(index) || pointX <= 0 || pointY <= 0) {
+        return;
+    }
+    traceMatrix_.Reset();
+    if (traceShadow_->GetWidth() != 0) {
+        float proportion = particles_.GetGlowSize(index) / traceShadow_->GetWidth();
+        traceMatrix_.PostScale(proportion, proportion, pointX, pointY);
+    }
+    canvas->SetMatrix(traceMatrix_);
+    canvas->AttachBrush(glowBrush_);
+    Rosen::Drawing::Rect src = Rosen::Drawing::Rect(0, 0, traceShadow_->GetWidth(), traceShadow_->GetHeight());
+    Rosen::Drawing::Rect dst = Rosen::Drawing::Rect(pointX - traceShadow_->GetWidth() / HALF,
+        pointY - traceShadow_->GetHeight() / HALF, pointX + traceShadow_->GetWidth() / HALF,
+        pointY + traceShadow_->GetHeight());
+    canvas->DrawPixelMapRect(traceShadow_, src, dst, Rosen::Drawing::SamplingOptions());
+    canvas->DetachBrush();
+}
+
+void KnuckleGlowTraceSystem::DrawDivergentPoint(Rosen::ExtendRecordingCanvas* canvas, size_t index)
+{
+    double pointX = particles_.GetDivergentX(index);
+    double pointY = particles_.GetDivergentY(index);
+    if (particles_.IsDivergentEnded(index) || pointX <= 0 || pointY <= 0) {
+        return;
+    }
+    std::uniform_real_distribution<double> u(0.0, DYNAMIC_EFFECT_SIZE);
+    float proportion = u(randomEngine_);
+    traceMatrix_.Reset();
+    traceMatrix_.PostScale(proportion, proportion, pointX, pointY);
+    canvas->SetMatrix(traceMatrix_);
+    canvas->AttachBrush(divergentBrush_);
+    Rosen::Drawing::Rect src = Rosen::Drawing::Rect(0, 0, traceShadow_->GetWidth(), traceShadow_->GetHeight());
+    Rosen::Drawing::Rect dst = Rosen::Drawing::Rect(pointX, pointY, pointX + traceShadow_->GetWidth(),
+        pointY + traceShadow_->GetHeight());
+    canvas->DrawPixelMapRect(traceShadow_, src, dst, Rosen::Drawing::SamplingOptions());
+    canvas->DetachBrush();
+}
+
 void KnuckleGlowTraceSystem::ResetDivergentPoints(double pointX, double pointY)
 {
     CALL_DEBUG_ENTER;
-    int32_t divergenceNum = 0;
-    for (const auto &divergentPoint : divergentPoints_) {
-        CHKPC(divergentPoint);
-        if (divergentPoint->IsEnded() && divergenceNum < maxDivergenceNum_) {
-            divergenceNum++;
-            divergentPoint->Reset(pointX, pointY);
-        }
-    }
+    particles_.ResetDivergentPoints(pointX, pointY, maxDivergenceNum_);
 }
 
 void KnuckleGlowTraceSystem::AddGlowPoints(const Rosen::Drawing::Path &path, int64_t timeInterval)
 {
     CALL_DEBUG_ENTER;
-    double pathlength = path.GetLength(false);
-    Rosen::Drawing::Point pathPoints;
+    Rosen::Drawing::Point pathPoint;
     Rosen::Drawing::Point tangent;
-    float distanceFromEnd = 0;
-    float lifespanOffset = timeInterval;
-    float splitRatio = static_cast<float>(std::ceil(pathlength / BASIC_DISTANCE_BETWEEN_POINTS));
-    float baseTime = timeInterval / splitRatio;
-    for (const auto &glowPoint : glowPoints_) {
-        if (glowPoint != nullptr && glowPoint->IsEnded() && distanceFromEnd <= pathlength) {
-            if (path.GetPositionAndTangent(distanceFromEnd, pathPoints, tangent, true)) {
-                glowPoint->Reset(pathPoints.GetX(), pathPoints.GetY(), lifespanOffset);
-                distanceFromEnd += BASIC_DISTANCE_BETWEEN_POINTS;
-                lifespanOffset -= baseTime;
+    particles_.AddGlowPoints(path.GetLength(false), timeInterval, GetMillisTime(),
+        [&path, &pathPoint, &tangent](float distance, float &pointX, float &pointY) {
+            if (!path.GetPositionAndTangent(distance, pathPoint, tangent, true)) {
+                return false;
             }
-        }
-    }
+            pointX = pathPoint.GetX();
+            pointY = pathPoint.GetY();
+            return true;
+        });
 }
 } // namespace MMI
 } // namespace OHOS
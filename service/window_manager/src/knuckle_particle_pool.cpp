@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "knuckle_particle_pool.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "KnuckleParticlePool"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t DEFAULT_LIFESPAN { -1 };
+constexpr float BASIC_DISTANCE_BETWEEN_POINTS { 5.0f };
+constexpr double GLOW_BASIC_LIFESPAN { 200.0f };
+constexpr float GLOW_BASIC_SIZE { 100.0f };
+constexpr double PI { 3.14159265358979323846f };
+constexpr double MOVE_SPEED { 10.0f };
+constexpr double BASIC_GRAVITY_Y { 0.5f };
+constexpr int32_t DIVERGENT_BASIC_LIFESPAN { 15 };
+constexpr double DOUBLE { 2.0f };
+} // namespace
+
+KnuckleParticlePool::KnuckleParticlePool(size_t capacity)
+    : capacity_(capacity), glowX_(capacity), glowY_(capacity), glowLifespan_(capacity, DEFAULT_LIFESPAN),
+      glowSize_(capacity), glowUpdateTime_(capacity), divergentX_(capacity), divergentY_(capacity),
+      divergentVelocityX_(capacity), divergentVelocityY_(capacity), divergentLifespan_(capacity, DEFAULT_LIFESPAN),
+      randomEngine_(std::random_device()()) {}
+
+void KnuckleParticlePool::Clear()
+{
+    std::fill(divergentLifespan_.begin(), divergentLifespan_.end(), DEFAULT_LIFESPAN);
+    divergentCount_ = 0;
+}
+
+void KnuckleParticlePool::Update(int64_t nowMillis)
+{
+    if (glowCount_ > 0) {
+        size_t glowCount = 0;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (glowLifespan_[i] < 0) {
+                continue;
+            }
+            int64_t timeInterval = std::max<int64_t>(nowMillis - glowUpdateTime_[i], 0);
+            glowUpdateTime_[i] = nowMillis;
+            glowLifespan_[i] -= timeInterval;
+            glowSize_[i] = static_cast<float>((glowLifespan_[i] / GLOW_BASIC_LIFESPAN) * GLOW_BASIC_SIZE);
+            glowCount += (glowLifespan_[i] < 0 ? 0 : 1);
+        }
+        glowCount_ = glowCount;
+    }
+    if (divergentCount_ > 0) {
+        size_t divergentCount = 0;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (divergentLifespan_[i] < 0) {
+                continue;
+            }
+            --divergentLifespan_[i];
+            divergentX_[i] += divergentVelocityX_[i];
+            divergentY_[i] += divergentVelocityY_[i];
+            divergentVelocityY_[i] += BASIC_GRAVITY_Y;
+            divergentCount += (divergentLifespan_[i] < 0 ? 0 : 1);
+        }
+        divergentCount_ = divergentCount;
+    }
+}
+
+void KnuckleParticlePool::AddGlowPoints(double pathLength, int64_t timeInterval, int64_t nowMillis,
+    const PathSampler &sampler)
+{
+    CHKPV(sampler);
+    float distanceFromEnd = 0;
+    float lifespanOffset = timeInterval;
+    float splitRatio = static_cast<float>(std::ceil(pathLength / BASIC_DISTANCE_BETWEEN_POINTS));
+    float baseTime = timeInterval / splitRatio;
+    float pointX = 0.0f;
+    float pointY = 0.0f;
+    for (size_t i = 0; (i < capacity_) && (distanceFromEnd <= pathLength); ++i) {
+        if ((glowLifespan_[i] < 0) && sampler(distanceFromEnd, pointX, pointY)) {
+            ResetGlowPoint(i, pointX, pointY, lifespanOffset, nowMillis);
+            distanceFromEnd += BASIC_DISTANCE_BETWEEN_POINTS;
+            lifespanOffset -= baseTime;
+        }
+    }
+}
+
+int32_t KnuckleParticlePool::ResetDivergentPoints(double pointX, double pointY, int32_t maxDivergenceNum)
+{
+    int32_t divergenceNum = 0;
+    for (size_t i = 0; (i < capacity_) && (divergenceNum < maxDivergenceNum); ++i) {
+        if (divergentLifespan_[i] < 0) {
+            ++divergenceNum;
+            ResetDivergentPoint(i, pointX, pointY);
+        }
+    }
+    return divergenceNum;
+}
+
+void KnuckleParticlePool::ResetGlowPoint(size_t index, double pointX, double pointY, float lifespanOffset,
+    int64_t nowMillis)
+{
+    glowX_[index] = pointX;
+    glowY_[index] = pointY;
+    glowLifespan_[index] = GLOW_BASIC_LIFESPAN - lifespanOffset;
+    glowSize_[index] = GLOW_BASIC_SIZE;
+    glowUpdateTime_[index] = nowMillis;
+    if (glowLifespan_[index] >= 0) {
+        ++glowCount_;
+    }
+}
+
+void KnuckleParticlePool::ResetDivergentPoint(size_t index, double pointX, double pointY)
+{
+    divergentX_[index] = pointX;
+    divergentY_[index] = pointY;
+    divergentLifespan_[index] = DIVERGENT_BASIC_LIFESPAN;
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    double baseVelocity = u(randomEngine_) * DOUBLE * PI;
+    divergentVelocityX_[index] = std::cos(baseVelocity) * MOVE_SPEED;
+    divergentVelocityY_[index] = std::sin(baseVelocity) * MOVE_SPEED;
+    ++divergentCount_;
+}
+} // namespace MMI
+} // namespace OHOS
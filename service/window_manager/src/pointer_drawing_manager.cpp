@@ -134,6 +134,8 @@ constexpr float MAX_CUSTOM_CURSOR_DIMENSION { 256.0f };
 constexpr uint32_t CURSOR_STRIDE { 4 };
 constexpr int32_t MAX_FAIL_COUNT { 1000 };
 constexpr int32_t CHECK_SLEEP_TIME { 10 };
+const std::vector<MOUSE_ICON> PREWARM_CURSOR_STYLES { DEFAULT, TEXT_CURSOR, HAND_POINTING, LOADING, RUNNING,
+    RESIZE_LEFT_RIGHT, RESIZE_UP_DOWN, CURSOR_MOVE, NORTH_WEST_SOUTH_EAST, NORTH_EAST_SOUTH_WEST };
 std::atomic<bool> g_isRsRestart { false };
 #ifdef OHOS_BUILD_PC_PRIORITY
 constexpr int32_t PC_PRIORITY { 2 };
@@ -214,10 +216,10 @@ void PointerDrawingManager::InitPointerCallback()
     OnRemoteDiedCallback_ = [this]() -> void { this->RsRemoteDiedCallback(); };
     auto begin = std::chrono::high_resolution_clock::now();
     Rosen::RSInterfaces::GetInstance().SetOnRemoteDiedCallback(OnRemoteDiedCallback_);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::SET_ON_REMOTE_DIED_CALLBACK, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::SET_ON_REMOTE_DIED_CALLBACK, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (GetSurfaceNode() != nullptr) {
         SetSurfaceNode(nullptr);
@@ -2099,10 +2101,49 @@ static void ChangeSvgCursorColor(std::string& str, int32_t color)
 }
 
 std::shared_ptr<OHOS::Media::PixelMap> PointerDrawingManager::LoadCursorSvgWithColor(MOUSE_ICON type, int32_t color)
+{
+    CALL_DEBUG_ENTER;
+    return CURSOR_ASSET_CACHE.Load(GetCursorAssetKey(type), [this, color](const CursorAssetKey &key) {
+        return DecodeCursorSvg(key, color);
+    });
+}
+
+CursorAssetKey PointerDrawingManager::GetCursorAssetKey(MOUSE_ICON type)
+{
+    CursorAssetKey key {
+        .path = mouseIcons_[type].iconPath,
+        .width = imageWidth_,
+        .height = imageHeight_,
+    };
+    if (tempPointerColor_ != DEFAULT_VALUE && type != AECH_DEVELOPER_DEFINED_STYLE) {
+        key.color = static_cast<uint32_t>(GetPointerColor());
+        key.mode = CursorDecodeMode::FILL_COLOR;
+    }
+    return key;
+}
+
+void PointerDrawingManager::PrewarmCursorAssets()
+{
+    if (!system::GetBoolParameter("const.multimodalinput.prewarm_cursor_assets", true)) {
+        return;
+    }
+    std::vector<CursorAssetKey> keys;
+    for (auto style : PREWARM_CURSOR_STYLES) {
+        if (mouseIcons_.find(style) != mouseIcons_.end()) {
+            keys.push_back(GetCursorAssetKey(style));
+        }
+    }
+    int32_t color = GetPointerColor();
+    CURSOR_ASSET_CACHE.Prewarm(std::move(keys), [this, color](const CursorAssetKey &key) {
+        return DecodeCursorSvg(key, color);
+    });
+}
+
+std::shared_ptr<OHOS::Media::PixelMap> PointerDrawingManager::DecodeCursorSvg(const CursorAssetKey &key, int32_t color)
 {
     CALL_DEBUG_ENTER;
     std::string svgContent;
-    std::string imagePath = mouseIcons_[type].iconPath;
+    const std::string &imagePath = key.path;
     if (!ReadFile(imagePath, svgContent)) {
         MMI_HILOGE("read file failed");
         return nullptr;
@@ -2117,12 +2158,11 @@ std::shared_ptr<OHOS::Media::PixelMap> PointerDrawingManager::LoadCursorSvgWithC
     CHKPP(imageSource);
     OHOS::Media::DecodeOptions decodeOpts;
     decodeOpts.desiredSize = {
-        .width = imageWidth_,
-        .height = imageHeight_
+        .width = key.width,
+        .height = key.height
     };
-    int32_t pointerColor = GetPointerColor();
-    if (tempPointerColor_ != DEFAULT_VALUE && type != AECH_DEVELOPER_DEFINED_STYLE) {
-        decodeOpts.SVGOpts.fillColor = {.isValidColor = true, .color = pointerColor};
+    if (key.mode == CursorDecodeMode::FILL_COLOR) {
+        decodeOpts.SVGOpts.fillColor = {.isValidColor = true, .color = key.color};
         if (color == MAX_POINTER_COLOR) {
             decodeOpts.SVGOpts.strokeColor = {.isValidColor = true, .color = MIN_POINTER_COLOR};
         } else {
@@ -2262,8 +2302,12 @@ void PointerDrawingManager::UpdateDisplayInfo(const OLD::DisplayInfo &displayInf
     hasDisplay_ = true;
     displayInfo_ = displayInfo;
     int32_t size = GetPointerSize();
+    int32_t lastImageWidth = imageWidth_;
     imageWidth_ = pow(INCREASE_RATIO, size - 1) * displayInfo.dpi * GetIndependentPixels() / BASELINE_DENSITY;
     imageHeight_ = pow(INCREASE_RATIO, size - 1) * displayInfo.dpi * GetIndependentPixels() / BASELINE_DENSITY;
+    if (imageWidth_ != lastImageWidth) {
+        PrewarmCursorAssets();
+    }
     canvasWidth_ = (imageWidth_ / POINTER_WINDOW_INIT_SIZE + 1) * POINTER_WINDOW_INIT_SIZE;
     canvasHeight_ = (imageHeight_ / POINTER_WINDOW_INIT_SIZE + 1) * POINTER_WINDOW_INIT_SIZE;
 #ifdef OHOS_BUILD_ENABLE_MAGICCURSOR
@@ -2846,7 +2890,14 @@ void PointerDrawingManager::UpdateIconPath(const MOUSE_ICON mouseStyle, std::str
         MMI_HILOGE("Cannot find the mouseStyle:%{public}d", static_cast<int32_t>(mouseStyle));
         return;
     }
+    if (iter->second.iconPath == iconPath) {
+        return;
+    }
     iter->second.iconPath = iconPath;
+    CURSOR_ASSET_CACHE.Invalidate();
+    if (hasDisplay_) {
+        PrewarmCursorAssets();
+    }
 }
 
 int32_t PointerDrawingManager::SetPointerStylePreference(PointerStyle pointerStyle)
@@ -3064,10 +3115,10 @@ void PointerDrawingManager::SubscribeScreenModeChange()
     auto begin = std::chrono::high_resolution_clock::now();
     auto ret = OHOS::Rosen::ScreenManagerLite::GetInstance().RegisterScreenModeChangeListener(
         screenModeChangeListener_);
-    auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+    auto durationUS = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::high_resolution_clock::now() - begin).count();
 #ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RE_SCREEN_MODE_CHANGE_LISTENER, durationMS);
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RE_SCREEN_MODE_CHANGE_LISTENER, durationUS);
 #endif // OHOS_BUILD_ENABLE_DFX_RADAR
     if (ret != OHOS::Rosen::DMError::DM_OK) {
         MMI_HILOGE("RegisterScreenModeChangeListener failed, ret=%{public}d", ret);
@@ -3250,6 +3301,17 @@ void PointerDrawingManager::Dump(int32_t fd, const std::vector<std::string> &arg
     DumpFullTable(oss, "Visible Info", pidTitles, pidInfos);
     oss << std::endl;
 
+    std::vector<std::string> cacheTitles = {"name", "entries", "bytes", "budget", "hits", "misses", "evictions"};
+    std::vector<std::vector<std::string>> cacheInfos;
+    for (const auto &[name, cacheStats] : {std::make_pair("image", pointerRenderer_.GetImageCacheStats()),
+        std::make_pair("svgAsset", CURSOR_ASSET_CACHE.GetStats())}) {
+        cacheInfos.push_back({name, std::to_string(cacheStats.entries), std::to_string(cacheStats.bytes),
+            std::to_string(cacheStats.budget), std::to_string(cacheStats.hits), std::to_string(cacheStats.misses),
+            std::to_string(cacheStats.evictions)});
+    }
+    DumpFullTable(oss, "Cursor Cache Info", cacheTitles, cacheInfos);
+    oss << std::endl;
+
     std::vector<std::string> hardCursorTitles = {"isHardCursorEnabled"};
     std::vector<std::vector<std::string>> hardCursorInfos;
     hardCursorInfos.push_back({GetHardCursorEnabled() ? "true" : "false"});
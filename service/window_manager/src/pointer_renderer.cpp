@@ -126,6 +126,19 @@ int32_t RenderConfig::GetOffsetY() const
     }
 }
 
+PointerImageKey RenderConfig::GetImageKey() const
+{
+    return PointerImageKey {
+        .style = static_cast<int32_t>(style_),
+        .path = path_,
+        .mtime = CursorAssetCache::GetModifyTime(path_),
+        .color = color,
+        .size = size,
+        .dpi = dpi,
+        .imageSize = GetImageSize(),
+    };
+}
+
 image_ptr_t PointerRenderer::UserIconScale(uint32_t width, uint32_t height, const RenderConfig &cfg)
 {
     image_ptr_t image = nullptr;
@@ -165,7 +178,7 @@ int32_t PointerRenderer::Render(uint8_t *addr, uint32_t width, uint32_t height,
     }
     image_ptr_t image = nullptr;
     if (cfg.userIconPixelMap == nullptr) {
-        image = LoadPointerImage(cfg);
+        image = LoadCachedPointerImage(cfg);
     } else {
         image = UserIconScale(width, height, cfg);
     }
@@ -187,6 +200,22 @@ image_ptr_t PointerRenderer::LoadPointerImage(const RenderConfig &cfg)
     return ExtractDrawingImage(pixelmap);
 }
 
+image_ptr_t PointerRenderer::LoadCachedPointerImage(const RenderConfig &cfg)
+{
+    PointerImageKey key = cfg.GetImageKey();
+    image_ptr_t image = imageCache_.Find(key);
+    if (image == nullptr) {
+        image = LoadPointerImage(cfg);
+        imageCache_.Insert(key, image);
+    }
+    return image;
+}
+
+PointerImageCacheStats PointerRenderer::GetImageCacheStats() const
+{
+    return imageCache_.GetStats();
+}
+
 static void ChangeSvgCursorColor(std::string& str, int32_t color)
 {
     std::string targetColor = IntToHexRGB(color);
@@ -220,7 +249,27 @@ void SetCursorColorBaseOnStyle(const RenderConfig &cfg, OHOS::Media::DecodeOptio
     }
 }
 
+CursorAssetKey RenderConfig::GetAssetKey() const
+{
+    int32_t imgSize = GetImageSize();
+    return CursorAssetKey {
+        .path = path_,
+        .width = imgSize,
+        .height = imgSize,
+        .color = color,
+        .style = static_cast<int32_t>(style_),
+        .mode = CursorDecodeMode::STYLE_COLOR,
+    };
+}
+
 pixelmap_ptr_t PointerRenderer::LoadCursorSvgWithColor(const RenderConfig &cfg)
+{
+    return CURSOR_ASSET_CACHE.Load(cfg.GetAssetKey(), [this, &cfg](const CursorAssetKey &) {
+        return DecodeCursorSvg(cfg);
+    });
+}
+
+pixelmap_ptr_t PointerRenderer::DecodeCursorSvg(const RenderConfig &cfg)
 {
     std::string svgContent;
     if (!ReadFile(cfg.path_, svgContent)) {
@@ -365,12 +414,8 @@ image_ptr_t PointerRenderer::ExtractDrawingImage(pixelmap_ptr_t pixelMap)
 int32_t PointerRenderer::DrawImage(OHOS::Rosen::Drawing::Canvas &canvas, const RenderConfig &cfg)
 {
     if (cfg.style_ == MOUSE_ICON::LOADING) {
-        auto loadingImg = FindImg(cfg);
-        if (loadingImg == nullptr) {
-            loadingImg = LoadPointerImage(cfg);
-            CHKPR(loadingImg, RET_ERR);
-            PushImg(cfg, loadingImg);
-        }
+        auto loadingImg = LoadCachedPointerImage(cfg);
+        CHKPR(loadingImg, RET_ERR);
         canvas.Rotate(cfg.rotationAngle, cfg.rotationFocusX, cfg.rotationFocusY);
         canvas.DrawImage(*loadingImg, cfg.GetOffsetX(), cfg.GetOffsetY(), Rosen::Drawing::SamplingOptions());
     } else {
@@ -378,12 +423,7 @@ int32_t PointerRenderer::DrawImage(OHOS::Rosen::Drawing::Canvas &canvas, const R
         runingLCfg.style_ = MOUSE_ICON::RUNNING_LEFT;
         runingLCfg.align_ = ANGLE_NW;
         runingLCfg.path_ = IMAGE_POINTER_DEFAULT_PATH + "Loading_Left.svg";
-        auto runningImgLeft = FindImg(runingLCfg);
-        if (runningImgLeft == nullptr) {
-            runningImgLeft = LoadPointerImage(runingLCfg);
-            CHKPR(runningImgLeft, RET_ERR);
-            PushImg(runingLCfg, runningImgLeft);
-        }
+        auto runningImgLeft = LoadCachedPointerImage(runingLCfg);
         CHKPR(runningImgLeft, RET_ERR);
         canvas.DrawImage(*runningImgLeft, runingLCfg.GetOffsetX(), runingLCfg.GetOffsetY(),
             Rosen::Drawing::SamplingOptions());
@@ -392,12 +432,7 @@ int32_t PointerRenderer::DrawImage(OHOS::Rosen::Drawing::Canvas &canvas, const R
         runingRCfg.style_ = MOUSE_ICON::RUNNING_RIGHT;
         runingRCfg.align_ = ANGLE_NW;
         runingRCfg.path_ = IMAGE_POINTER_DEFAULT_PATH + "Loading_Right.svg";
-        auto runningImgRight = FindImg(runingRCfg);
-        if (runningImgRight == nullptr) {
-            runningImgRight = LoadPointerImage(runingRCfg);
-            CHKPR(runningImgRight, RET_ERR);
-            PushImg(runingRCfg, runningImgRight);
-        }
+        auto runningImgRight = LoadCachedPointerImage(runingRCfg);
         canvas.Rotate(runingRCfg.rotationAngle, runingRCfg.rotationFocusX, runingRCfg.rotationFocusY);
         CHKPR(runningImgRight, RET_ERR);
         canvas.DrawImage(*runningImgRight, runingRCfg.GetOffsetX(), runingRCfg.GetOffsetY(),
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "cursor_asset_cache.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "CursorAssetCacheTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+const std::string ASSET_DIR { "/data/local/tmp/" };
+constexpr int32_t N_ASSETS { 5 };
+constexpr int32_t N_ROUNDS { 100 };
+constexpr int32_t ASSET_SIZE { 48 };
+constexpr int64_t NS_PER_SEC { 1000000000 };
+const std::vector<uint32_t> COLORS { 0x000000, 0xFFFFFF, 0x7F7F7F };
+
+std::string AssetPath(int32_t index)
+{
+    return ASSET_DIR + "cursor_asset_cache_test_" + std::to_string(index) + ".svg";
+}
+
+CursorAssetKey MakeKey(int32_t index, uint32_t color)
+{
+    return CursorAssetKey {
+        .path = AssetPath(index),
+        .width = ASSET_SIZE,
+        .height = ASSET_SIZE,
+        .color = color,
+        .mode = CursorDecodeMode::FILL_COLOR,
+    };
+}
+} // namespace
+
+class CursorAssetCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        for (int32_t index = 0; index < N_ASSETS; ++index) {
+            std::ofstream file(AssetPath(index));
+            file << "<svg xmlns=\"http://www.w3.org/2000/svg\"/>";
+        }
+    }
+
+    static void TearDownTestCase(void)
+    {
+        for (int32_t index = 0; index < N_ASSETS; ++index) {
+            std::remove(AssetPath(index).c_str());
+        }
+    }
+
+    void SetUp(void)
+    {
+        nDecodes_ = 0;
+    }
+
+    // Stand-in for the SVG decoder, produces a blank pixel map of the requested size and counts the calls.
+    CursorAssetCache::Decoder MakeDecoder()
+    {
+        return [this](const CursorAssetKey &key) -> CursorAssetCache::AssetPtr {
+            ++nDecodes_;
+            Media::InitializationOptions opts;
+            opts.size.width = key.width;
+            opts.size.height = key.height;
+            opts.pixelFormat = Media::PixelFormat::BGRA_8888;
+            return Media::PixelMap::Create(opts);
+        };
+    }
+
+    std::atomic<int32_t> nDecodes_ { 0 };
+};
+
+/**
+ * @tc.name: CursorAssetCacheTest_Load_001
+ * @tc.desc: Test that churning through cursor styles and colors decodes each asset only once
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CursorAssetCacheTest, CursorAssetCacheTest_Load_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CursorAssetCache cache;
+    auto decoder = MakeDecoder();
+    for (int32_t round = 0; round < N_ROUNDS; ++round) {
+        for (int32_t index = 0; index < N_ASSETS; ++index) {
+            auto asset = cache.Load(MakeKey(index, COLORS[round % COLORS.size()]), decoder);
+            ASSERT_NE(asset, nullptr);
+        }
+    }
+    int32_t nExpected = N_ASSETS * static_cast<int32_t>(COLORS.size());
+    MMI_HILOGI("%{public}d lookups, %{public}d decodes", N_ROUNDS * N_ASSETS, nDecodes_.load());
+    EXPECT_EQ(nDecodes_.load(), nExpected);
+    PointerImageCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, static_cast<size_t>(nExpected));
+    EXPECT_EQ(stats.misses, static_cast<uint64_t>(nExpected));
+    EXPECT_EQ(stats.hits, static_cast<uint64_t>(N_ROUNDS * N_ASSETS - nExpected));
+}
+
+/**
+ * @tc.name: CursorAssetCacheTest_Load_002
+ * @tc.desc: Test that an asset replaced on disk is decoded again
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CursorAssetCacheTest, CursorAssetCacheTest_Load_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CursorAssetCache cache;
+    auto decoder = MakeDecoder();
+    ASSERT_NE(cache.Load(MakeKey(0, COLORS[0]), decoder), nullptr);
+    ASSERT_NE(cache.Load(MakeKey(0, COLORS[0]), decoder), nullptr);
+    EXPECT_EQ(nDecodes_.load(), 1);
+
+    int64_t mtime = CursorAssetCache::GetModifyTime(AssetPath(0));
+    ASSERT_GE(mtime, 0);
+    struct timespec times[2] = { { .tv_sec = 0, .tv_nsec = UTIME_OMIT }, { .tv_sec = mtime / NS_PER_SEC + 1 } };
+    ASSERT_EQ(::utimensat(AT_FDCWD, AssetPath(0).c_str(), times, 0), 0);
+    ASSERT_NE(cache.Load(MakeKey(0, COLORS[0]), decoder), nullptr);
+    EXPECT_EQ(nDecodes_.load(), 2);
+}
+
+/**
+ * @tc.name: CursorAssetCacheTest_Invalidate_001
+ * @tc.desc: Test that invalidation drops every asset and that prewarmed assets are not decoded again
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CursorAssetCacheTest, CursorAssetCacheTest_Invalidate_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    CursorAssetCache cache;
+    auto decoder = MakeDecoder();
+    std::vector<CursorAssetKey> keys;
+    for (int32_t index = 0; index < N_ASSETS; ++index) {
+        keys.push_back(MakeKey(index, COLORS[0]));
+    }
+    cache.Prewarm(keys, decoder);
+    {
+        std::lock_guard<std::mutex> guard(cache.prewarmMutex_);
+        ASSERT_TRUE(cache.prewarmThread_.joinable());
+        cache.prewarmThread_.join();
+    }
+    EXPECT_EQ(nDecodes_.load(), N_ASSETS);
+    for (const auto &key : keys) {
+        ASSERT_NE(cache.Load(key, decoder), nullptr);
+    }
+    EXPECT_EQ(nDecodes_.load(), N_ASSETS);
+
+    cache.Invalidate();
+    EXPECT_EQ(cache.GetStats().entries, 0U);
+    ASSERT_NE(cache.Load(keys.front(), decoder), nullptr);
+    EXPECT_EQ(nDecodes_.load(), N_ASSETS + 1);
+}
+} // namespace MMI
+} // namespace OHOS
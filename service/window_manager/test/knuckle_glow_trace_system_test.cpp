@@ -87,7 +87,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_Update_001, Test
     int32_t maxDivergenceNum = 0;
     auto knuckleGlowTraceSystem = KnuckleGlowTraceSystem(pointSize, pixelMap, maxDivergenceNum);
     knuckleGlowTraceSystem.Update();
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 10);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 10);
 }
 
 /**
@@ -103,7 +103,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_Update_002, Test
     int32_t maxDivergenceNum = 0;
     auto knuckleGlowTraceSystem = KnuckleGlowTraceSystem(pointSize, pixelMap, maxDivergenceNum);
     knuckleGlowTraceSystem.Update();
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 0);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 0);
 }
 
 /**
@@ -121,7 +121,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_Draw_001, TestSi
     std::shared_ptr<Rosen::RSCanvasDrawingNode> canvasNode = Rosen::RSCanvasDrawingNode::Create();
     auto canvas = static_cast<Rosen::ExtendRecordingCanvas *>(canvasNode->BeginRecording(0, 0));
     knuckleGlowTraceSystem.Draw(canvas);
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 0);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 0);
 }
 
 /**
@@ -139,7 +139,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_Draw_002, TestSi
     std::shared_ptr<Rosen::RSCanvasDrawingNode> canvasNode = Rosen::RSCanvasDrawingNode::Create();
     auto canvas = static_cast<Rosen::ExtendRecordingCanvas *>(canvasNode->BeginRecording(0, 0));
     knuckleGlowTraceSystem.Draw(canvas);
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 1);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 1);
 }
 
 /**
@@ -157,7 +157,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_ResetDivergentPo
     double pointX = 0.1;
     double pointY = 0.1;
     knuckleGlowTraceSystem.ResetDivergentPoints(pointX, pointY);
-    EXPECT_EQ(knuckleGlowTraceSystem.divergentPoints_.size(), 0);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 0);
 }
 
 /**
@@ -175,7 +175,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_ResetDivergentPo
     double pointX = 0.1;
     double pointY = 0.1;
     knuckleGlowTraceSystem.ResetDivergentPoints(pointX, pointY);
-    EXPECT_EQ(knuckleGlowTraceSystem.divergentPoints_.size(), 1);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 1);
 }
 
 /**
@@ -193,7 +193,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_AddGlowPoints_00
     Rosen::Drawing::Path path;
     int64_t timeInterval = 100;
     knuckleGlowTraceSystem.AddGlowPoints(path, timeInterval);
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 0);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 0);
 }
 
 /**
@@ -211,7 +211,7 @@ HWTEST_F(KnuckleGlowTraceSystemTest, KnuckleGlowTraceSystemTest_AddGlowPoints_00
     Rosen::Drawing::Path path;
     int64_t timeInterval = 100;
     knuckleGlowTraceSystem.AddGlowPoints(path, timeInterval);
-    EXPECT_EQ(knuckleGlowTraceSystem.glowPoints_.size(), 1);
+    EXPECT_EQ(knuckleGlowTraceSystem.particles_.GetCapacity(), 1);
 }
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "knuckle_particle_pool.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "KnuckleParticlePoolTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr size_t POOL_CAPACITY { 200 };
+constexpr int32_t MAX_DIVERGENCE_NUM { 10 };
+constexpr int64_t FRAME_INTERVAL_MS { 16 };
+constexpr int64_t SEGMENT_INTERVAL_MS { 8 };
+constexpr int32_t N_FRAMES { 120 };
+constexpr int32_t N_BENCHMARK_ROUNDS { 200 };
+constexpr float SEGMENT_LENGTH { 40.0f };
+constexpr float STROKE_STEP { 25.0f };
+constexpr double GLOW_BASIC_LIFESPAN { 200.0 };
+constexpr float GLOW_BASIC_SIZE { 100.0f };
+constexpr float BASIC_DISTANCE_BETWEEN_POINTS { 5.0f };
+
+// Straight stroke segment starting at (originX, originY), the headless stand-in for a Rosen path.
+KnuckleParticlePool::PathSampler MakeSegment(float originX, float originY)
+{
+    return [originX, originY](float distance, float &pointX, float &pointY) {
+        if ((distance < 0.0f) || (distance > SEGMENT_LENGTH)) {
+            return false;
+        }
+        pointX = originX + distance;
+        pointY = originY + distance / 2.0f;
+        return true;
+    };
+}
+
+// The glow particle as it was simulated before pooling, one heap object per particle.
+struct ReferenceGlowPoint {
+    double lifespan { -1.0 };
+    double pointX { 0.0 };
+    double pointY { 0.0 };
+    int64_t lastUpdateTimeMillis { 0 };
+    float traceSize { 0.0f };
+
+    void Update(int64_t now)
+    {
+        if (lifespan < 0) {
+            return;
+        }
+        int64_t timeInterval = std::max<int64_t>(now - lastUpdateTimeMillis, 0);
+        lastUpdateTimeMillis = now;
+        lifespan -= timeInterval;
+        traceSize = static_cast<float>((lifespan / GLOW_BASIC_LIFESPAN) * GLOW_BASIC_SIZE);
+    }
+
+    void Reset(double x, double y, float lifespanOffset, int64_t now)
+    {
+        pointX = x;
+        pointY = y;
+        lifespan = GLOW_BASIC_LIFESPAN - lifespanOffset;
+        traceSize = GLOW_BASIC_SIZE;
+        lastUpdateTimeMillis = now;
+    }
+};
+
+class ReferenceGlowTrace {
+public:
+    explicit ReferenceGlowTrace(size_t capacity)
+    {
+        for (size_t i = 0; i < capacity; ++i) {
+            points_.emplace_back(std::make_shared<ReferenceGlowPoint>());
+        }
+    }
+
+    void Update(int64_t now)
+    {
+        for (const auto &point : points_) {
+            point->Update(now);
+        }
+    }
+
+    void AddGlowPoints(double pathLength, int64_t timeInterval, int64_t now,
+        const KnuckleParticlePool::PathSampler &sampler)
+    {
+        float distanceFromEnd = 0;
+        float lifespanOffset = timeInterval;
+        float splitRatio = static_cast<float>(std::ceil(pathLength / BASIC_DISTANCE_BETWEEN_POINTS));
+        float baseTime = timeInterval / splitRatio;
+        float pointX = 0.0f;
+        float pointY = 0.0f;
+        for (const auto &point : points_) {
+            if ((point->lifespan < 0) && (distanceFromEnd <= pathLength) &&
+                sampler(distanceFromEnd, pointX, pointY)) {
+                point->Reset(pointX, pointY, lifespanOffset, now);
+                distanceFromEnd += BASIC_DISTANCE_BETWEEN_POINTS;
+                lifespanOffset -= baseTime;
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<ReferenceGlowPoint>> points_;
+};
+} // namespace
+
+class KnuckleParticlePoolTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp(void) {};
+    void TearDown(void) {};
+};
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_Update_001
+ * @tc.desc: Test that updating a pool of ended particles leaves them ended
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_Update_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    pool.Update(FRAME_INTERVAL_MS);
+    EXPECT_EQ(pool.GetGlowCount(), 0U);
+    EXPECT_EQ(pool.GetDivergentCount(), 0U);
+    for (size_t i = 0; i < pool.GetCapacity(); ++i) {
+        EXPECT_TRUE(pool.IsGlowEnded(i));
+        EXPECT_TRUE(pool.IsDivergentEnded(i));
+    }
+}
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_AddGlowPoints_001
+ * @tc.desc: Test that glow particles are spread along the path into free slots and fade out with time
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_AddGlowPoints_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    pool.AddGlowPoints(SEGMENT_LENGTH, 0, 0, MakeSegment(10.0f, 10.0f));
+    size_t nPoints = static_cast<size_t>(SEGMENT_LENGTH / BASIC_DISTANCE_BETWEEN_POINTS) + 1;
+    ASSERT_EQ(pool.GetGlowCount(), nPoints);
+    EXPECT_FALSE(pool.IsGlowEnded(0));
+    EXPECT_DOUBLE_EQ(pool.GetGlowX(0), 10.0);
+    EXPECT_DOUBLE_EQ(pool.GetGlowY(0), 10.0);
+    EXPECT_DOUBLE_EQ(pool.GetGlowX(1), 10.0 + BASIC_DISTANCE_BETWEEN_POINTS);
+    EXPECT_FLOAT_EQ(pool.GetGlowSize(0), GLOW_BASIC_SIZE);
+    EXPECT_TRUE(pool.IsGlowEnded(nPoints));
+
+    pool.Update(static_cast<int64_t>(GLOW_BASIC_LIFESPAN / 2));
+    EXPECT_FLOAT_EQ(pool.GetGlowSize(0), GLOW_BASIC_SIZE / 2);
+    pool.Update(static_cast<int64_t>(GLOW_BASIC_LIFESPAN) + 1);
+    EXPECT_EQ(pool.GetGlowCount(), 0U);
+    EXPECT_TRUE(pool.IsGlowEnded(0));
+}
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_AddGlowPoints_002
+ * @tc.desc: Test that a pool without capacity or a path that cannot be sampled adds nothing
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_AddGlowPoints_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KnuckleParticlePool empty(0);
+    empty.AddGlowPoints(SEGMENT_LENGTH, 0, 0, MakeSegment(10.0f, 10.0f));
+    EXPECT_EQ(empty.GetGlowCount(), 0U);
+
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    pool.AddGlowPoints(SEGMENT_LENGTH, 0, 0, nullptr);
+    pool.AddGlowPoints(0.0, 0, 0, [](float, float &, float &) { return false; });
+    EXPECT_EQ(pool.GetGlowCount(), 0U);
+}
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_ResetDivergentPoints_001
+ * @tc.desc: Test that divergent particles burst from the touch point, fall, end and can be cleared
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_ResetDivergentPoints_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    EXPECT_EQ(pool.ResetDivergentPoints(10.0, 5.0, MAX_DIVERGENCE_NUM), MAX_DIVERGENCE_NUM);
+    EXPECT_EQ(pool.GetDivergentCount(), static_cast<size_t>(MAX_DIVERGENCE_NUM));
+    EXPECT_DOUBLE_EQ(pool.GetDivergentX(0), 10.0);
+    EXPECT_DOUBLE_EQ(pool.GetDivergentY(0), 5.0);
+    EXPECT_TRUE(pool.IsDivergentEnded(MAX_DIVERGENCE_NUM));
+
+    double velocityY = pool.divergentVelocityY_[0];
+    pool.Update(0);
+    EXPECT_DOUBLE_EQ(pool.GetDivergentY(0), 5.0 + velocityY);
+    EXPECT_GT(pool.divergentVelocityY_[0], velocityY);
+    EXPECT_EQ(pool.ResetDivergentPoints(10.0, 5.0, MAX_DIVERGENCE_NUM), MAX_DIVERGENCE_NUM);
+    EXPECT_EQ(pool.GetDivergentCount(), static_cast<size_t>(MAX_DIVERGENCE_NUM * 2));
+
+    pool.Clear();
+    EXPECT_EQ(pool.GetDivergentCount(), 0U);
+    EXPECT_TRUE(pool.IsDivergentEnded(0));
+    pool.ResetDivergentPoints(10.0, 5.0, 1);
+    int32_t lifespan = pool.divergentLifespan_[0];
+    for (int32_t frame = 0; frame <= lifespan; ++frame) {
+        EXPECT_FALSE(pool.IsDivergentEnded(0));
+        pool.Update(0);
+    }
+    EXPECT_TRUE(pool.IsDivergentEnded(0));
+    EXPECT_EQ(pool.GetDivergentCount(), 0U);
+}
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_Replay_001
+ * @tc.desc: Replay a knuckle stroke and compare the glow trace with the per-particle simulation it replaces
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_Replay_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    ReferenceGlowTrace reference(POOL_CAPACITY);
+    int64_t now = 0;
+    for (int32_t frame = 0; frame < N_FRAMES; ++frame) {
+        auto segment = MakeSegment(STROKE_STEP * frame, STROKE_STEP * frame);
+        pool.AddGlowPoints(SEGMENT_LENGTH, SEGMENT_INTERVAL_MS, now, segment);
+        reference.AddGlowPoints(SEGMENT_LENGTH, SEGMENT_INTERVAL_MS, now, segment);
+        now += FRAME_INTERVAL_MS;
+        pool.Update(now);
+        reference.Update(now);
+        size_t nAlive = 0;
+        for (size_t i = 0; i < POOL_CAPACITY; ++i) {
+            const auto &point = reference.points_[i];
+            ASSERT_EQ(pool.IsGlowEnded(i), point->lifespan < 0);
+            if (point->lifespan < 0) {
+                continue;
+            }
+            ++nAlive;
+            ASSERT_EQ(pool.GetGlowX(i), point->pointX);
+            ASSERT_EQ(pool.GetGlowY(i), point->pointY);
+            ASSERT_EQ(pool.GetGlowSize(i), point->traceSize);
+        }
+        ASSERT_EQ(pool.GetGlowCount(), nAlive);
+    }
+}
+
+/**
+ * @tc.name: KnuckleParticlePoolTest_Benchmark_001
+ * @tc.desc: Measure one frame of a knuckle stroke on the pool and on per-particle heap objects
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(KnuckleParticlePoolTest, KnuckleParticlePoolTest_Benchmark_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto measure = [](auto &trace) {
+        int64_t now = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t round = 0; round < N_BENCHMARK_ROUNDS; ++round) {
+            for (int32_t frame = 0; frame < N_FRAMES; ++frame) {
+                trace.AddGlowPoints(SEGMENT_LENGTH, SEGMENT_INTERVAL_MS, now,
+                    MakeSegment(STROKE_STEP * frame, STROKE_STEP * frame));
+                now += FRAME_INTERVAL_MS;
+                trace.Update(now);
+            }
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count() / (N_BENCHMARK_ROUNDS * N_FRAMES);
+    };
+    KnuckleParticlePool pool(POOL_CAPACITY);
+    ReferenceGlowTrace reference(POOL_CAPACITY);
+    int64_t poolFrame = measure(pool);
+    int64_t referenceFrame = measure(reference);
+    MMI_HILOGI("%{public}zu particles, pool %{public}" PRId64 " ns per frame, heap objects %{public}" PRId64
+        " ns per frame", POOL_CAPACITY, poolFrame, referenceFrame);
+    EXPECT_GT(poolFrame, 0);
+}
+} // namespace MMI
+} // namespace OHOS
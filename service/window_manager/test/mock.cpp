@@ -152,7 +152,7 @@ bool InputDeviceManager::HasPointerDevice()
 }
 #endif // OHOS_BUILD_ENABLE_POINTER_DRAWING
 
-std::shared_ptr<InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
+std::shared_ptr<const InputDevice> InputDeviceManager::GetInputDevice(int32_t deviceId, bool checked) const
 {
     if (DfsMessageParcel::messageParcel == nullptr) {
         return nullptr;
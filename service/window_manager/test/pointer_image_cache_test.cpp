@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <cinttypes>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mmi_log.h"
+#include "pointer_image_cache.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "PointerImageCacheTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr int32_t IMAGE_SIZE { 64 };
+constexpr size_t IMAGE_BYTES { IMAGE_SIZE * IMAGE_SIZE * 4 };
+constexpr int32_t N_STYLES { 40 };
+constexpr int32_t N_LOOKUPS { 100000 };
+
+// CPU-only stand-in for a decoded surface, the cache only looks at its dimensions.
+class FakeImage {
+public:
+    FakeImage(int32_t width, int32_t height) : width_(width), height_(height) {}
+
+    int32_t GetWidth() const
+    {
+        return width_;
+    }
+
+    int32_t GetHeight() const
+    {
+        return height_;
+    }
+
+private:
+    int32_t width_ { 0 };
+    int32_t height_ { 0 };
+};
+
+PointerImageKey MakeKey(int32_t style)
+{
+    return PointerImageKey {
+        .style = style,
+        .path = "/system/etc/multimodalinput/mouse_icon/Default.svg",
+        .color = 0xFFFFFF,
+        .size = 1,
+        .dpi = 1.5f,
+        .imageSize = IMAGE_SIZE,
+    };
+}
+
+std::shared_ptr<FakeImage> MakeImage(int32_t size = IMAGE_SIZE)
+{
+    return std::make_shared<FakeImage>(size, size);
+}
+} // namespace
+
+class PointerImageCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp(void) {};
+};
+
+/**
+ * @tc.name: PointerImageCacheTest_Find_001
+ * @tc.desc: Test that images are found by their full key, including the file mtime, and hits and misses are counted
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerImageCacheTest, PointerImageCacheTest_Find_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerImageCache<FakeImage> cache;
+    auto image = MakeImage();
+    EXPECT_EQ(cache.Find(MakeKey(0)), nullptr);
+    cache.Insert(MakeKey(0), image);
+    EXPECT_EQ(cache.Find(MakeKey(0)), image);
+
+    PointerImageKey key = MakeKey(0);
+    key.color = 0x000000;
+    EXPECT_EQ(cache.Find(key), nullptr);
+    key = MakeKey(0);
+    key.dpi = 2.0f;
+    EXPECT_EQ(cache.Find(key), nullptr);
+    key = MakeKey(0);
+    key.mtime = 1;
+    EXPECT_EQ(cache.Find(key), nullptr);
+
+    PointerImageCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 1U);
+    EXPECT_EQ(stats.bytes, IMAGE_BYTES);
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_EQ(stats.misses, 4U);
+    EXPECT_EQ(stats.evictions, 0U);
+}
+
+/**
+ * @tc.name: PointerImageCacheTest_Insert_001
+ * @tc.desc: Test that the least recently used images are evicted once the memory budget is exceeded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerImageCacheTest, PointerImageCacheTest_Insert_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerImageCache<FakeImage> cache(IMAGE_BYTES * 3);
+    cache.Insert(MakeKey(0), MakeImage());
+    cache.Insert(MakeKey(1), MakeImage());
+    cache.Insert(MakeKey(2), MakeImage());
+    EXPECT_NE(cache.Find(MakeKey(0)), nullptr);
+    cache.Insert(MakeKey(3), MakeImage());
+
+    EXPECT_EQ(cache.Find(MakeKey(1)), nullptr);
+    EXPECT_NE(cache.Find(MakeKey(0)), nullptr);
+    EXPECT_NE(cache.Find(MakeKey(2)), nullptr);
+    EXPECT_NE(cache.Find(MakeKey(3)), nullptr);
+    PointerImageCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 3U);
+    EXPECT_EQ(stats.bytes, IMAGE_BYTES * 3);
+    EXPECT_EQ(stats.evictions, 1U);
+
+    cache.Insert(MakeKey(4), MakeImage(IMAGE_SIZE * 2));
+    stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 3U);
+    EXPECT_EQ(stats.bytes, IMAGE_BYTES * 3);
+    EXPECT_EQ(cache.Find(MakeKey(4)), nullptr);
+
+    cache.Clear();
+    stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 0U);
+    EXPECT_EQ(stats.bytes, 0U);
+}
+
+/**
+ * @tc.name: PointerImageCacheTest_Insert_002
+ * @tc.desc: Test that inserting an existing key replaces the image and its size
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerImageCacheTest, PointerImageCacheTest_Insert_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerImageCache<FakeImage> cache;
+    cache.Insert(MakeKey(0), MakeImage());
+    auto image = MakeImage(IMAGE_SIZE / 2);
+    cache.Insert(MakeKey(0), image);
+    cache.Insert(MakeKey(1), nullptr);
+    EXPECT_EQ(cache.Find(MakeKey(0)), image);
+    PointerImageCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.entries, 1U);
+    EXPECT_EQ(stats.bytes, IMAGE_BYTES / 4);
+}
+
+/**
+ * @tc.name: PointerImageCacheTest_Latency_001
+ * @tc.desc: Measure the latency of a cache hit while cycling through every cursor style
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(PointerImageCacheTest, PointerImageCacheTest_Latency_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerImageCache<FakeImage> cache;
+    for (int32_t style = 0; style < N_STYLES; ++style) {
+        cache.Insert(MakeKey(style), MakeImage());
+    }
+    std::vector<PointerImageKey> keys;
+    for (int32_t style = 0; style < N_STYLES; ++style) {
+        keys.push_back(MakeKey(style));
+    }
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t index = 0; index < N_LOOKUPS; ++index) {
+        if (cache.Find(keys[index % N_STYLES]) != nullptr) {
+            ++found;
+        }
+    }
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    MMI_HILOGI("%{public}d cache hits over %{public}d styles, mean %{public}" PRId64 " ns per lookup",
+        N_LOOKUPS, N_STYLES, elapsed / N_LOOKUPS);
+    EXPECT_EQ(found, static_cast<size_t>(N_LOOKUPS));
+    EXPECT_EQ(cache.GetStats().misses, 0U);
+}
+} // namespace MMI
+} // namespace OHOS
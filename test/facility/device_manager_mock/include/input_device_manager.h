@@ -35,6 +35,7 @@ public:
     virtual std::shared_ptr<InputDevice> GetInputDevice(int32_t deviceId) const = 0;
     virtual bool IsRemoteInputDevice(int32_t deviceId) const = 0;
     virtual int32_t FindInputDeviceId(struct libinput_device* inputDevice) = 0;
+    virtual struct libinput_device* GetLibinputDevice(int32_t deviceId) const = 0;
     virtual void Attach(std::shared_ptr<IDeviceObserver> observer) = 0;
     virtual void Detach(std::shared_ptr<IDeviceObserver> observer) = 0;
     virtual void GetMultiKeyboardDevice(std::vector<struct libinput_device*> &inputDevice) = 0;
@@ -51,6 +52,7 @@ public:
     MOCK_METHOD(std::shared_ptr<InputDevice>, GetInputDevice, (int32_t), (const));
     MOCK_METHOD(bool, IsRemoteInputDevice, (int32_t), (const));
     MOCK_METHOD(int32_t, FindInputDeviceId, (struct libinput_device*));
+    MOCK_METHOD(struct libinput_device*, GetLibinputDevice, (int32_t), (const));
     MOCK_METHOD(void, Attach, (std::shared_ptr<IDeviceObserver>));
     MOCK_METHOD(void, Detach, (std::shared_ptr<IDeviceObserver>));
     MOCK_METHOD(void, GetMultiKeyboardDevice, (std::vector<struct libinput_device*>&));
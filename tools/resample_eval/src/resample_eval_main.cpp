@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Offline evaluation of the touch resampling predictors.
+ *
+ * Replays recorded single-finger traces (one "time_us,x,y" sample per line, '#' starts a comment)
+ * through EventResample, one OnEventConsume call per raw sample and one per frame, and reports,
+ * per mode, the RMS position error against the recorded path and the overshoot: how far a
+ * resampled point lands outside the box spanned by the raw samples within one frame of it. A
+ * sample only becomes available to the resampler --delivery-us after its timestamp, modelling
+ * digitizer and transport delay. Resampled positions are whole pixels, as in the service.
+ *
+ * Usage: resample_eval [--frame-us N] [--latency-us N] [--delivery-us N] [--depth N] [--synthetic HZ]
+ *                      [trace.csv ...]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "event_resample.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int64_t US_PER_SEC { 1000000 };
+constexpr int64_t DEFAULT_FRAME_INTERVAL { 8333 };
+constexpr int64_t DEFAULT_DELIVERY_DELAY { 6000 };
+constexpr int32_t POINTER_ID { 0 };
+constexpr double OVERSHOOT_THRESHOLD { 0.5 };
+constexpr double PI { 3.14159265358979323846 };
+constexpr int32_t SYNTHETIC_DURATION_SEC { 4 };
+constexpr double SYNTHETIC_NOISE { 0.3 };
+
+struct Options {
+    ResampleConfig config;
+    int64_t deliveryDelay { DEFAULT_DELIVERY_DELAY };
+    int32_t syntheticRate { 0 };
+    std::vector<std::string> traces;
+};
+
+struct Report {
+    int32_t frames { 0 };
+    int32_t predicted { 0 };
+    double squaredError { 0.0 };
+    double maxError { 0.0 };
+    double overshootSum { 0.0 };
+    double maxOvershoot { 0.0 };
+    int32_t overshootFrames { 0 };
+
+    void Add(double error, double overshoot, bool isPredicted)
+    {
+        ++frames;
+        predicted += isPredicted ? 1 : 0;
+        squaredError += error * error;
+        maxError = std::max(maxError, error);
+        overshootSum += overshoot;
+        maxOvershoot = std::max(maxOvershoot, overshoot);
+        overshootFrames += (overshoot > OVERSHOOT_THRESHOLD) ? 1 : 0;
+    }
+};
+
+const char* ModeName(ResampleMode mode)
+{
+    switch (mode) {
+        case ResampleMode::LINEAR:
+            return "linear";
+        case ResampleMode::QUADRATIC:
+            return "quadratic";
+        case ResampleMode::KALMAN:
+            return "kalman";
+        default:
+            return "unknown";
+    }
+}
+
+bool LoadTrace(const std::string &path, std::vector<ResampleSample> &trace)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "Failed to open %s\n", path.c_str());
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream stream(line);
+        ResampleSample sample;
+        if (stream >> sample.time >> sample.x >> sample.y) {
+            trace.push_back(sample);
+        }
+    }
+    std::sort(trace.begin(), trace.end(),
+        [](const ResampleSample &a, const ResampleSample &b) { return a.time < b.time; });
+    return !trace.empty();
+}
+
+// Zig-zag stroke with sharp direction changes, the case where linear extrapolation overshoots.
+std::vector<ResampleSample> MakeSyntheticTrace(int32_t rate)
+{
+    std::vector<ResampleSample> trace;
+    std::mt19937 rng(0x5eed);
+    std::normal_distribution<double> noise(0.0, SYNTHETIC_NOISE);
+    int64_t interval = US_PER_SEC / rate;
+    for (int64_t time = 0; time < SYNTHETIC_DURATION_SEC * US_PER_SEC; time += interval) {
+        double sec = static_cast<double>(time) / US_PER_SEC;
+        double x = 600.0 + 400.0 * std::sin(2.0 * PI * 1.5 * sec);
+        double y = 1200.0 + 1.5 * 200.0 * std::asin(std::sin(2.0 * PI * 2.0 * sec));
+        trace.push_back(ResampleSample { time, static_cast<float>(x + noise(rng)),
+            static_cast<float>(y + noise(rng)) });
+    }
+    return trace;
+}
+
+// Position of the recorded path at time, linearly interpolated between raw samples.
+void TruthAt(const std::vector<ResampleSample> &trace, int64_t time, double &x, double &y)
+{
+    auto next = std::upper_bound(trace.begin(), trace.end(), time,
+        [](int64_t t, const ResampleSample &sample) { return t < sample.time; });
+    if (next == trace.begin() || next == trace.end()) {
+        const ResampleSample &edge = (next == trace.end()) ? trace.back() : trace.front();
+        x = edge.x;
+        y = edge.y;
+        return;
+    }
+    const ResampleSample &prev = *(next - 1);
+    double alpha = static_cast<double>(time - prev.time) / (next->time - prev.time);
+    x = prev.x + alpha * (next->x - prev.x);
+    y = prev.y + alpha * (next->y - prev.y);
+}
+
+double Overshoot(const std::vector<ResampleSample> &trace, int64_t time, int64_t window, double x, double y)
+{
+    double minX = INFINITY;
+    double maxX = -INFINITY;
+    double minY = INFINITY;
+    double maxY = -INFINITY;
+    for (const auto &sample : trace) {
+        if (sample.time < time - window || sample.time > time + window) {
+            continue;
+        }
+        minX = std::min(minX, static_cast<double>(sample.x));
+        maxX = std::max(maxX, static_cast<double>(sample.x));
+        minY = std::min(minY, static_cast<double>(sample.y));
+        maxY = std::max(maxY, static_cast<double>(sample.y));
+    }
+    if (minX > maxX) {
+        return 0.0;
+    }
+    double dx = std::max({ minX - x, 0.0, x - maxX });
+    double dy = std::max({ minY - y, 0.0, y - maxY });
+    return std::hypot(dx, dy);
+}
+
+std::shared_ptr<PointerEvent> CreatePointerEvent(const ResampleSample &sample, int32_t action)
+{
+    auto pointerEvent = PointerEvent::Create();
+    if (pointerEvent == nullptr) {
+        return nullptr;
+    }
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(action);
+    pointerEvent->SetPointerId(POINTER_ID);
+    pointerEvent->SetActionTime(sample.time);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(POINTER_ID);
+    item.SetDisplayX(static_cast<int32_t>(std::lround(sample.x)));
+    item.SetDisplayY(static_cast<int32_t>(std::lround(sample.y)));
+    item.SetToolType(PointerEvent::TOOL_TYPE_FINGER);
+    item.SetPressed(action != PointerEvent::POINTER_ACTION_UP);
+    pointerEvent->AddPointerItem(item);
+    return pointerEvent;
+}
+
+void Evaluate(const std::vector<ResampleSample> &trace, const ResampleConfig &config, int64_t deliveryDelay,
+    Report &report)
+{
+    int64_t frameInterval = (config.frameInterval > 0) ? config.frameInterval : DEFAULT_FRAME_INTERVAL;
+    auto resample = EventResampleHdr;
+    resample->SetResampleConfig(config);
+    ErrCode status = ERR_OK;
+    resample->OnEventConsume(CreatePointerEvent(trace.front(), PointerEvent::POINTER_ACTION_DOWN),
+        trace.front().time, status);
+    size_t delivered = 1;
+    int64_t frame = trace.front().time + frameInterval;
+    for (; frame <= trace.back().time; frame += frameInterval) {
+        for (; delivered < trace.size() && trace[delivered].time <= frame - deliveryDelay; ++delivered) {
+            resample->OnEventConsume(CreatePointerEvent(trace[delivered], PointerEvent::POINTER_ACTION_MOVE),
+                frame, status);
+        }
+        auto outEvent = resample->OnEventConsume(nullptr, frame, status);
+        PointerEvent::PointerItem item;
+        if ((outEvent == nullptr) || (outEvent->GetPointerAction() != PointerEvent::POINTER_ACTION_MOVE) ||
+            !outEvent->GetPointerItem(POINTER_ID, item)) {
+            continue;
+        }
+        int64_t outTime = outEvent->GetActionTime();
+        double x = item.GetDisplayX();
+        double y = item.GetDisplayY();
+        double truthX = 0.0;
+        double truthY = 0.0;
+        TruthAt(trace, outTime, truthX, truthY);
+        bool isPredicted = (outTime > trace[delivered - 1].time);
+        report.Add(std::hypot(x - truthX, y - truthY), Overshoot(trace, outTime, frameInterval, x, y), isPredicted);
+    }
+    resample->OnEventConsume(CreatePointerEvent(trace[delivered - 1], PointerEvent::POINTER_ACTION_UP),
+        frame, status);
+}
+
+void PrintReport(ResampleMode mode, const Report &report)
+{
+    if (report.frames == 0) {
+        std::printf("%-10s no frames\n", ModeName(mode));
+        return;
+    }
+    std::printf("%-10s frames:%6d predicted:%6d rms:%7.3f max:%7.3f overshoot mean:%6.3f max:%7.3f count:%d\n",
+        ModeName(mode), report.frames, report.predicted, std::sqrt(report.squaredError / report.frames),
+        report.maxError, report.overshootSum / report.frames, report.maxOvershoot, report.overshootFrames);
+}
+
+bool ParseOptions(int32_t argc, char *argv[], Options &options)
+{
+    options.config.frameInterval = DEFAULT_FRAME_INTERVAL;
+    for (int32_t i = 1; i < argc; ++i) {
+        bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--frame-us") == 0 && hasValue) {
+            options.config.frameInterval = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--latency-us") == 0 && hasValue) {
+            options.config.latency = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--delivery-us") == 0 && hasValue) {
+            options.deliveryDelay = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--depth") == 0 && hasValue) {
+            options.config.historyDepth = static_cast<size_t>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--synthetic") == 0 && hasValue) {
+            options.syntheticRate = std::atoi(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            return false;
+        } else {
+            options.traces.emplace_back(argv[i]);
+        }
+    }
+    return (options.syntheticRate > 0) || !options.traces.empty();
+}
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+int32_t main(int32_t argc, char *argv[])
+{
+    using namespace OHOS::MMI;
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--frame-us N] [--latency-us N] [--delivery-us N] [--depth N] "
+            "[--synthetic HZ] [trace.csv ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::vector<std::vector<ResampleSample>> traces;
+    if (options.syntheticRate > 0) {
+        traces.push_back(MakeSyntheticTrace(options.syntheticRate));
+    }
+    for (const auto &path : options.traces) {
+        std::vector<ResampleSample> trace;
+        if (!LoadTrace(path, trace)) {
+            return EXIT_FAILURE;
+        }
+        traces.push_back(std::move(trace));
+    }
+    std::printf("frame:%lldus latency:%lldus delivery:%lldus depth:%zu traces:%zu\n",
+        static_cast<long long>(options.config.frameInterval), static_cast<long long>(options.config.latency),
+        static_cast<long long>(options.deliveryDelay),
+        ResamplePredictor::ClampHistoryDepth(options.config.historyDepth), traces.size());
+    for (auto mode : { ResampleMode::LINEAR, ResampleMode::QUADRATIC, ResampleMode::KALMAN }) {
+        ResampleConfig config = options.config;
+        config.mode = mode;
+        Report report;
+        for (const auto &trace : traces) {
+            Evaluate(trace, config, options.deliveryDelay, report);
+        }
+        PrintReport(mode, report);
+    }
+    return EXIT_SUCCESS;
+}
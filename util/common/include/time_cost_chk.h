@@ -16,6 +16,7 @@
 #ifndef TIME_COST_CHK_H
 #define TIME_COST_CHK_H
 
+#include <chrono>
 #include <cinttypes>
 #include <map>
 
@@ -31,9 +32,9 @@ inline constexpr int64_t MAX_OVER_TIME { 300 };
 
 template <class T> class TimeCostChk {
 public:
-    TimeCostChk(const std::string &strReason, const std::string &strOutputStr, int64_t tmChk, T llParam1,
+    TimeCostChk(const char *strReason, const char *strOutputStr, int64_t tmChk, T llParam1,
         int64_t llParam2 = 0)
-        : beginTime_(std::chrono::high_resolution_clock::now()),
+        : beginTime_(std::chrono::steady_clock::now()),
           strOutput_(strOutputStr),
           strReason_(strReason),
           uiTime_(tmChk),
@@ -44,17 +45,17 @@ public:
     ~TimeCostChk(void)
     {
         int64_t ullCost = GetElapsed_micro();
-        const std::string eventType = GetEventTypeString(llParam1_);
-        if ((ullCost > uiTime_) && strReason_.size() > 0 && strOutput_.size() > 0) {
-            if ((llParam1_ != 0 || llParam2_ != 0) && (!eventType.empty())) {
+        if ((ullCost > uiTime_) && !IsEmpty(strReason_) && !IsEmpty(strOutput_)) {
+            const char *eventType = GetEventTypeString(llParam1_);
+            if ((llParam1_ != 0 || llParam2_ != 0) && !IsEmpty(eventType)) {
                 MMI_HILOGD("Time cost overtime (%{public}" PRId64 ",(us)>%{public}" PRId64
                     "(us)) when Reason:%{public}s,chk:%{public}s,"
                     "paramType:%{public}s, param2:%{public}" PRId64 "",
-                    ullCost, uiTime_, strReason_.c_str(), strOutput_.c_str(), eventType.c_str(), llParam2_);
+                    ullCost, uiTime_, strReason_, strOutput_, eventType, llParam2_);
             } else {
                 MMI_HILOGD("Overtime(%{public}" PRId64 ",(us)>%{public}" PRId64
                     "(us)) when Reason:%{public}s,chk:%{public}s",
-                    ullCost, uiTime_, strReason_.c_str(), strOutput_.c_str());
+                    ullCost, uiTime_, strReason_, strOutput_);
             }
         }
     }
@@ -64,14 +65,18 @@ public:
     int64_t GetElapsed_micro() const
     {
         int64_t tm64Cost = std::chrono::duration_cast<std::chrono::microseconds>(
-                            std::chrono::high_resolution_clock::now() - beginTime_
+                            std::chrono::steady_clock::now() - beginTime_
                             ).count();
         return tm64Cost;
     }
 
 private:
+    static bool IsEmpty(const char *str)
+    {
+        return (str == nullptr) || (str[0] == '\0');
+    }
 
-    const std::string GetEventTypeString(int64_t key)
+    static const char *GetEventTypeString(int64_t key)
     {
         switch (key) {
             case 1: /* 1: device_added */
@@ -113,9 +118,9 @@ private:
         }
     }
 
-    const std::chrono::time_point<std::chrono::high_resolution_clock> beginTime_;
-    const std::string strOutput_ = "";
-    const std::string strReason_ = "";
+    const std::chrono::time_point<std::chrono::steady_clock> beginTime_;
+    const char *strOutput_ { nullptr };
+    const char *strReason_ { nullptr };
     const int64_t uiTime_ { 0 };
     const int64_t llParam1_ { 0 };
     const int64_t llParam2_ { 0 };
@@ -17,6 +17,7 @@
 #define UDS_SESSION_H
 
 #include <list>
+#include <sys/uio.h>
 
 #include "net_packet.h"
 
@@ -33,6 +34,8 @@ public:
 
     bool SendMsg(const char *buf, size_t size);
     bool SendMsg(NetPacket &pkt);
+    // Sends pkt with suffix appended to its payload, pkt itself is left untouched and may be shared.
+    bool SendMsg(NetPacket &pkt, const char *suffix, size_t suffixSize);
     void Close();
     struct EventTime {
         int32_t id { 0 };
@@ -121,6 +124,9 @@ protected:
     mutable bool invalidSocket_ { false };
     int64_t lastReportTime_ = 0;
     int32_t lastReportedPid_ = 0;
+
+private:
+    bool SendIov(struct iovec *iov, size_t iovCount, size_t size);
 };
 } // namespace MMI
 } // namespace OHOS
@@ -46,6 +46,14 @@ UDSSession::UDSSession(const std::string &programName, const int32_t moduleType,
 bool UDSSession::SendMsg(const char *buf, size_t size)
 {
     CHKPF(buf);
+    struct iovec iov[] = {
+        { const_cast<char *>(buf), size },
+    };
+    return SendIov(iov, sizeof(iov) / sizeof(iov[0]), size);
+}
+
+bool UDSSession::SendIov(struct iovec *iov, size_t iovCount, size_t size)
+{
     if ((size == 0) || (size > MAX_PACKET_BUF_SIZE)) {
         MMI_HILOGE("The buf size:%{public}zu", size);
         return false;
@@ -55,6 +63,9 @@ bool UDSSession::SendMsg(const char *buf, size_t size)
         return false;
     }
 
+    struct msghdr msg {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovCount;
     int32_t idx = 0;
     int32_t retryCount = 0;
     const int32_t bufSize = static_cast<int32_t>(size);
@@ -62,7 +73,7 @@ bool UDSSession::SendMsg(const char *buf, size_t size)
     int32_t socketErrorNo = 0;
     while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
         retryCount += 1;
-        auto count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
+        auto count = sendmsg(fd_, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
         if (count < 0) {
             if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
                 socketErrorNo = errno;
@@ -77,6 +88,18 @@ bool UDSSession::SendMsg(const char *buf, size_t size)
         }
         idx += count;
         remSize -= count;
+        // Skip what was sent so a retry resumes inside the right segment.
+        size_t sent = static_cast<size_t>(count);
+        while ((sent > 0) && (msg.msg_iovlen > 0)) {
+            if (sent < msg.msg_iov->iov_len) {
+                msg.msg_iov->iov_base = static_cast<char *>(msg.msg_iov->iov_base) + sent;
+                msg.msg_iov->iov_len -= sent;
+                break;
+            }
+            sent -= msg.msg_iov->iov_len;
+            ++msg.msg_iov;
+            --msg.msg_iovlen;
+        }
         if (remSize > 0) {
             MMI_HILOGW("Remsize:%{public}d", remSize);
             usleep(SEND_RETRY_SLEEP_TIME);
@@ -119,14 +142,34 @@ void UDSSession::UpdateDescript()
 }
 
 bool UDSSession::SendMsg(NetPacket &pkt)
+{
+    return SendMsg(pkt, nullptr, 0);
+}
+
+bool UDSSession::SendMsg(NetPacket &pkt, const char *suffix, size_t suffixSize)
 {
     if (pkt.ChkRWError()) {
         MMI_HILOGE("Read and write status is error");
         return false;
     }
-    StreamBuffer buf;
-    pkt.MakeData(buf);
-    return SendMsg(buf.Data(), buf.Size());
+    if ((suffix == nullptr) && (suffixSize != 0)) {
+        MMI_HILOGE("The suffix is null");
+        return false;
+    }
+    size_t payloadSize = pkt.Size() + suffixSize;
+    if (payloadSize > MAX_PACKET_BUF_SIZE) {
+        MMI_HILOGE("The payload size:%{public}zu", payloadSize);
+        return false;
+    }
+    // The header is built per call and the payload is sent in place, so a packet marshalled once can be
+    // sent to several sessions without being copied.
+    PackHead head { pkt.GetMsgId(), static_cast<int32_t>(payloadSize) };
+    struct iovec iov[] = {
+        { &head, sizeof(head) },
+        { const_cast<char *>(pkt.Data()), pkt.Size() },
+        { const_cast<char *>(suffix), suffixSize },
+    };
+    return SendIov(iov, sizeof(iov) / sizeof(iov[0]), sizeof(head) + payloadSize);
 }
 
 void UDSSession::ReportSocketBufferFull()
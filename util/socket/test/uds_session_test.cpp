@@ -13,17 +13,45 @@
  * limitations under the License.
  */
 
+#include <chrono>
+
 #include <gtest/gtest.h>
 #include <sys/socket.h>
 
+#include "input_event_data_transformation.h"
 #include "proto.h"
 #include "uds_session.h"
 
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "UDSSessionTest"
+
 namespace OHOS {
 namespace MMI {
 namespace {
 using namespace testing::ext;
 constexpr int32_t UID_ROOT { 0 };
+constexpr int32_t MAX_BENCHMARK_SESSIONS { 16 };
+constexpr int32_t BENCHMARK_EVENTS { 1000 };
+
+std::shared_ptr<PointerEvent> CreateBenchmarkEvent()
+{
+    auto pointerEvent = PointerEvent::Create();
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerId(0);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(100);
+    item.SetDisplayY(200);
+    pointerEvent->AddPointerItem(item);
+    return pointerEvent;
+}
+
+void DrainSocket(int32_t fd)
+{
+    char buf[MAX_PACKET_BUF_SIZE];
+    while (recv(fd, buf, sizeof(buf), MSG_DONTWAIT) > 0) {}
+}
 } // namespace
 
 class UDSSessionTest : public testing::Test {
@@ -438,5 +466,89 @@ HWTEST_F(UDSSessionTest, ReportSocketBufferFull, TestSize.Level1)
     sesObj.lastReportedPid_ = sesObj.pid_;
     ASSERT_NO_FATAL_FAILURE(sesObj.ReportSocketBufferFull());
 }
+
+/**
+ * @tc.name: SendMsg_Suffix_001
+ * @tc.desc: Verify a packet sent with a suffix arrives as one message and the packet is left untouched
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, SendMsg_Suffix_001, TestSize.Level1)
+{
+    UDSSession sesObj(PROGRAM_NAME, moduleType_, writeFd_, UID_ROOT, pid_);
+    NetPacket pkt(MmiMessageId::ON_PRE_KEY_EVENT);
+    int32_t body = 7;
+    pkt << body;
+    int32_t suffix[] = { 1, 2 };
+    ASSERT_TRUE(sesObj.SendMsg(pkt, reinterpret_cast<const char *>(suffix), sizeof(suffix)));
+    EXPECT_EQ(pkt.Size(), sizeof(body));
+
+    char buf[sizeof(PackHead) + sizeof(body) + sizeof(suffix)] = {};
+    ASSERT_EQ(recv(readFd_, buf, sizeof(buf), 0), static_cast<ssize_t>(sizeof(buf)));
+    PackHead head {};
+    memcpy(&head, buf, sizeof(head));
+    EXPECT_EQ(head.idMsg, MmiMessageId::ON_PRE_KEY_EVENT);
+    EXPECT_EQ(head.size, static_cast<int32_t>(sizeof(body) + sizeof(suffix)));
+    int32_t values[3] = {};
+    memcpy(values, buf + sizeof(head), sizeof(values));
+    EXPECT_EQ(values[0], body);
+    EXPECT_EQ(values[1], suffix[0]);
+    EXPECT_EQ(values[2], suffix[1]);
+
+    EXPECT_FALSE(sesObj.SendMsg(pkt, nullptr, sizeof(suffix)));
+}
+
+/**
+ * @tc.name: SendMsg_FanOut_001
+ * @tc.desc: Compare marshalling per session against marshalling once and sending the packet in place
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, SendMsg_FanOut_001, TestSize.Level1)
+{
+    std::vector<std::pair<int32_t, int32_t>> sockets;
+    std::vector<std::shared_ptr<UDSSession>> sessions;
+    for (int32_t i = 0; i < MAX_BENCHMARK_SESSIONS; ++i) {
+        int32_t sockFds[2] = {};
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockFds), 0);
+        sockets.emplace_back(sockFds[0], sockFds[1]);
+        sessions.push_back(std::make_shared<UDSSession>(PROGRAM_NAME, moduleType_, sockFds[0], UID_ROOT, pid_));
+    }
+    auto pointerEvent = CreateBenchmarkEvent();
+    for (int32_t count = 1; count <= MAX_BENCHMARK_SESSIONS; count *= 2) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int32_t n = 0; n < BENCHMARK_EVENTS; ++n) {
+            for (int32_t i = 0; i < count; ++i) {
+                NetPacket pkt(MmiMessageId::REPORT_POINTER_EVENT);
+                ASSERT_EQ(InputEventDataTransformation::Marshalling(pointerEvent, pkt), RET_OK);
+                StreamBuffer buf;
+                pkt.MakeData(buf);
+                ASSERT_TRUE(sessions[i]->SendMsg(buf.Data(), buf.Size()));
+                DrainSocket(sockets[i].second);
+            }
+        }
+        auto perSessionCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin).count() / BENCHMARK_EVENTS;
+
+        begin = std::chrono::steady_clock::now();
+        for (int32_t n = 0; n < BENCHMARK_EVENTS; ++n) {
+            NetPacket pkt(MmiMessageId::REPORT_POINTER_EVENT);
+            ASSERT_EQ(InputEventDataTransformation::Marshalling(pointerEvent, pkt), RET_OK);
+            for (int32_t i = 0; i < count; ++i) {
+                ASSERT_TRUE(sessions[i]->SendMsg(pkt));
+                DrainSocket(sockets[i].second);
+            }
+        }
+        auto sharedCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin).count() / BENCHMARK_EVENTS;
+        MMI_HILOGI("Sessions:%{public}d, per session marshalling:%{public}lld ns/event, "
+            "shared packet:%{public}lld ns/event", count, static_cast<long long>(perSessionCost),
+            static_cast<long long>(sharedCost));
+    }
+    for (const auto &[writeFd, readFd] : sockets) {
+        close(writeFd);
+        close(readFd);
+    }
+}
 } // namespace MMI
 } // namespace OHOS